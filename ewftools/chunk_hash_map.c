@@ -0,0 +1,952 @@
+/*
+ * Chunk hash map
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "chunk_hash_map.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libhmac.h"
+
+/* Creates a chunk hash map
+ * Make sure the value chunk_hash_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_initialize(
+     chunk_hash_map_t **chunk_hash_map,
+     size64_t region_size,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_hash_map_initialize";
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_hash_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk hash map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region_size == 0 )
+	 || ( region_size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_hash_map = memory_allocate_structure(
+	                   chunk_hash_map_t );
+
+	if( *chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk hash map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_hash_map,
+	     0,
+	     sizeof( chunk_hash_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk hash map.",
+		 function );
+
+		memory_free(
+		 *chunk_hash_map );
+
+		*chunk_hash_map = NULL;
+
+		return( -1 );
+	}
+	( *chunk_hash_map )->region_size = region_size;
+
+	return( 1 );
+
+on_error:
+	if( *chunk_hash_map != NULL )
+	{
+		memory_free(
+		 *chunk_hash_map );
+
+		*chunk_hash_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk hash map
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_free(
+     chunk_hash_map_t **chunk_hash_map,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_hash_map_free";
+	int result            = 1;
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_hash_map != NULL )
+	{
+		if( ( *chunk_hash_map )->md5_context != NULL )
+		{
+			if( libhmac_md5_free(
+			     &( ( *chunk_hash_map )->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chunk_hash_map )->digest_hashes != NULL )
+		{
+			memory_free(
+			 ( *chunk_hash_map )->digest_hashes );
+		}
+		memory_free(
+		 *chunk_hash_map );
+
+		*chunk_hash_map = NULL;
+	}
+	return( result );
+}
+
+/* Resizes the region digest hashes
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_resize(
+     chunk_hash_map_t *chunk_hash_map,
+     uint64_t number_of_regions,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "chunk_hash_map_resize";
+	size_t new_size       = 0;
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_regions <= chunk_hash_map->number_of_allocated_regions )
+	{
+		return( 1 );
+	}
+	if( number_of_regions > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBHMAC_MD5_HASH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of regions value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	new_size = (size_t) number_of_regions * LIBHMAC_MD5_HASH_SIZE;
+
+	reallocation = memory_reallocate(
+	                chunk_hash_map->digest_hashes,
+	                new_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to reallocate digest hashes.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_hash_map->digest_hashes               = (uint8_t *) reallocation;
+	chunk_hash_map->number_of_allocated_regions = number_of_regions;
+
+	return( 1 );
+}
+
+/* Finalizes the digest hash of the current region and appends it to the map
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_append_digest_hash(
+     chunk_hash_map_t *chunk_hash_map,
+     libcerror_error_t **error )
+{
+	static char *function           = "chunk_hash_map_append_digest_hash";
+	uint64_t number_of_regions      = 0;
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_hash_map->md5_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk hash map - missing MD5 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_hash_map->number_of_regions >= chunk_hash_map->number_of_allocated_regions )
+	{
+		number_of_regions = chunk_hash_map->number_of_allocated_regions * 2;
+
+		if( number_of_regions == 0 )
+		{
+			number_of_regions = 64;
+		}
+		if( chunk_hash_map_resize(
+		     chunk_hash_map,
+		     number_of_regions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libhmac_md5_finalize(
+	     chunk_hash_map->md5_context,
+	     &( chunk_hash_map->digest_hashes[ chunk_hash_map->number_of_regions * LIBHMAC_MD5_HASH_SIZE ] ),
+	     LIBHMAC_MD5_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_md5_free(
+	     &( chunk_hash_map->md5_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free MD5 context.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_hash_map->number_of_regions += 1;
+	chunk_hash_map->region_offset      = 0;
+
+	return( 1 );
+}
+
+/* Updates the region digest hashes with the next (sequential) media data
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_update(
+     chunk_hash_map_t *chunk_hash_map,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_hash_map_update";
+	size_t buffer_offset  = 0;
+	size_t update_size    = 0;
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( chunk_hash_map->md5_context == NULL )
+		{
+			if( libhmac_md5_initialize(
+			     &( chunk_hash_map->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize MD5 context.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		update_size = buffer_size - buffer_offset;
+
+		if( (size64_t) update_size > ( chunk_hash_map->region_size - chunk_hash_map->region_offset ) )
+		{
+			update_size = (size_t) ( chunk_hash_map->region_size - chunk_hash_map->region_offset );
+		}
+		if( libhmac_md5_update(
+		     chunk_hash_map->md5_context,
+		     &( buffer[ buffer_offset ] ),
+		     update_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset                 += update_size;
+		chunk_hash_map->region_offset += update_size;
+		chunk_hash_map->media_size    += update_size;
+
+		if( chunk_hash_map->region_offset >= chunk_hash_map->region_size )
+		{
+			if( chunk_hash_map_append_digest_hash(
+			     chunk_hash_map,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append digest hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the digest hash of the last, partial, region
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_finalize(
+     chunk_hash_map_t *chunk_hash_map,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_hash_map_finalize";
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_hash_map->region_offset > 0 )
+	{
+		if( chunk_hash_map_append_digest_hash(
+		     chunk_hash_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares a digest hash with the digest hash of a specific region
+ * Returns 1 if the digest hashes match, 0 if not or -1 on error
+ */
+int chunk_hash_map_compare_digest_hash(
+     chunk_hash_map_t *chunk_hash_map,
+     uint64_t region_index,
+     const uint8_t *digest_hash,
+     size_t digest_hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "chunk_hash_map_compare_digest_hash";
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_index >= chunk_hash_map->number_of_regions )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_hash_size != LIBHMAC_MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest hash size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( chunk_hash_map->digest_hashes[ region_index * LIBHMAC_MD5_HASH_SIZE ] ),
+	     digest_hash,
+	     LIBHMAC_MD5_HASH_SIZE ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Writes the chunk hash map to a file
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_write_file(
+     chunk_hash_map_t *chunk_hash_map,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ CHUNK_HASH_MAP_HEADER_SIZE ];
+
+	FILE *file_stream     = NULL;
+	static char *function = "chunk_hash_map_write_file";
+	size_t write_size     = 0;
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     header_data,
+	     0,
+	     CHUNK_HASH_MAP_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     header_data,
+	     CHUNK_HASH_MAP_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 8 ] ),
+	 CHUNK_HASH_MAP_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 12 ] ),
+	 LIBHMAC_MD5_HASH_SIZE );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 16 ] ),
+	 chunk_hash_map->region_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 24 ] ),
+	 chunk_hash_map->media_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 32 ] ),
+	 chunk_hash_map->number_of_regions );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_write(
+	     file_stream,
+	     header_data,
+	     CHUNK_HASH_MAP_HEADER_SIZE ) != CHUNK_HASH_MAP_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_hash_map->number_of_regions > 0 )
+	{
+		write_size = (size_t) chunk_hash_map->number_of_regions * LIBHMAC_MD5_HASH_SIZE;
+
+		if( file_stream_write(
+		     file_stream,
+		     chunk_hash_map->digest_hashes,
+		     write_size ) != write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write digest hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Reads a chunk hash map from a file
+ * Make sure the value chunk_hash_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int chunk_hash_map_read_file(
+     chunk_hash_map_t **chunk_hash_map,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ CHUNK_HASH_MAP_HEADER_SIZE ];
+
+	FILE *file_stream          = NULL;
+	static char *function      = "chunk_hash_map_read_file";
+	size64_t media_size        = 0;
+	size64_t region_size       = 0;
+	uint64_t number_of_regions = 0;
+	size_t read_size           = 0;
+	uint32_t digest_hash_size  = 0;
+	uint32_t format_version    = 0;
+
+	if( chunk_hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_hash_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk hash map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_read(
+	     file_stream,
+	     header_data,
+	     CHUNK_HASH_MAP_HEADER_SIZE ) != CHUNK_HASH_MAP_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     header_data,
+	     CHUNK_HASH_MAP_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 8 ] ),
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 12 ] ),
+	 digest_hash_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 16 ] ),
+	 region_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 24 ] ),
+	 media_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 32 ] ),
+	 number_of_regions );
+
+	if( format_version != CHUNK_HASH_MAP_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( digest_hash_size != LIBHMAC_MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest hash size: %" PRIu32 ".",
+		 function,
+		 digest_hash_size );
+
+		goto on_error;
+	}
+	if( region_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_regions != ( ( media_size / region_size ) + ( ( media_size % region_size ) != 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of regions value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_hash_map_initialize(
+	     chunk_hash_map,
+	     region_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk hash map.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_regions > 0 )
+	{
+		if( chunk_hash_map_resize(
+		     *chunk_hash_map,
+		     number_of_regions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize digest hashes.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = (size_t) number_of_regions * LIBHMAC_MD5_HASH_SIZE;
+
+		if( file_stream_read(
+		     file_stream,
+		     ( *chunk_hash_map )->digest_hashes,
+		     read_size ) != read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read digest hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *chunk_hash_map )->media_size        = media_size;
+	( *chunk_hash_map )->number_of_regions = number_of_regions;
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_hash_map != NULL )
+	{
+		chunk_hash_map_free(
+		 chunk_hash_map,
+		 NULL );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
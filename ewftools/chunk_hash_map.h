@@ -0,0 +1,126 @@
+/*
+ * Chunk hash map
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHUNK_HASH_MAP_H )
+#define _CHUNK_HASH_MAP_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define CHUNK_HASH_MAP_SIGNATURE			"ewfhmap"
+#define CHUNK_HASH_MAP_FORMAT_VERSION			1
+#define CHUNK_HASH_MAP_HEADER_SIZE			40
+#define CHUNK_HASH_MAP_DEFAULT_NUMBER_OF_CHUNKS_PER_REGION	256
+
+typedef struct chunk_hash_map chunk_hash_map_t;
+
+/* The chunk hash map contains a MD5 digest hash per region of chunks
+ */
+struct chunk_hash_map
+{
+	/* The region size
+	 */
+	size64_t region_size;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of regions
+	 */
+	uint64_t number_of_regions;
+
+	/* The number of allocated regions
+	 */
+	uint64_t number_of_allocated_regions;
+
+	/* The region digest hashes
+	 */
+	uint8_t *digest_hashes;
+
+	/* The MD5 digest context of the current region
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The number of bytes hashed of the current region
+	 */
+	size64_t region_offset;
+};
+
+int chunk_hash_map_initialize(
+     chunk_hash_map_t **chunk_hash_map,
+     size64_t region_size,
+     libcerror_error_t **error );
+
+int chunk_hash_map_free(
+     chunk_hash_map_t **chunk_hash_map,
+     libcerror_error_t **error );
+
+int chunk_hash_map_resize(
+     chunk_hash_map_t *chunk_hash_map,
+     uint64_t number_of_regions,
+     libcerror_error_t **error );
+
+int chunk_hash_map_append_digest_hash(
+     chunk_hash_map_t *chunk_hash_map,
+     libcerror_error_t **error );
+
+int chunk_hash_map_update(
+     chunk_hash_map_t *chunk_hash_map,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int chunk_hash_map_finalize(
+     chunk_hash_map_t *chunk_hash_map,
+     libcerror_error_t **error );
+
+int chunk_hash_map_compare_digest_hash(
+     chunk_hash_map_t *chunk_hash_map,
+     uint64_t region_index,
+     const uint8_t *digest_hash,
+     size_t digest_hash_size,
+     libcerror_error_t **error );
+
+int chunk_hash_map_write_file(
+     chunk_hash_map_t *chunk_hash_map,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int chunk_hash_map_read_file(
+     chunk_hash_map_t **chunk_hash_map,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHUNK_HASH_MAP_H ) */
+
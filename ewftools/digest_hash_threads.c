@@ -0,0 +1,740 @@
+/*
+ * Digest hash threads
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "digest_hash_threads.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates digest hash threads
+ * Make sure the value digest_hash_threads is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_threads_initialize(
+     digest_hash_threads_t **digest_hash_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_hash_threads_initialize";
+
+	if( digest_hash_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest hash threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_hash_threads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest hash threads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_hash_threads = memory_allocate_structure(
+	                        digest_hash_threads_t );
+
+	if( *digest_hash_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest hash threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_hash_threads,
+	     0,
+	     sizeof( digest_hash_threads_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest hash threads.",
+		 function );
+
+		memory_free(
+		 *digest_hash_threads );
+
+		*digest_hash_threads = NULL;
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *digest_hash_threads )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *digest_hash_threads )->update_start_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create update start condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *digest_hash_threads )->update_done_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create update done condition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *digest_hash_threads != NULL )
+	{
+		if( ( *digest_hash_threads )->update_start_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *digest_hash_threads )->update_start_condition ),
+			 NULL );
+		}
+		if( ( *digest_hash_threads )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *digest_hash_threads )->mutex ),
+			 NULL );
+		}
+		memory_free(
+		 *digest_hash_threads );
+
+		*digest_hash_threads = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees digest hash threads
+ * The threads are stopped and joined
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_threads_free(
+     digest_hash_threads_t **digest_hash_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_hash_threads_free";
+	int digest_index      = 0;
+	int result            = 1;
+
+	if( digest_hash_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest hash threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_hash_threads != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     ( *digest_hash_threads )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		( *digest_hash_threads )->abort = 1;
+
+		if( libcthreads_condition_broadcast(
+		     ( *digest_hash_threads )->update_start_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast update start condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     ( *digest_hash_threads )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		for( digest_index = 0;
+		     digest_index < ( *digest_hash_threads )->number_of_digests;
+		     digest_index++ )
+		{
+			if( ( *digest_hash_threads )->digests[ digest_index ]->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( ( *digest_hash_threads )->digests[ digest_index ]->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join digest hash thread: %d.",
+					 function,
+					 digest_index );
+
+					result = -1;
+				}
+			}
+			if( ( *digest_hash_threads )->digests[ digest_index ]->update_error != NULL )
+			{
+				libcerror_error_free(
+				 &( ( *digest_hash_threads )->digests[ digest_index ]->update_error ) );
+			}
+			memory_free(
+			 ( *digest_hash_threads )->digests[ digest_index ] );
+		}
+		if( libcthreads_condition_free(
+		     &( ( *digest_hash_threads )->update_done_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free update done condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( ( *digest_hash_threads )->update_start_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free update start condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *digest_hash_threads )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *digest_hash_threads );
+
+		*digest_hash_threads = NULL;
+	}
+	return( result );
+}
+
+/* Appends a digest hash
+ * The first digest hash is updated by the calling thread, for every other
+ * digest hash a thread is created
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_threads_append_digest(
+     digest_hash_threads_t *digest_hash_threads,
+     intptr_t *context,
+     int (*update_function)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	digest_hash_thread_t *digest_hash_thread = NULL;
+	static char *function                    = "digest_hash_threads_append_digest";
+
+	if( digest_hash_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest hash threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_hash_threads->number_of_digests >= DIGEST_HASH_THREADS_MAXIMUM_NUMBER_OF_DIGESTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid digest hash threads - number of digests value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update function.",
+		 function );
+
+		return( -1 );
+	}
+	digest_hash_thread = memory_allocate_structure(
+	                      digest_hash_thread_t );
+
+	if( digest_hash_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest hash thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     digest_hash_thread,
+	     0,
+	     sizeof( digest_hash_thread_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest hash thread.",
+		 function );
+
+		goto on_error;
+	}
+	digest_hash_thread->digest_hash_threads = digest_hash_threads;
+	digest_hash_thread->context             = context;
+	digest_hash_thread->update_function     = update_function;
+	digest_hash_thread->generation          = digest_hash_threads->generation;
+
+	if( digest_hash_threads->number_of_digests > 0 )
+	{
+		if( libcthreads_thread_create(
+		     &( digest_hash_thread->thread ),
+		     NULL,
+		     (int (*)(void *)) &digest_hash_threads_thread_function,
+		     (void *) digest_hash_thread,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest hash thread.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	digest_hash_threads->digests[ digest_hash_threads->number_of_digests ] = digest_hash_thread;
+
+	digest_hash_threads->number_of_digests += 1;
+
+	return( 1 );
+
+on_error:
+	if( digest_hash_thread != NULL )
+	{
+		memory_free(
+		 digest_hash_thread );
+	}
+	return( -1 );
+}
+
+/* Updates a digest hash every time an update is started
+ * This function is run by the digest hash thread
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_threads_thread_function(
+     digest_hash_thread_t *digest_hash_thread )
+{
+	digest_hash_threads_t *digest_hash_threads = NULL;
+	const uint8_t *buffer                      = NULL;
+	size_t buffer_size                         = 0;
+
+	if( digest_hash_thread == NULL )
+	{
+		return( -1 );
+	}
+	digest_hash_threads = digest_hash_thread->digest_hash_threads;
+
+	if( digest_hash_threads == NULL )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     digest_hash_threads->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		while( ( digest_hash_threads->abort == 0 )
+		    && ( digest_hash_thread->generation == digest_hash_threads->generation ) )
+		{
+			if( libcthreads_condition_wait(
+			     digest_hash_threads->update_start_condition,
+			     digest_hash_threads->mutex,
+			     NULL ) != 1 )
+			{
+				libcthreads_mutex_release(
+				 digest_hash_threads->mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( digest_hash_threads->abort != 0 )
+		{
+			break;
+		}
+		digest_hash_thread->generation = digest_hash_threads->generation;
+
+		buffer      = digest_hash_threads->buffer;
+		buffer_size = digest_hash_threads->buffer_size;
+
+		if( libcthreads_mutex_release(
+		     digest_hash_threads->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		/* The buffer is not modified while an update is pending
+		 * hence it can be read without holding the mutex
+		 */
+		digest_hash_thread->update_function(
+		 digest_hash_thread->context,
+		 buffer,
+		 buffer_size,
+		 &( digest_hash_thread->update_error ) );
+
+		if( libcthreads_mutex_grab(
+		     digest_hash_threads->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		digest_hash_threads->number_of_pending_digests -= 1;
+
+		if( digest_hash_threads->number_of_pending_digests == 0 )
+		{
+			libcthreads_condition_broadcast(
+			 digest_hash_threads->update_done_condition,
+			 NULL );
+		}
+		if( libcthreads_mutex_release(
+		     digest_hash_threads->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     digest_hash_threads->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the digest hashes
+ * The first digest hash is updated by the calling thread while the other
+ * digest hashes are updated by their threads, this function returns after
+ * all the digest hashes have been updated
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_threads_update(
+     digest_hash_threads_t *digest_hash_threads,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_hash_threads_update";
+	int digest_index      = 0;
+	int result            = 1;
+
+	if( digest_hash_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest hash threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_hash_threads->number_of_digests == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest hash threads - missing digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_hash_threads->number_of_digests > 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     digest_hash_threads->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		digest_hash_threads->buffer                    = buffer;
+		digest_hash_threads->buffer_size               = size;
+		digest_hash_threads->number_of_pending_digests = digest_hash_threads->number_of_digests - 1;
+		digest_hash_threads->generation               += 1;
+
+		if( libcthreads_condition_broadcast(
+		     digest_hash_threads->update_start_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast update start condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 digest_hash_threads->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libcthreads_mutex_release(
+		     digest_hash_threads->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Do not return on error before the other digest hashes have been updated
+	 * since they are still reading from the buffer
+	 */
+	if( digest_hash_threads->digests[ 0 ]->update_function(
+	     digest_hash_threads->digests[ 0 ]->context,
+	     buffer,
+	     size,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( digest_hash_threads->number_of_digests > 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     digest_hash_threads->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		while( digest_hash_threads->number_of_pending_digests > 0 )
+		{
+			if( libcthreads_condition_wait(
+			     digest_hash_threads->update_done_condition,
+			     digest_hash_threads->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for update done condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 digest_hash_threads->mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( libcthreads_mutex_release(
+		     digest_hash_threads->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( digest_index = 1;
+	     digest_index < digest_hash_threads->number_of_digests;
+	     digest_index++ )
+	{
+		if( digest_hash_threads->digests[ digest_index ]->update_error != NULL )
+		{
+			/* Hand over the error of the digest hash thread
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = digest_hash_threads->digests[ digest_index ]->update_error;
+
+				digest_hash_threads->digests[ digest_index ]->update_error = NULL;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &( digest_hash_threads->digests[ digest_index ]->update_error ) );
+			}
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,155 @@
+/*
+ * Digest hash threads
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_HASH_THREADS_H )
+#define _DIGEST_HASH_THREADS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#define DIGEST_HASH_THREADS_MAXIMUM_NUMBER_OF_DIGESTS	3
+
+typedef struct digest_hash_threads digest_hash_threads_t;
+typedef struct digest_hash_thread digest_hash_thread_t;
+
+/* The digest hash thread updates a single digest hash
+ */
+struct digest_hash_thread
+{
+	/* The digest hash threads
+	 */
+	digest_hash_threads_t *digest_hash_threads;
+
+	/* The digest hash context
+	 */
+	intptr_t *context;
+
+	/* The update function
+	 */
+	int (*update_function)(
+	       intptr_t *context,
+	       const uint8_t *buffer,
+	       size_t size,
+	       libcerror_error_t **error );
+
+	/* The thread, which is NULL for the digest hash that is updated by the calling thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The update generation that was last processed
+	 */
+	uint64_t generation;
+
+	/* The error of the last update
+	 */
+	libcerror_error_t *update_error;
+};
+
+/* The digest hash threads update multiple digest hashes concurrently
+ * The first digest hash is updated by the calling thread
+ */
+struct digest_hash_threads
+{
+	/* The digest hash threads
+	 */
+	digest_hash_thread_t *digests[ DIGEST_HASH_THREADS_MAXIMUM_NUMBER_OF_DIGESTS ];
+
+	/* The number of digest hashes
+	 */
+	int number_of_digests;
+
+	/* The mutex protecting the values below
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition to signal the start of an update
+	 */
+	libcthreads_condition_t *update_start_condition;
+
+	/* The condition to signal the end of an update
+	 */
+	libcthreads_condition_t *update_done_condition;
+
+	/* The buffer of the current update
+	 */
+	const uint8_t *buffer;
+
+	/* The size of the buffer of the current update
+	 */
+	size_t buffer_size;
+
+	/* The update generation
+	 */
+	uint64_t generation;
+
+	/* The number of digest hash threads that have not finished the current update
+	 */
+	int number_of_pending_digests;
+
+	/* Value to indicate the digest hash threads should stop
+	 */
+	int abort;
+};
+
+int digest_hash_threads_initialize(
+     digest_hash_threads_t **digest_hash_threads,
+     libcerror_error_t **error );
+
+int digest_hash_threads_free(
+     digest_hash_threads_t **digest_hash_threads,
+     libcerror_error_t **error );
+
+int digest_hash_threads_append_digest(
+     digest_hash_threads_t *digest_hash_threads,
+     intptr_t *context,
+     int (*update_function)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int digest_hash_threads_thread_function(
+     digest_hash_thread_t *digest_hash_thread );
+
+int digest_hash_threads_update(
+     digest_hash_threads_t *digest_hash_threads,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_HASH_THREADS_H ) */
+
@@ -52,6 +52,7 @@
 #include "process_status.h"
 #include "storage_media_buffer.h"
 #include "storage_media_buffer_queue.h"
+#include "storage_media_buffer_reader.h"
 
 #if defined( __BORLANDC__ ) && ( __BORLANDC__ < 0x0560 )
 #define EWFACQUIRE_2_TIB				0x20000000000UL
@@ -61,6 +62,7 @@
 
 #define EWFACQUIRE_INPUT_BUFFER_SIZE			64
 #define EWFACQUIRE_MAXIMUM_PROCESS_BUFFERS_SIZE		64 * 1024 * 1024
+#define EWFACQUIRE_MAXIMUM_NUMBER_OF_READ_BUFFERS	4
 
 device_handle_t *ewfacquire_device_handle   = NULL;
 imaging_handle_t *ewfacquire_imaging_handle = NULL;
@@ -123,7 +125,8 @@ void ewfacquire_usage_fprint(
 	                 "                  [ -B number_of_bytes ] [ -c compression_values ]\n"
 	                 "                  [ -C case_number ] [ -d digest_type ] [ -D description ]\n"
 	                 "                  [ -e examiner_name ] [ -E evidence_number ] [ -f format ]\n"
-	                 "                  [ -g number_of_sectors ] [ -j jobs ] [ -l log_filename ]\n"
+	                 "                  [ -g number_of_sectors ] [ -H hash_map_filename ]\n"
+	                 "                  [ -j jobs ] [ -l log_filename ]\n"
 	                 "                  [ -m media_type ] [ -M media_flags ] [ -N notes ]\n"
 	                 "                  [ -o offset ] [ -p process_buffer_size ]\n"
 	                 "                  [ -P bytes_per_sector ] [ -r read_error_retries ]\n"
@@ -161,6 +164,9 @@ void ewfacquire_usage_fprint(
 	                 "\t        encase7, encase7-v2, linen5, linen6, linen7, ewfx\n" );
 	fprintf( stream, "\t-g      specify the number of sectors to be used as error granularity\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-H:     writes a MD5 digest (hash) per region of chunks to the\n"
+	                 "\t        hash_map_filename, which allows ewfverify to verify the\n"
+	                 "\t        regions in parallel\n" );
 	fprintf( stream, "\t-j:     the number of concurrent processing jobs (threads), where\n"
 	                 "\t        a number of 0 represents single-threaded mode (default is 4\n"
 	                 "\t        if multi-threaded mode is supported)\n" );
@@ -593,6 +599,7 @@ int ewfacquire_read_input(
 	size64_t acquiry_count                       = 0;
 	size64_t read_error_size                     = 0;
 	size64_t remaining_aquiry_size               = 0;
+	uint64_t sequence_number                     = 0;
 	size_t data_size                             = 0;
 	size_t process_buffer_size                   = 0;
 	size_t read_size                             = 0;
@@ -606,7 +613,9 @@ int ewfacquire_read_input(
 	int status                                   = PROCESS_STATUS_COMPLETED;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-	int maximum_number_of_queued_items           = 0;
+	storage_media_buffer_reader_t *storage_media_buffer_reader = NULL;
+	int maximum_number_of_queued_items                         = 0;
+	int result                                                 = 0;
 #endif
 
 	if( imaging_handle == NULL )
@@ -835,15 +844,16 @@ int ewfacquire_read_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_initialize(
-		     &( imaging_handle->output_list ),
+		if( storage_media_buffer_ring_initialize(
+		     &( imaging_handle->output_ring ),
+		     maximum_number_of_queued_items,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create output list.",
+			 "%s: unable to create output ring.",
 			 function );
 
 			goto on_error;
@@ -939,8 +949,100 @@ int ewfacquire_read_input(
 			break;
 		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-		if( ( storage_media_buffer == NULL )
-		 && ( imaging_handle->number_of_threads != 0 ) )
+		if( ( imaging_handle->number_of_threads != 0 )
+		 && ( imaging_handle->last_offset_written >= resume_acquiry_offset ) )
+		{
+			/* Once the resumed data has been read back the input is read ahead
+			 * on a separate thread so that reading overlaps with processing
+			 */
+			if( storage_media_buffer_reader == NULL )
+			{
+				if( storage_media_buffer != NULL )
+				{
+					if( storage_media_buffer_queue_release_buffer(
+					     imaging_handle->storage_media_buffer_queue,
+					     storage_media_buffer,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to release storage media buffer onto queue.",
+						 function );
+
+						goto on_error;
+					}
+					storage_media_buffer = NULL;
+				}
+				if( storage_media_buffer_reader_initialize(
+				     &storage_media_buffer_reader,
+				     imaging_handle->storage_media_buffer_queue,
+				     EWFACQUIRE_MAXIMUM_NUMBER_OF_READ_BUFFERS,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create storage media buffer reader.",
+					 function );
+
+					goto on_error;
+				}
+				if( storage_media_buffer_reader_start(
+				     storage_media_buffer_reader,
+				     (intptr_t *) device_handle,
+				     (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &device_handle_read_storage_media_buffer,
+				     storage_media_offset,
+				     remaining_aquiry_size,
+				     process_buffer_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to start storage media buffer reader.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			result = storage_media_buffer_reader_grab_buffer(
+			          storage_media_buffer_reader,
+			          &storage_media_buffer,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: error reading data from input.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( ewfacquire_abort != 0 )
+				{
+					break;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unexpected end of input.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( ( storage_media_buffer == NULL )
+		      && ( imaging_handle->number_of_threads != 0 ) )
 		{
 			if( storage_media_buffer_queue_grab_buffer(
 			     imaging_handle->storage_media_buffer_queue,
@@ -1046,6 +1148,15 @@ int ewfacquire_read_input(
 			storage_media_offset  += read_count;
 			remaining_aquiry_size -= read_count;
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		else if( storage_media_buffer_reader != NULL )
+		{
+			read_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
+
+			storage_media_offset  += read_count;
+			remaining_aquiry_size -= read_count;
+		}
+#endif
 		else
 		{
 			read_count = device_handle_read_storage_media_buffer(
@@ -1156,6 +1267,10 @@ int ewfacquire_read_input(
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		else if( imaging_handle->number_of_threads != 0 )
 		{
+			storage_media_buffer->sequence_number = sequence_number;
+
+			sequence_number++;
+
 			if( libcthreads_thread_pool_push(
 			     imaging_handle->process_thread_pool,
 			     (intptr_t *) storage_media_buffer,
@@ -1243,6 +1358,22 @@ int ewfacquire_read_input(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( storage_media_buffer_reader != NULL )
+	{
+		if( storage_media_buffer_reader_free(
+		     &storage_media_buffer_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free storage media buffer reader.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( imaging_handle->process_thread_pool != NULL )
 	{
 		if( libcthreads_thread_pool_join(
@@ -1275,9 +1406,9 @@ int ewfacquire_read_input(
 			goto on_error;
 		}
 	}
-	if( imaging_handle->output_list != NULL )
+	if( imaging_handle->output_ring != NULL )
 	{
-		if( imaging_handle_empty_output_list(
+		if( imaging_handle_empty_output_ring(
 		     imaging_handle,
 		     error ) != 1 )
 		{
@@ -1285,21 +1416,20 @@ int ewfacquire_read_input(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty output list.",
+			 "%s: unable to empty output ring.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcdata_list_free(
-		     &( imaging_handle->output_list ),
-		     NULL,
+		if( storage_media_buffer_ring_free(
+		     &( imaging_handle->output_ring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
+			 "%s: unable to free output ring.",
 			 function );
 
 			goto on_error;
@@ -1522,6 +1652,12 @@ on_error:
 		 NULL );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( storage_media_buffer_reader != NULL )
+	{
+		storage_media_buffer_reader_free(
+		 &storage_media_buffer_reader,
+		 NULL );
+	}
 	if( imaging_handle->process_thread_pool != NULL )
 	{
 		libcthreads_thread_pool_join(
@@ -1534,14 +1670,13 @@ on_error:
 		 &( imaging_handle->output_thread_pool ),
 		 NULL );
 	}
-	if( imaging_handle->output_list != NULL )
+	if( imaging_handle->output_ring != NULL )
 	{
-		imaging_handle_empty_output_list(
+		imaging_handle_empty_output_ring(
 		 imaging_handle,
 		 NULL );
-		libcdata_list_free(
-		 &( imaging_handle->output_list ),
-		 NULL,
+		storage_media_buffer_ring_free(
+		 &( imaging_handle->output_ring ),
 		 NULL );
 	}
 	if( imaging_handle->storage_media_buffer_queue != NULL )
@@ -1568,6 +1703,7 @@ int main( int argc, char * const argv[] )
 
 	libcerror_error_t *error                             = NULL;
 	log_handle_t *log_handle                             = NULL;
+	system_character_t *chunk_hash_map_filename          = NULL;
 	system_character_t *log_filename                     = NULL;
 	system_character_t *option_additional_digest_types   = NULL;
 	system_character_t *option_bytes_per_sector          = NULL;
@@ -1597,6 +1733,7 @@ int main( int argc, char * const argv[] )
 	system_integer_t option                              = 0;
 	size_t string_length                                 = 0;
 	off64_t resume_acquiry_offset                        = 0;
+	size32_t chunk_size                                  = 0;
 	uint8_t calculate_md5                                = 1;
 	uint8_t print_status_information                     = 1;
 	uint8_t resume_acquiry                               = 0;
@@ -1641,7 +1778,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:b:B:c:C:d:D:e:E:f:g:hj:l:m:M:N:o:p:P:qr:RsS:t:T:uvVwx2:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:b:B:c:C:d:D:e:E:f:g:hH:j:l:m:M:N:o:p:P:qr:RsS:t:T:uvVwx2:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -1726,6 +1863,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'H':
+				chunk_hash_map_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'j':
 				option_number_of_jobs = optarg;
 
@@ -3284,6 +3426,31 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( chunk_hash_map_filename != NULL )
+	{
+		if( imaging_handle_get_chunk_size(
+		     ewfacquire_imaging_handle,
+		     &chunk_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve chunk size.\n" );
+
+			goto on_error;
+		}
+		if( chunk_hash_map_initialize(
+		     &( ewfacquire_imaging_handle->chunk_hash_map ),
+		     (size64_t) chunk_size * CHUNK_HASH_MAP_DEFAULT_NUMBER_OF_CHUNKS_PER_REGION,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create chunk hash map.\n" );
+
+			goto on_error;
+		}
+	}
 	result = ewfacquire_read_input(
 		  ewfacquire_imaging_handle,
 		  ewfacquire_device_handle,
@@ -3305,6 +3472,32 @@ int main( int argc, char * const argv[] )
 		libcerror_error_free(
 		 &error );
 	}
+	else if( ( ewfacquire_imaging_handle->chunk_hash_map != NULL )
+	      && ( ewfacquire_abort == 0 ) )
+	{
+		if( chunk_hash_map_finalize(
+		     ewfacquire_imaging_handle->chunk_hash_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to finalize chunk hash map.\n" );
+
+			goto on_error;
+		}
+		if( chunk_hash_map_write_file(
+		     ewfacquire_imaging_handle->chunk_hash_map,
+		     chunk_hash_map_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write chunk hash map file: %" PRIs_SYSTEM ".\n",
+			 chunk_hash_map_filename );
+
+			goto on_error;
+		}
+	}
 	if( log_handle != NULL )
 	{
 		if( log_handle_close(
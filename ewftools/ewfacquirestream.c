@@ -59,6 +59,24 @@
 #include "process_status.h"
 #include "storage_media_buffer.h"
 #include "storage_media_buffer_queue.h"
+#include "storage_media_buffer_reader.h"
+
+#define EWFACQUIRESTREAM_MAXIMUM_NUMBER_OF_READ_BUFFERS	4
+
+typedef struct ewfacquirestream_input ewfacquirestream_input_t;
+
+/* The stream input
+ */
+struct ewfacquirestream_input
+{
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The number of read error retries
+	 */
+	uint8_t read_error_retries;
+};
 
 imaging_handle_t *ewfacquirestream_imaging_handle = NULL;
 int ewfacquirestream_abort                        = 0;
@@ -245,46 +263,41 @@ void ewfacquirestream_signal_handler(
 	}
 }
 
-/* Reads a chunk of data from the file descriptor into the buffer
+/* Reads a buffer of data from the stream input into the storage media buffer
+ * The data is read with as few reads as possible, a partial read is not considered an error
  * Returns the number of bytes read, 0 if at end of input or -1 on error
  */
-ssize_t ewfacquirestream_read_chunk(
-         libewf_handle_t *handle,
-         int input_file_descriptor,
+ssize_t ewfacquirestream_read_storage_media_buffer(
+         ewfacquirestream_input_t *input,
          storage_media_buffer_t *storage_media_buffer,
          off64_t storage_media_offset,
-         size_t buffer_read_size,
-         size32_t chunk_size,
-         uint8_t read_error_retries,
+         size_t read_size,
          libcerror_error_t **error )
 {
-	static char *function         = "ewfacquirestream_read_chunk";
+	static char *function         = "ewfacquirestream_read_storage_media_buffer";
 	size_t buffer_offset          = 0;
-	size_t chunk_read_size        = 0;
 	size_t input_read_size        = 0;
-	size_t remaining_read_size    = 0;
-	ssize_t chunk_read_count      = 0;
 	ssize_t input_read_count      = 0;
 	int32_t read_number_of_errors = 0;
 
-	if( handle == NULL )
+	if( input == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid input.",
 		 function );
 
 		return( -1 );
 	}
-	if( input_file_descriptor == -1 )
+	if( input->file_descriptor == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid input file descriptor.",
+		 "%s: invalid input - invalid file descriptor.",
 		 function );
 
 		return( -1 );
@@ -300,165 +313,114 @@ ssize_t ewfacquirestream_read_chunk(
 
 		return( -1 );
 	}
-	if( buffer_read_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer read size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( chunk_size == 0 )
+	if( ( read_size > (size_t) SSIZE_MAX )
+	 || ( read_size > storage_media_buffer->raw_buffer_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid chunk size value zero or less.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	remaining_read_size = buffer_read_size;
+	input_read_size = read_size;
 
-	while( remaining_read_size > 0 )
+	while( input_read_size > 0 )
 	{
-		/* Determine the number of bytes to read from the input
-		 * Read as much as possible in chunk sizes
-		 */
-		if( remaining_read_size < (size_t) chunk_size )
+		if( ewfacquirestream_abort != 0 )
 		{
-			chunk_read_size = remaining_read_size;
+			break;
 		}
-		else
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			chunk_read_size = chunk_size;
+			libcnotify_printf(
+			 "%s: reading buffer at offset: 0x%08" PRIx64 " of size: %" PRIzd ".\n",
+			 function,
+			 storage_media_offset + (off64_t) buffer_offset,
+			 input_read_size );
 		}
-		input_read_size = chunk_read_size;
-
-		chunk_read_count      = 0;
-		read_number_of_errors = 0;
-
-		while( input_read_size > 0 )
-		{
-			if( ewfacquirestream_abort != 0 )
-			{
-				break;
-			}
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading buffer at offset: 0x%08" PRIx64 " of size: %" PRIzd ".\n",
-				 function,
-				 storage_media_offset + (off64_t) buffer_offset,
-				 input_read_size );
-			}
 #endif
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
-			input_read_count = _read(
-			                    input_file_descriptor,
-			                    &( ( storage_media_buffer->raw_buffer )[ buffer_offset ] ),
-			                    (unsigned int) input_read_size );
+		input_read_count = _read(
+		                    input->file_descriptor,
+		                    &( ( storage_media_buffer->raw_buffer )[ buffer_offset ] ),
+		                    (unsigned int) input_read_size );
 #else
-			input_read_count = read(
-			                    input_file_descriptor,
-			                    &( ( storage_media_buffer->raw_buffer )[ buffer_offset ] ),
-			                    input_read_size );
+		input_read_count = read(
+		                    input->file_descriptor,
+		                    &( ( storage_media_buffer->raw_buffer )[ buffer_offset ] ),
+		                    input_read_size );
 #endif
-			if( input_read_count < 0 )
+		if( input_read_count < 0 )
+		{
+			if( ( errno == ESPIPE )
+			 || ( errno == EPERM )
+			 || ( errno == ENXIO )
+			 || ( errno == ENODEV ) )
 			{
-				if( ( errno == ESPIPE )
-				 || ( errno == EPERM )
-				 || ( errno == ENXIO )
-				 || ( errno == ENODEV ) )
+				if( errno == ESPIPE )
 				{
-					if( errno == ESPIPE )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: error reading data: invalid seek.",
-						 function );
-					}
-					else if( errno == EPERM )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: error reading data: operation not permitted.",
-						 function );
-					}
-					else if( errno == ENXIO )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: error reading data: no such device or address.",
-						 function );
-					}
-					else if( errno == ENODEV )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: error reading data: no such device.",
-						 function );
-					}
-					else
-					{
-						libcerror_system_set_error(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 errno,
-						 "%s: error reading data.",
-						 function );
-					}
-					return( -1 );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: error reading data: invalid seek.",
+					 function );
 				}
-				read_number_of_errors++;
-			}
-			/* No bytes were read
-			 */
-			else if( input_read_count == 0 )
-			{
-				break;
-			}
-			else
-			{
-				chunk_read_count += input_read_count;
-				buffer_offset    += input_read_count;
-				input_read_size  -= input_read_count;
-
-				/* The entire read is OK
-				 */
-				if( chunk_read_count == (ssize_t) chunk_read_size )
+				else if( errno == EPERM )
 				{
-					break;
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: error reading data: operation not permitted.",
+					 function );
 				}
-				/* There was a read error at a certain offset
-				 */
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
+				else if( errno == ENXIO )
 				{
-					libcnotify_printf(
-					 "%s: read error at offset: 0x%08" PRIx64 " when reading %" PRIzd " bytes.\n",
-					 function,
-					 storage_media_offset + (off64_t) buffer_offset,
-					 input_read_count );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: error reading data: no such device or address.",
+					 function );
 				}
-#endif
-				read_number_of_errors++;
+				else if( errno == ENODEV )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: error reading data: no such device.",
+					 function );
+				}
+				else
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 errno,
+					 "%s: error reading data.",
+					 function );
+				}
+				return( -1 );
+			}
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: read error at offset: 0x%08" PRIx64 ".\n",
+				 function,
+				 storage_media_offset + (off64_t) buffer_offset );
 			}
-			if( read_number_of_errors > read_error_retries )
+#endif
+			read_number_of_errors++;
+
+			if( read_number_of_errors > input->read_error_retries )
 			{
 				libcerror_error_set(
 				 error,
@@ -470,14 +432,24 @@ ssize_t ewfacquirestream_read_chunk(
 				return( -1 );
 			}
 		}
-		if( chunk_read_count == 0 )
+		/* No bytes were read
+		 */
+		else if( input_read_count == 0 )
 		{
 			break;
 		}
-		remaining_read_size -= chunk_read_count;
+		/* A pipe or socket can return less data than requested
+		 * which is not considered an error
+		 */
+		else
+		{
+			buffer_offset         += input_read_count;
+			input_read_size       -= input_read_count;
+			read_number_of_errors  = 0;
+		}
 	}
 	storage_media_buffer->storage_media_offset = storage_media_offset;
-	storage_media_buffer->requested_size       = buffer_read_size;
+	storage_media_buffer->requested_size       = read_size;
 	storage_media_buffer->raw_buffer_data_size = buffer_offset;
 
 	return( (ssize_t) buffer_offset );
@@ -496,6 +468,8 @@ int ewfacquirestream_read_input(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
+	ewfacquirestream_input_t input;
+
 	storage_media_buffer_t *storage_media_buffer = NULL;
 	uint8_t *data                                = NULL;
 	static char *function                        = "ewfacquirestream_read_input";
@@ -503,6 +477,7 @@ int ewfacquirestream_read_input(
 	size64_t remaining_aquiry_size               = 0;
 	size64_t skip_aquiry_size                    = 0;
 	size32_t chunk_size                          = 0;
+	uint64_t sequence_number                     = 0;
 	size_t data_size                             = 0;
 	size_t process_buffer_size                   = 0;
 	size_t read_size                             = 0;
@@ -513,7 +488,9 @@ int ewfacquirestream_read_input(
 	int status                                   = PROCESS_STATUS_COMPLETED;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-	int maximum_number_of_queued_items           = 0;
+	storage_media_buffer_reader_t *storage_media_buffer_reader = NULL;
+	int maximum_number_of_queued_items                         = 0;
+	int result                                                 = 0;
 #endif
 
 	if( imaging_handle == NULL )
@@ -645,15 +622,16 @@ int ewfacquirestream_read_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_initialize(
-		     &( imaging_handle->output_list ),
+		if( storage_media_buffer_ring_initialize(
+		     &( imaging_handle->output_ring ),
+		     maximum_number_of_queued_items,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create output list.",
+			 "%s: unable to create output ring.",
 			 function );
 
 			goto on_error;
@@ -740,6 +718,9 @@ int ewfacquirestream_read_input(
 			goto on_error;
 		}
 	}
+	input.file_descriptor    = input_file_descriptor;
+	input.read_error_retries = read_error_retries;
+
 	remaining_aquiry_size = imaging_handle->acquiry_size;
 	skip_aquiry_size      = imaging_handle->acquiry_offset;
 
@@ -751,75 +732,158 @@ int ewfacquirestream_read_input(
 			break;
 		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
-		if( imaging_handle->number_of_threads != 0 )
+		if( ( imaging_handle->number_of_threads != 0 )
+		 && ( skip_aquiry_size == 0 ) )
 		{
-			if( storage_media_buffer_queue_grab_buffer(
-			     imaging_handle->storage_media_buffer_queue,
-			     &storage_media_buffer,
-			     error ) != 1 )
+			/* Once the data before the acquiry offset has been skipped the input
+			 * is read ahead on a separate thread so that reading overlaps with processing
+			 */
+			if( storage_media_buffer_reader == NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to grab storage media buffer from queue.",
-				 function );
+				if( storage_media_buffer != NULL )
+				{
+					if( storage_media_buffer_queue_release_buffer(
+					     imaging_handle->storage_media_buffer_queue,
+					     storage_media_buffer,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to release storage media buffer onto queue.",
+						 function );
 
-				goto on_error;
+						goto on_error;
+					}
+					storage_media_buffer = NULL;
+				}
+				if( storage_media_buffer_reader_initialize(
+				     &storage_media_buffer_reader,
+				     imaging_handle->storage_media_buffer_queue,
+				     EWFACQUIRESTREAM_MAXIMUM_NUMBER_OF_READ_BUFFERS,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create storage media buffer reader.",
+					 function );
+
+					goto on_error;
+				}
+				if( storage_media_buffer_reader_start(
+				     storage_media_buffer_reader,
+				     (intptr_t *) &input,
+				     (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewfacquirestream_read_storage_media_buffer,
+				     storage_media_offset,
+				     remaining_aquiry_size,
+				     process_buffer_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to start storage media buffer reader.",
+					 function );
+
+					goto on_error;
+				}
 			}
-			if( storage_media_buffer == NULL )
+			result = storage_media_buffer_reader_grab_buffer(
+			          storage_media_buffer_reader,
+			          &storage_media_buffer,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing storage media buffer.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: error reading data from input.",
 				 function );
 
 				goto on_error;
 			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			read_count = (ssize_t) storage_media_buffer->raw_buffer_data_size;
 		}
+		else
 #endif
-		read_size = process_buffer_size;
-
-		/* Align with acquiry offset if necessary
-		 */
-		if( ( skip_aquiry_size > 0 )
-		 && ( skip_aquiry_size < (size64_t) read_size ) )
-		{
-			read_size = (size_t) skip_aquiry_size;
-		}
-		else if( ( imaging_handle->acquiry_size != 0 )
-		      && ( remaining_aquiry_size < (size64_t) read_size ) )
-		{
-			read_size = (size_t) remaining_aquiry_size;
-		}
-		/* Read a chunk from the file descriptor
-		 */
-		read_count = ewfacquirestream_read_chunk(
-		              imaging_handle->output_handle,
-		              input_file_descriptor,
-		              storage_media_buffer,
-		              storage_media_offset,
-		              storage_media_buffer->raw_buffer_size,
-		              (size32_t) read_size,
-		              read_error_retries,
-		              error );
-
-		if( read_count < 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: error reading data from input.",
-			 function );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( ( storage_media_buffer == NULL )
+			 && ( imaging_handle->number_of_threads != 0 ) )
+			{
+				if( storage_media_buffer_queue_grab_buffer(
+				     imaging_handle->storage_media_buffer_queue,
+				     &storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to grab storage media buffer from queue.",
+					 function );
+
+					goto on_error;
+				}
+				if( storage_media_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing storage media buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#endif
+			read_size = process_buffer_size;
 
-			goto on_error;
-		}
-		if( read_count == 0 )
-		{
-			break;
+			/* Align with acquiry offset if necessary
+			 */
+			if( ( skip_aquiry_size > 0 )
+			 && ( skip_aquiry_size < (size64_t) read_size ) )
+			{
+				read_size = (size_t) skip_aquiry_size;
+			}
+			else if( ( imaging_handle->acquiry_size != 0 )
+			      && ( remaining_aquiry_size < (size64_t) read_size ) )
+			{
+				read_size = (size_t) remaining_aquiry_size;
+			}
+			read_count = ewfacquirestream_read_storage_media_buffer(
+			              &input,
+			              storage_media_buffer,
+			              storage_media_offset,
+			              read_size,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: error reading data from input.",
+				 function );
+
+				goto on_error;
+			}
+			if( read_count == 0 )
+			{
+				break;
+			}
 		}
 		storage_media_offset += read_count;
 
@@ -889,6 +953,10 @@ int ewfacquirestream_read_input(
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( imaging_handle->number_of_threads != 0 )
 		{
+			storage_media_buffer->sequence_number = sequence_number;
+
+			sequence_number++;
+
 			if( libcthreads_thread_pool_push(
 			     imaging_handle->process_thread_pool,
 			     (intptr_t *) storage_media_buffer,
@@ -975,6 +1043,40 @@ int ewfacquirestream_read_input(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
+	else if( storage_media_buffer != NULL )
+	{
+		if( storage_media_buffer_queue_release_buffer(
+		     imaging_handle->storage_media_buffer_queue,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release storage media buffer onto queue.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer = NULL;
+	}
+	if( storage_media_buffer_reader != NULL )
+	{
+		if( storage_media_buffer_reader_free(
+		     &storage_media_buffer_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free storage media buffer reader.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( imaging_handle->process_thread_pool != NULL )
 	{
 		if( libcthreads_thread_pool_join(
@@ -1007,9 +1109,9 @@ int ewfacquirestream_read_input(
 			goto on_error;
 		}
 	}
-	if( imaging_handle->output_list != NULL )
+	if( imaging_handle->output_ring != NULL )
 	{
-		if( imaging_handle_empty_output_list(
+		if( imaging_handle_empty_output_ring(
 		     imaging_handle,
 		     error ) != 1 )
 		{
@@ -1017,21 +1119,20 @@ int ewfacquirestream_read_input(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty output list.",
+			 "%s: unable to empty output ring.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcdata_list_free(
-		     &( imaging_handle->output_list ),
-		     NULL,
+		if( storage_media_buffer_ring_free(
+		     &( imaging_handle->output_ring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
+			 "%s: unable to free output ring.",
 			 function );
 
 			goto on_error;
@@ -1172,6 +1273,12 @@ on_error:
 		 NULL );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( storage_media_buffer_reader != NULL )
+	{
+		storage_media_buffer_reader_free(
+		 &storage_media_buffer_reader,
+		 NULL );
+	}
 	if( imaging_handle->process_thread_pool != NULL )
 	{
 		libcthreads_thread_pool_join(
@@ -1184,14 +1291,13 @@ on_error:
 		 &( imaging_handle->output_thread_pool ),
 		 NULL );
 	}
-	if( imaging_handle->output_list != NULL )
+	if( imaging_handle->output_ring != NULL )
 	{
-		imaging_handle_empty_output_list(
+		imaging_handle_empty_output_ring(
 		 imaging_handle,
 		 NULL );
-		libcdata_list_free(
-		 &( imaging_handle->output_list ),
-		 NULL,
+		storage_media_buffer_ring_free(
+		 &( imaging_handle->output_ring ),
 		 NULL );
 	}
 	if( imaging_handle->storage_media_buffer_queue != NULL )
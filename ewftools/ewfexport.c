@@ -123,7 +123,7 @@ void usage_fprint(
 	                 "                 [ -B number_of_bytes ] [ -c compression_values ]\n"
 	                 "                 [ -d digest_type ] [ -f format ] [ -j jobs ] [ -l log_filename ]\n"
 	                 "                 [ -o offset ] [ -p process_buffer_size ]\n"
-	                 "                 [ -S segment_file_size ] [ -t target ] [ -hqsuvVwx ] ewf_files\n\n" );
+	                 "                 [ -S segment_file_size ] [ -t target ] [ -hkqsuvVwx ] ewf_files\n\n" );
 
 	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
 
@@ -156,6 +156,11 @@ void usage_fprint(
 	fprintf( stream, "\t-j:        the number of concurrent processing jobs (threads), where\n"
 	                 "\t           a number of 0 represents single-threaded mode (default is 4\n"
 	                 "\t           if multi-threaded mode is supported)\n" );
+	fprintf( stream, "\t-k:        keep the stored (packed) chunk data instead of recompressing\n"
+	                 "\t           it, when the entire input is exported to EWF with the same\n"
+	                 "\t           chunk size and compression values. Every chunk is still\n"
+	                 "\t           decompressed to validate its checksum and to calculate the\n"
+	                 "\t           digest hashes, corrupted chunks are recompressed (implies -x)\n" );
 	fprintf( stream, "\t-l:        logs export errors and the digest (hash) to the log_filename\n" );
 	fprintf( stream, "\t-o:        specify the offset to start the export (default is 0)\n" );
 	fprintf( stream, "\t-p:        specify the process buffer size (default is the chunk size)\n" );
@@ -279,6 +284,7 @@ int main( int argc, char * const argv[] )
 	uint8_t print_status_information                   = 1;
 	uint8_t swap_byte_pairs                            = 0;
 	uint8_t use_chunk_data_functions                   = 0;
+	uint8_t use_packed_chunk_data                      = 0;
 	uint8_t verbose                                    = 0;
 	uint8_t zero_chunk_on_error                        = 0;
 	int interactive_mode                               = 1;
@@ -346,7 +352,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:b:B:c:d:f:hj:l:o:p:qsS:t:uvVwx" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:b:B:c:d:f:hj:kl:o:p:qsS:t:uvVwx" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -411,6 +417,12 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'k':
+				use_chunk_data_functions = 1;
+				use_packed_chunk_data    = 1;
+
+				break;
+
 			case (system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -559,6 +571,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	ewfexport_export_handle->use_packed_chunk_data = use_packed_chunk_data;
+
 #if defined( HAVE_GETRLIMIT )
 	if( getrlimit(
             RLIMIT_NOFILE,
@@ -56,10 +56,15 @@
 #include "mount_dokan.h"
 #include "mount_fuse.h"
 #include "mount_handle.h"
+#include "mount_nbd.h"
 
 mount_handle_t *ewfmount_mount_handle = NULL;
 int ewfmount_abort                    = 0;
 
+#if defined( HAVE_MOUNT_NBD )
+mount_nbd_server_t *ewfmount_nbd_server = NULL;
+#endif
+
 /* Prints usage information
  */
 void usage_fprint(
@@ -71,7 +76,9 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use ewfmount to mount an Expert Witness Compression Format (EWF) image file\n\n" );
 
-	fprintf( stream, "Usage: ewfmount [ -f format ] [ -X extended_options ] [ -hvV ] image mount_point\n\n" );
+	fprintf( stream, "Usage: ewfmount [ -f format ] [ -j jobs ] [ -X extended_options ] [ -hvV ]\n"
+	                 "                image mount_point\n" );
+	fprintf( stream, "       ewfmount -N socket [ -j jobs ] [ -hvV ] image\n\n" );
 
 	fprintf( stream, "\timage:       an Expert Witness Compression Format (EWF) image file\n\n" );
 	fprintf( stream, "\tmount_point: the directory to serve as mount point\n\n" );
@@ -79,6 +86,12 @@ void usage_fprint(
 	fprintf( stream, "\t-f:          specify the input format, options: raw (default), files (restricted to\n"
 	                 "\t             logical volume files)\n" );
 	fprintf( stream, "\t-h:          shows this help\n" );
+	fprintf( stream, "\t-j:          the number of concurrent read jobs (threads), where a number\n"
+	                 "\t             of 0 represents single-threaded mode (default is 4 if\n"
+	                 "\t             multi-threaded mode is supported)\n" );
+	fprintf( stream, "\t-N:          export the media data read-only via the network block device\n"
+	                 "\t             (NBD) protocol on the Unix domain socket, instead of mounting\n"
+	                 "\t             it, this requires the raw input format\n" );
 	fprintf( stream, "\t-v:          verbose output to stderr, while ewfmount will remain running in the\n"
 	                 "\t             foreground\n" );
 	fprintf( stream, "\t-V:          print version\n" );
@@ -113,6 +126,24 @@ void ewfmount_signal_handler(
 			 &error );
 		}
 	}
+#if defined( HAVE_MOUNT_NBD )
+	if( ewfmount_nbd_server != NULL )
+	{
+		if( mount_nbd_server_signal_abort(
+		     ewfmount_nbd_server,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal NBD server to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif
 	/* Force stdin to close otherwise any function reading it will remain blocked
 	 */
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
@@ -146,10 +177,13 @@ int main( int argc, char * const argv[] )
 	system_character_t *mount_point             = NULL;
 	system_character_t *option_extended_options = NULL;
 	system_character_t *option_format           = NULL;
+	system_character_t *option_nbd_socket_path  = NULL;
+	system_character_t *option_number_of_jobs   = NULL;
 	const system_character_t *path_prefix       = NULL;
 	char *program                               = _SYSTEM_STRING( "ewfmount" );
 	system_integer_t option                     = 0;
 	size_t path_prefix_size                     = 0;
+	int number_of_arguments                     = 0;
 	int number_of_sources                       = 0;
 	int result                                  = 0;
 	int verbose                                 = 0;
@@ -203,7 +237,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "f:hvVX:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "f:hj:N:vVX:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -230,6 +264,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 'N':
+				option_nbd_socket_path = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -258,18 +302,27 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	if( ( optind + 1 ) == argc )
+	/* The mount point is not used when exporting via NBD
+	 */
+	number_of_arguments = argc - optind;
+
+	if( option_nbd_socket_path == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Missing mount point.\n" );
+		if( ( optind + 1 ) == argc )
+		{
+			fprintf(
+			 stderr,
+			 "Missing mount point.\n" );
 
-		usage_fprint(
-		 stdout );
+			usage_fprint(
+			 stdout );
 
-		return( EXIT_FAILURE );
+			return( EXIT_FAILURE );
+		}
+		mount_point = argv[ argc - 1 ];
+
+		number_of_arguments -= 1;
 	}
-	mount_point = argv[ argc - 1 ];
 
 	libcnotify_verbose_set(
 	 verbose );
@@ -293,7 +346,7 @@ int main( int argc, char * const argv[] )
 	if( ewftools_glob_resolve(
 	     glob,
 	     &( argv[ optind ] ),
-	     argc - optind - 1,
+	     number_of_arguments,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -316,7 +369,7 @@ int main( int argc, char * const argv[] )
 	}
 #else
 	sources           = &( argv[ optind ] );
-	number_of_sources = argc - optind - 1;
+	number_of_sources = number_of_arguments;
 #endif
 
 	if( mount_handle_initialize(
@@ -351,6 +404,59 @@ int main( int argc, char * const argv[] )
 			 "Unsupported input format defaulting to: raw.\n" );
 		}
 	}
+	if( option_number_of_jobs != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		result = mount_handle_set_number_of_threads(
+			  ewfmount_mount_handle,
+			  option_number_of_jobs,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs (threads).\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			ewfmount_mount_handle->number_of_threads = 4;
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs (threads) defaulting to: %d.\n",
+			 ewfmount_mount_handle->number_of_threads );
+		}
+#else
+		ewfmount_mount_handle->number_of_threads = 0;
+
+		fprintf(
+		 stderr,
+		 "Unsupported number of jobs (threads) defaulting to: %d.\n",
+		 ewfmount_mount_handle->number_of_threads );
+#endif
+	}
+	if( option_nbd_socket_path != NULL )
+	{
+#if defined( HAVE_MOUNT_NBD )
+		if( ewfmount_mount_handle->input_format != MOUNT_HANDLE_INPUT_FORMAT_RAW )
+		{
+			fprintf(
+			 stderr,
+			 "Exporting via NBD requires the raw input format.\n" );
+
+			goto on_error;
+		}
+#else
+		fprintf(
+		 stderr,
+		 "Exporting via NBD is not supported.\n" );
+
+		goto on_error;
+#endif
+	}
 #if defined( HAVE_GETRLIMIT )
 	if( getrlimit(
 	     RLIMIT_NOFILE,
@@ -425,21 +531,123 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #endif
-#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBOSXFUSE )
-	if( option_extended_options != NULL )
+#if defined( HAVE_MOUNT_NBD )
+	if( option_nbd_socket_path != NULL )
 	{
-		/* This argument is required but ignored
-		 */
-		if( fuse_opt_add_arg(
-		     &ewfmount_fuse_arguments,
-		     "" ) != 0 )
+		if( mount_nbd_server_initialize(
+		     &ewfmount_nbd_server,
+		     ewfmount_mount_handle->file_system,
+		     ewfmount_mount_handle->number_of_threads,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable add fuse arguments.\n" );
+			 "Unable to initialize NBD server.\n" );
 
 			goto on_error;
 		}
+		if( mount_nbd_server_open(
+		     ewfmount_nbd_server,
+		     option_nbd_socket_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open NBD server on: %" PRIs_SYSTEM ".\n",
+			 option_nbd_socket_path );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Exporting media data via NBD on: %" PRIs_SYSTEM "\n\n",
+		 option_nbd_socket_path );
+
+		if( mount_nbd_server_run(
+		     ewfmount_nbd_server,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run NBD server.\n" );
+
+			goto on_error;
+		}
+		if( mount_nbd_server_free(
+		     &ewfmount_nbd_server,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free NBD server.\n" );
+
+			goto on_error;
+		}
+		if( mount_handle_close(
+		     ewfmount_mount_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close mount handle.\n" );
+
+			goto on_error;
+		}
+		if( mount_handle_free(
+		     &ewfmount_mount_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free mount handle.\n" );
+
+			goto on_error;
+		}
+		return( EXIT_SUCCESS );
+	}
+#endif /* defined( HAVE_MOUNT_NBD ) */
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBOSXFUSE )
+	/* This argument is required but ignored
+	 */
+	if( fuse_opt_add_arg(
+	     &ewfmount_fuse_arguments,
+	     "" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFUSE )
+	/* The image is read-only so the kernel page cache can be kept between opens,
+	 * larger reads and read-ahead reduce the number of requests per chunk
+	 * The defaults are added first so that the extended options can override them
+	 */
+	if( fuse_opt_add_arg(
+	     &ewfmount_fuse_arguments,
+	     "-o" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &ewfmount_fuse_arguments,
+	     "kernel_cache,max_read=131072,max_readahead=1048576" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+#endif
+	if( option_extended_options != NULL )
+	{
 		if( fuse_opt_add_arg(
 		     &ewfmount_fuse_arguments,
 		     "-o" ) != 0 )
@@ -520,8 +728,18 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = fuse_loop(
-	          ewfmount_fuse_handle );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ewfmount_mount_handle->number_of_threads > 0 )
+	{
+		result = fuse_loop_mt(
+		          ewfmount_fuse_handle );
+	}
+	else
+#endif
+	{
+		result = fuse_loop(
+		          ewfmount_fuse_handle );
+	}
 
 	if( result != 0 )
 	{
@@ -564,6 +782,13 @@ int main( int argc, char * const argv[] )
 	}
 	ewfmount_dokan_options.Version     = DOKAN_VERSION;
 	ewfmount_dokan_options.ThreadCount = 0;
+
+	/* A thread count of 0 lets dokan choose the number of threads
+	 */
+	if( ewfmount_mount_handle->number_of_threads == 0 )
+	{
+		ewfmount_dokan_options.ThreadCount = 1;
+	}
 	ewfmount_dokan_options.MountPoint  = mount_point;
 
 	if( verbose != 0 )
@@ -714,6 +939,14 @@ on_error:
 	}
 	fuse_opt_free_args(
 	 &ewfmount_fuse_arguments );
+#endif
+#if defined( HAVE_MOUNT_NBD )
+	if( ewfmount_nbd_server != NULL )
+	{
+		mount_nbd_server_free(
+		 &ewfmount_nbd_server,
+		 NULL );
+	}
 #endif
 	if( ewfmount_mount_handle != NULL )
 	{
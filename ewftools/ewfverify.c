@@ -72,8 +72,8 @@ void usage_fprint(
 	                 "Compression Format).\n\n" );
 
 	fprintf( stream, "Usage: ewfverify [ -A codepage ] [ -d digest_type ] [ -f format ]\n"
-	                 "                 [ -j jobs ] [ -l log_filename ] [ -p process_buffer_size ]\n"
-	                 "                 [ -hqvVwx ] ewf_files\n\n" );
+	                 "                 [ -H hash_map_filename ] [ -j jobs ] [ -l log_filename ]\n"
+	                 "                 [ -p process_buffer_size ] [ -FhqvVwx ] ewf_files\n\n" );
 
 	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
 
@@ -86,7 +86,11 @@ void usage_fprint(
 	                 "\t           options: sha1, sha256\n" );
 	fprintf( stream, "\t-f:        specify the input format, options: raw (default),\n"
 	                 "\t           files (restricted to logical volume files)\n" );
+	fprintf( stream, "\t-F:        fast verification, only validates the chunk checksums and\n"
+	                 "\t           does not calculate the digest (hash)\n" );
 	fprintf( stream, "\t-h:        shows this help\n" );
+	fprintf( stream, "\t-H:        verify the regions in the hash_map_filename, created by\n"
+	                 "\t           ewfacquire, in parallel before calculating the digest (hash)\n" );
 	fprintf( stream, "\t-j:        the number of concurrent processing jobs (threads), where\n"
 	                 "\t           a number of 0 represents single-threaded mode (default is 4\n"
 	                 "\t           if multi-threaded mode is supported)\n" );
@@ -160,6 +164,7 @@ int main( int argc, char * const argv[] )
 	system_character_t * const *source_filenames       = NULL;
 	libcerror_error_t *error                           = NULL;
 	log_handle_t *log_handle                           = NULL;
+	system_character_t *chunk_hash_map_filename        = NULL;
 	system_character_t *log_filename                   = NULL;
 	system_character_t *option_additional_digest_types = NULL;
 	system_character_t *option_format                  = NULL;
@@ -172,8 +177,10 @@ int main( int argc, char * const argv[] )
 	uint8_t print_status_information                   = 1;
 	uint8_t use_chunk_data_functions                   = 0;
 	uint8_t verbose                                    = 0;
+	uint8_t verify_chunks_only                         = 0;
 	uint8_t zero_chunk_on_error                        = 0;
 	int number_of_filenames                            = 0;
+	int input_result                                   = 0;
 	int result                                         = 0;
 
 #if !defined( HAVE_GLOB_H )
@@ -213,7 +220,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:d:f:j:hl:p:qvVwx" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:d:f:FhH:j:l:p:qvVwx" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -244,12 +251,22 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'F':
+				verify_chunks_only = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'H':
+				chunk_hash_map_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'j':
 				option_number_of_jobs = optarg;
 
@@ -557,6 +574,21 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #endif
+	if( chunk_hash_map_filename != NULL )
+	{
+		if( verification_handle_read_chunk_hash_map(
+		     ewfverify_verification_handle,
+		     chunk_hash_map_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read chunk hash map file: %" PRIs_SYSTEM ".\n",
+			 chunk_hash_map_filename );
+
+			goto on_error;
+		}
+	}
 	if( verification_handle_set_zero_chunk_on_error(
 	     ewfverify_verification_handle,
 	     zero_chunk_on_error,
@@ -613,6 +645,54 @@ int main( int argc, char * const argv[] )
 			 &error );
 		}
 	}
+	else if( ( verify_chunks_only != 0 )
+	      || ( chunk_hash_map_filename != NULL ) )
+	{
+		result = verification_handle_verify_chunks(
+		          ewfverify_verification_handle,
+		          print_status_information,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify chunks.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		else if( ( verify_chunks_only == 0 )
+		      && ( ewfverify_abort == 0 ) )
+		{
+			/* The digest hash of the entire input is still calculated
+			 */
+			input_result = verification_handle_verify_input(
+			                ewfverify_verification_handle,
+			                print_status_information,
+			                log_handle,
+			                &error );
+
+			if( input_result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to verify input.\n" );
+
+				libcnotify_print_error_backtrace(
+				 error );
+				libcerror_error_free(
+				 &error );
+			}
+			if( input_result != 1 )
+			{
+				result = input_result;
+			}
+		}
+	}
 	else
 	{
 		result = verification_handle_verify_input(
@@ -45,6 +45,7 @@
 #include "digest_hash.h"
 #include "ewfcommon.h"
 #include "ewfinput.h"
+#include "ewftools_libcdata.h"
 #include "ewftools_libcerror.h"
 #include "ewftools_libcfile.h"
 #include "ewftools_libcnotify.h"
@@ -56,7 +57,9 @@
 #include "ewftools_system_string.h"
 #include "export_handle.h"
 #include "guid.h"
+#include "input_handle_pool.h"
 #include "process_status.h"
+#include "single_file_job.h"
 #include "storage_media_buffer.h"
 #include "storage_media_buffer_queue.h"
 
@@ -312,6 +315,24 @@ int export_handle_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *export_handle )->digest_hash_threads != NULL )
+		{
+			if( digest_hash_threads_free(
+			     &( ( *export_handle )->digest_hash_threads ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest hash threads.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( ( *export_handle )->md5_context != NULL )
 		{
 			if( libhmac_md5_free(
@@ -1193,6 +1214,147 @@ ssize_t export_handle_write_storage_media_buffer(
 	return( write_count );
 }
 
+/* Writes a storage media buffer to the raw output of the export handle at its storage media offset
+ * Sparse storage media buffers are not written, except for the last one, so that the output
+ * contains a hole and still has the full export size
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t export_handle_write_storage_media_buffer_at_offset(
+         export_handle_t *export_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_storage_media_buffer_at_offset";
+	ssize_t write_count   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->raw_output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing raw output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->processed_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( storage_media_buffer->is_sparse != 0 )
+	 && ( (size64_t) ( storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size ) < export_handle->export_size ) )
+	{
+		return( (ssize_t) storage_media_buffer->processed_size );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     export_handle->output_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab output mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( libsmraw_handle_seek_offset(
+	     export_handle->raw_output_handle,
+	     storage_media_buffer->storage_media_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in raw output handle.",
+		 function,
+		 storage_media_buffer->storage_media_offset,
+		 storage_media_buffer->storage_media_offset );
+
+		goto on_error;
+	}
+	write_count = libsmraw_handle_write_buffer(
+	               export_handle->raw_output_handle,
+	               storage_media_buffer->raw_buffer,
+	               storage_media_buffer->processed_size,
+	               error );
+
+	if( write_count != (ssize_t) storage_media_buffer->processed_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write storage media buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 storage_media_buffer->storage_media_offset,
+		 storage_media_buffer->storage_media_offset );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     export_handle->output_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release output mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( write_count );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->output_mutex != NULL )
+	{
+		libcthreads_mutex_release(
+		 export_handle->output_mutex,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
 /* Seeks the offset
  * Returns the resulting offset or -1 on error
  */
@@ -1374,9 +1536,98 @@ int export_handle_initialize_integrity_hash(
 		}
 		export_handle->sha256_context_initialized = 1;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Each digest hash is updated on its own thread when multiple are calculated
+	 */
+	if( ( export_handle->number_of_threads != 0 )
+	 && ( ( export_handle->calculate_md5 + export_handle->calculate_sha1 + export_handle->calculate_sha256 ) > 1 ) )
+	{
+		if( digest_hash_threads_initialize(
+		     &( export_handle->digest_hash_threads ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest hash threads.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle->calculate_md5 != 0 )
+		{
+			if( digest_hash_threads_append_digest(
+			     export_handle->digest_hash_threads,
+			     (intptr_t *) export_handle->md5_context,
+			     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append MD5 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle->calculate_sha1 != 0 )
+		{
+			if( digest_hash_threads_append_digest(
+			     export_handle->digest_hash_threads,
+			     (intptr_t *) export_handle->sha1_context,
+			     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha1_update,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append SHA1 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle->calculate_sha256 != 0 )
+		{
+			if( digest_hash_threads_append_digest(
+			     export_handle->digest_hash_threads,
+			     (intptr_t *) export_handle->sha256_context,
+			     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha256_update,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append SHA256 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#endif
 	return( 1 );
 
 on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->digest_hash_threads != NULL )
+	{
+		digest_hash_threads_free(
+		 &( export_handle->digest_hash_threads ),
+		 NULL );
+	}
+#endif
+	if( export_handle->sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &( export_handle->sha256_context ),
+		 NULL );
+	}
 	if( export_handle->sha1_context != NULL )
 	{
 		libhmac_sha1_free(
@@ -1437,6 +1688,27 @@ int export_handle_update_integrity_hash(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->digest_hash_threads != NULL )
+	{
+		if( digest_hash_threads_update(
+		     export_handle->digest_hash_threads,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
 	if( export_handle->calculate_md5 != 0 )
 	{
 		if( libhmac_md5_update(
@@ -1518,6 +1790,24 @@ int export_handle_finalize_integrity_hash(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->digest_hash_threads != NULL )
+	{
+		if( digest_hash_threads_free(
+		     &( export_handle->digest_hash_threads ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest hash threads.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
 	if( export_handle->calculate_md5 != 0 )
 	{
 		if( export_handle->calculated_md5_hash_string == NULL )
@@ -4195,11 +4485,14 @@ ssize_t export_handle_write(
          size_t input_size,
          libcerror_error_t **error )
 {
-	uint8_t *input_buffer = NULL;
-	static char *function = "export_handle_write";
-	size_t write_size     = 0;
-	ssize_t process_count = 0;
-	ssize_t write_count   = 0;
+	uint8_t *input_buffer      = NULL;
+	static char *function      = "export_handle_write";
+	size_t write_size          = 0;
+	ssize_t process_count      = 0;
+	ssize_t write_count        = 0;
+	uint64_t number_of_sectors = 0;
+	uint64_t start_sector      = 0;
+	int result                 = 0;
 
 	if( export_handle == NULL )
 	{
@@ -4223,7 +4516,7 @@ ssize_t export_handle_write(
 
 		return( -1 );
 	}
-	if( input_storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	if( input_storage_media_buffer->mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
 	{
 		if( output_storage_media_buffer == NULL )
 		{
@@ -4237,39 +4530,113 @@ ssize_t export_handle_write(
 			return( -1 );
 		}
 	}
-	while( input_size > 0 )
+	/* Packed chunk data is written as-is, unless it is corrupted
+	 * in which case its unpacked data is written like the regular export does
+	 */
+	if( input_storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_PACKED_CHUNK_DATA )
 	{
-		if( input_storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+		result = libewf_data_chunk_is_corrupted(
+		          input_storage_media_buffer->data_chunk,
+		          error );
+
+		if( result == -1 )
 		{
-			if( input_size > (size_t) export_handle->output_chunk_size )
-			{
-				write_size = export_handle->output_chunk_size;
-			}
-			else
-			{
-				write_size = (size_t) input_size;
-			}
-			if( ( output_storage_media_buffer->raw_buffer_data_size + write_size ) > export_handle->output_chunk_size )
-			{
-				write_size = export_handle->output_chunk_size - output_storage_media_buffer->raw_buffer_data_size;
-			}
-			input_buffer = input_storage_media_buffer->raw_buffer;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if data chunk is corrupted.",
+			 function );
 
-			if( memory_copy(
-			     &( output_storage_media_buffer->raw_buffer[ output_storage_media_buffer->raw_buffer_data_size ] ),
-			     input_buffer,
-			     write_size ) == NULL )
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			write_count = export_handle_write_storage_media_buffer(
+			               export_handle,
+			               input_storage_media_buffer,
+			               input_size,
+			               error );
+
+			if( write_count < 0 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy data from input buffer to output raw buffer.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write packed storage media buffer.",
 				 function );
 
 				return( -1 );
 			}
-			output_storage_media_buffer->raw_buffer_data_size += write_size;
+			return( (ssize_t) input_size );
+		}
+		/* The packed chunk data was not unpacked by the input handle
+		 * hence the checksum error is tracked here
+		 */
+		if( export_handle->bytes_per_sector == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid export handle - invalid bytes per sector value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		start_sector      = (uint64_t) input_storage_media_buffer->storage_media_offset / export_handle->bytes_per_sector;
+		number_of_sectors = ( (uint64_t) input_size + export_handle->bytes_per_sector - 1 ) / export_handle->bytes_per_sector;
+
+		if( libewf_handle_append_checksum_error(
+		     export_handle->input_handle,
+		     start_sector,
+		     number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checksum error.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( input_size > 0 )
+	{
+		if( input_storage_media_buffer->mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
+		{
+			if( input_size > (size_t) export_handle->output_chunk_size )
+			{
+				write_size = export_handle->output_chunk_size;
+			}
+			else
+			{
+				write_size = (size_t) input_size;
+			}
+			if( ( output_storage_media_buffer->raw_buffer_data_size + write_size ) > export_handle->output_chunk_size )
+			{
+				write_size = export_handle->output_chunk_size - output_storage_media_buffer->raw_buffer_data_size;
+			}
+			input_buffer = input_storage_media_buffer->raw_buffer;
+
+			if( memory_copy(
+			     &( output_storage_media_buffer->raw_buffer[ output_storage_media_buffer->raw_buffer_data_size ] ),
+			     input_buffer,
+			     write_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data from input buffer to output raw buffer.",
+				 function );
+
+				return( -1 );
+			}
+			output_storage_media_buffer->raw_buffer_data_size += write_size;
 
 			/* Make sure the output chunk is filled upto the output chunk size
 			 */
@@ -4308,7 +4675,7 @@ ssize_t export_handle_write(
 
 			return( -1 );
 		}
-		if( input_storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+		if( input_storage_media_buffer->mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
 		{
 			write_count = export_handle_write_storage_media_buffer(
 				       export_handle,
@@ -4338,7 +4705,7 @@ ssize_t export_handle_write(
 		input_size  -= process_count;
 		write_count += process_count;
 
-		if( input_storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+		if( input_storage_media_buffer->mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
 		{
 			output_storage_media_buffer->raw_buffer_data_size = 0;
 		}
@@ -4459,8 +4826,11 @@ int export_handle_process_storage_media_buffer_callback(
      export_handle_t *export_handle )
 {
         libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
         static char *function    = "export_handle_process_storage_media_buffer_callback";
+	size_t data_size         = 0;
 	ssize_t process_count    = 0;
+	ssize_t write_count      = 0;
 
 	if( storage_media_buffer == NULL )
 	{
@@ -4507,6 +4877,61 @@ int export_handle_process_storage_media_buffer_callback(
 			goto on_error;
 		}
 	}
+	/* The raw output is written at the storage media offset in any order,
+	 * only the integrity hash(es) are calculated by the output thread
+	 */
+	if( export_handle->use_positional_write != 0 )
+	{
+		if( export_handle->swap_byte_pairs == 1 )
+		{
+			if( storage_media_buffer_get_data(
+			     storage_media_buffer,
+			     &data,
+			     &data_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine storage media buffer data.",
+				 function );
+
+				goto on_error;
+			}
+			if( export_handle_swap_byte_pairs(
+			     export_handle,
+			     data,
+			     storage_media_buffer->processed_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_GENERIC,
+				 "%s: unable to swap byte pairs.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		write_count = export_handle_write_storage_media_buffer_at_offset(
+		               export_handle,
+		               storage_media_buffer,
+		               &error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libcthreads_thread_pool_push(
 	     export_handle->output_thread_pool,
 	     (intptr_t *) storage_media_buffer,
@@ -4568,14 +4993,13 @@ int export_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      export_handle_t *export_handle )
 {
-	libcdata_list_element_t *element                    = NULL;
-	libcdata_list_element_t *next_element               = NULL;
         libcerror_error_t *error                            = NULL;
 	storage_media_buffer_t *output_storage_media_buffer = NULL;
 	uint8_t *data                                       = NULL;
         static char *function                               = "export_handle_process_storage_media_buffer_callback";
 	size_t data_size                                    = 0;
 	ssize_t write_count                                 = 0;
+	int result                                          = 0;
 
 	if( export_handle == NULL )
 	{
@@ -4599,68 +5023,41 @@ int export_handle_output_storage_media_buffer_callback(
 
 		goto on_error;
 	}
-	if( libcdata_list_insert_value(
-	     export_handle->output_list,
-	     (intptr_t *) storage_media_buffer,
-	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &storage_media_buffer_compare,
-	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	if( storage_media_buffer_ring_insert_buffer(
+	     export_handle->output_ring,
+	     storage_media_buffer,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert storage media buffer into output list.",
+		 "%s: unable to insert storage media buffer into output ring.",
 		 function );
 
 		goto on_error;
 	}
 	storage_media_buffer = NULL;
 
-	if( libcdata_list_get_first_element(
-	     export_handle->output_list,
-	     &element,
-	     &error ) != 1 )
+	while( 1 )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
-		 function );
+		result = storage_media_buffer_ring_remove_next_buffer(
+		          export_handle->output_ring,
+		          &storage_media_buffer,
+		          &error );
 
-		goto on_error;
-	}
-	while( element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     &error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove next storage media buffer from output ring.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
-		if( storage_media_buffer == NULL )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
-
-			return( -1 );
-		}
-		if( storage_media_buffer->storage_media_offset != export_handle->last_offset_hashed )
+		else if( result == 0 )
 		{
 			break;
 		}
@@ -4677,13 +5074,12 @@ int export_handle_output_storage_media_buffer_callback(
 			 "%s: unable to determine storage media buffer data.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
-		/* Swap byte pairs
+		/* Swap byte pairs, with positional write this was done by the process thread
 		 */
-		if( export_handle->swap_byte_pairs == 1 )
+		if( ( export_handle->swap_byte_pairs == 1 )
+		 && ( export_handle->use_positional_write == 0 ) )
 		{
 			if( export_handle_swap_byte_pairs(
 			     export_handle,
@@ -4698,8 +5094,6 @@ int export_handle_output_storage_media_buffer_callback(
 				 "%s: unable to swap byte pairs.",
 				 function );
 
-				storage_media_buffer = NULL;
-
 				goto on_error;
 			}
 		}
@@ -4718,101 +5112,50 @@ int export_handle_output_storage_media_buffer_callback(
 			 "%s: unable to update integrity hash(es).",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
 		export_handle->last_offset_hashed = storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size;
 
-		if( export_handle->use_chunk_data_functions != 0 )
+		if( export_handle->use_positional_write == 0 )
 		{
-			if( storage_media_buffer_initialize(
-			     &output_storage_media_buffer,
-			     export_handle->ewf_output_handle,
-			     STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA,
-			     export_handle->output_chunk_size,
-			     &error ) != 1 )
+			if( export_handle->use_chunk_data_functions != 0 )
+			{
+				if( storage_media_buffer_initialize(
+				     &output_storage_media_buffer,
+				     export_handle->ewf_output_handle,
+				     STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA,
+				     export_handle->output_chunk_size,
+				     &error ) != 1 )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create output storage media buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			write_count = export_handle_write(
+				       export_handle,
+				       storage_media_buffer,
+				       output_storage_media_buffer,
+				       storage_media_buffer->processed_size,
+				       &error );
+
+			if( write_count < 0 )
 			{
 				libcerror_error_set(
 				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create output storage media buffer.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write to export handle.",
 				 function );
 
-				storage_media_buffer = NULL;
-
 				goto on_error;
 			}
 		}
-		write_count = export_handle_write(
-			       export_handle,
-			       storage_media_buffer,
-			       output_storage_media_buffer,
-			       storage_media_buffer->processed_size,
-			       &error );
-
-		if( write_count < 0 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to export handle.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( libcdata_list_remove_element(
-		     export_handle->output_list,
-		     element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
-			goto on_error;
-		}
 /* TODO: if storage media buffer can be passed on do not release it */
 		if( storage_media_buffer_queue_release_buffer(
 		     export_handle->storage_media_buffer_queue,
@@ -4847,8 +5190,6 @@ int export_handle_output_storage_media_buffer_callback(
 				goto on_error;
 			}
 		}
-		element = next_element;
-
 		if( process_status_update(
 		     export_handle->process_status,
 		     export_handle->last_offset_hashed,
@@ -4909,17 +5250,16 @@ on_error:
 	return( -1 );
 }
 
-/* Empties the output list
+/* Empties the output ring
  * Returns 1 if successful or -1 on error
  */
-int export_handle_empty_output_list(
+int export_handle_empty_output_ring(
      export_handle_t *export_handle,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *element             = NULL;
-	libcdata_list_element_t *next_element        = NULL;
 	storage_media_buffer_t *storage_media_buffer = NULL;
-        static char *function                        = "export_handle_empty_output_list";
+        static char *function                        = "export_handle_empty_output_ring";
+	int result                                   = 1;
 
 	if( export_handle == NULL )
 	{
@@ -4932,114 +5272,128 @@ int export_handle_empty_output_list(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     export_handle->output_list,
-	     &element,
-	     error ) != 1 )
+	while( result == 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
-		 function );
+		result = storage_media_buffer_ring_remove_buffer(
+		          export_handle->output_ring,
+		          &storage_media_buffer,
+		          error );
 
-		return( -1 );
-	}
-	while( element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove storage media buffer from output ring.",
 			 function );
 
 			return( -1 );
 		}
-		if( storage_media_buffer == NULL )
+		else if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
+			if( storage_media_buffer_queue_release_buffer(
+			     export_handle->storage_media_buffer_queue,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to release storage media buffer onto queue.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
+			storage_media_buffer = NULL;
 		}
-		if( storage_media_buffer_queue_release_buffer(
-		     export_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to release storage media buffer onto queue.",
-			 function );
+	}
+	return( 1 );
+}
 
-			return( -1 );
-		}
-		storage_media_buffer = NULL;
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
+/* Determines if the packed chunk data of the input can be copied to the output
+ * This requires the packed chunk data to be requested and an EWF output of the
+ * entire input with the same chunk size and compression values
+ * Returns 1 if the packed chunk data can be copied, 0 if not or -1 on error
+ */
+int export_handle_check_copy_packed_chunk_data(
+     export_handle_t *export_handle,
+     uint8_t swap_byte_pairs,
+     libcerror_error_t **error )
+{
+	static char *function             = "export_handle_check_copy_packed_chunk_data";
+	uint16_t input_compression_method = 0;
+	uint8_t input_compression_flags   = 0;
+	int8_t input_compression_level    = 0;
 
-			return( -1 );
-		}
-		if( libcdata_list_remove_element(
-		     export_handle->output_list,
-		     element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-			return( -1 );
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
+		return( -1 );
+	}
+	if( ( export_handle->use_packed_chunk_data == 0 )
+	 || ( export_handle->use_chunk_data_functions == 0 )
+	 || ( export_handle->output_format != EXPORT_HANDLE_OUTPUT_FORMAT_EWF )
+	 || ( swap_byte_pairs != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( export_handle->export_offset != 0 )
+	 || ( export_handle->export_size != (uint64_t) export_handle->input_media_size ) )
+	{
+		return( 0 );
+	}
+	if( export_handle->input_chunk_size != export_handle->output_chunk_size )
+	{
+		return( 0 );
+	}
+	if( libewf_handle_get_compression_method(
+	     export_handle->input_handle,
+	     &input_compression_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression method from input handle.",
+		 function );
 
-			return( -1 );
-		}
-		element = next_element;
+		return( -1 );
+	}
+	if( libewf_handle_get_compression_values(
+	     export_handle->input_handle,
+	     &input_compression_level,
+	     &input_compression_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression values from input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_compression_method != export_handle->compression_method )
+	 || ( input_compression_level != export_handle->compression_level )
+	 || ( input_compression_flags != export_handle->compression_flags ) )
+	{
+		return( 0 );
 	}
 	return( 1 );
 }
 
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
-
 /* Exports the input
  * Returns 1 if successful or -1 on error
  */
@@ -5054,16 +5408,23 @@ int export_handle_export_input(
 	storage_media_buffer_t *output_storage_media_buffer = NULL;
 	uint8_t *data                                       = NULL;
 	static char *function                               = "export_handle_export_input";
+	off64_t data_region_end_offset                      = 0;
+	off64_t data_region_offset                          = 0;
 	off64_t input_storage_media_offset                  = 0;
+	size64_t data_region_size                           = 0;
 	size64_t remaining_export_size                      = 0;
+	uint64_t sequence_number                            = 0;
 	size_t process_buffer_size                          = 0;
 	size_t data_size                                    = 0;
 	size_t read_size                                    = 0;
 	ssize_t process_count                               = 0;
 	ssize_t read_count                                  = 0;
 	ssize_t write_count                                 = 0;
+	uint8_t is_sparse                                   = 0;
+	uint8_t seek_input                                  = 0;
 	uint8_t storage_media_buffer_mode                   = 0;
 	int maximum_number_of_queued_items                  = 0;
+	int result                                          = 0;
 	int status                                          = PROCESS_STATUS_COMPLETED;
 
 	if( export_handle == NULL )
@@ -5193,6 +5554,31 @@ int export_handle_export_input(
 		}
 		process_buffer_size       = (size_t) export_handle->input_chunk_size;
 		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+
+		result = export_handle_check_copy_packed_chunk_data(
+		          export_handle,
+		          swap_byte_pairs,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if packed chunk data can be copied.",
+			 function );
+
+			goto on_error;
+		}
+		export_handle->copy_packed_chunk_data = (uint8_t) result;
+
+		/* The packed chunk data is only unpacked to calculate the integrity hash(es)
+		 */
+		if( export_handle->copy_packed_chunk_data != 0 )
+		{
+			storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_PACKED_CHUNK_DATA;
+		}
 	}
 	else
 	{
@@ -5206,6 +5592,17 @@ int export_handle_export_input(
 		}
 		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_BUFFERED;
 	}
+	/* A raw output that consists of a single file is written at the storage media offset
+	 * which allows the process threads to write in any order and to skip data regions that
+	 * are known to be filled with 0-byte values
+	 */
+	if( ( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_RAW )
+	 && ( export_handle->use_stdout == 0 )
+	 && ( ( export_handle->maximum_segment_size == 0 )
+	  || ( export_handle->export_size <= export_handle->maximum_segment_size ) ) )
+	{
+		export_handle->use_positional_write = 1;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 	if( export_handle->number_of_threads != 0 )
 	{
@@ -5247,15 +5644,16 @@ int export_handle_export_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_initialize(
-		     &( export_handle->output_list ),
+		if( storage_media_buffer_ring_initialize(
+		     &( export_handle->output_ring ),
+		     maximum_number_of_queued_items,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create output list.",
+			 "%s: unable to create output ring.",
 			 function );
 
 			goto on_error;
@@ -5277,6 +5675,22 @@ int export_handle_export_input(
 
 			goto on_error;
 		}
+		if( export_handle->use_positional_write != 0 )
+		{
+			if( libcthreads_mutex_initialize(
+			     &( export_handle->output_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize output mutex.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
 #endif
 	export_handle->swap_byte_pairs = swap_byte_pairs;
@@ -5388,12 +5802,102 @@ int export_handle_export_input(
 		{
 			read_size = (size_t) remaining_export_size;
 		}
-		read_count = storage_media_buffer_read_from_handle(
-		              input_storage_media_buffer,
-		              export_handle->input_handle,
-		              read_size,
-		              error );
+		is_sparse = 0;
+
+		if( export_handle->use_positional_write != 0 )
+		{
+			if( input_storage_media_offset >= data_region_end_offset )
+			{
+				result = libewf_handle_get_next_data_region(
+				          export_handle->input_handle,
+				          (off64_t) export_handle->export_offset + input_storage_media_offset,
+				          &data_region_offset,
+				          &data_region_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve next data region.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					data_region_offset = (off64_t) export_handle->export_size;
+					data_region_size   = 0;
+				}
+				else
+				{
+					data_region_offset -= (off64_t) export_handle->export_offset;
+				}
+				data_region_end_offset = data_region_offset + (off64_t) data_region_size;
+			}
+			/* Data in a hole is only skipped if the entire buffer is part of the hole
+			 * or if the read size can be reduced to the size of the hole
+			 */
+			if( input_storage_media_offset < data_region_offset )
+			{
+				if( (size64_t) ( data_region_offset - input_storage_media_offset ) >= (size64_t) read_size )
+				{
+					is_sparse = 1;
+				}
+				else if( storage_media_buffer_mode == STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
+				{
+					read_size = (size_t) ( data_region_offset - input_storage_media_offset );
+					is_sparse = 1;
+				}
+			}
+		}
+		if( is_sparse != 0 )
+		{
+			if( storage_media_buffer_set_sparse(
+			     input_storage_media_buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sparse storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = (ssize_t) read_size;
+			seek_input = 1;
+		}
+		else
+		{
+			if( seek_input != 0 )
+			{
+				if( export_handle_seek_offset(
+				     export_handle,
+				     (off64_t) export_handle->export_offset + input_storage_media_offset,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek offset.",
+					 function );
 
+					goto on_error;
+				}
+				seek_input = 0;
+			}
+			read_count = storage_media_buffer_read_from_handle(
+			              input_storage_media_buffer,
+			              export_handle->input_handle,
+			              read_size,
+			              error );
+		}
 		if( read_count < 0 )
 		{
 			libcerror_error_set(
@@ -5424,6 +5928,10 @@ int export_handle_export_input(
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( export_handle->number_of_threads != 0 )
 		{
+			input_storage_media_buffer->sequence_number = sequence_number;
+
+			sequence_number++;
+
 			if( libcthreads_thread_pool_push(
 			     export_handle->input_process_thread_pool,
 			     (intptr_t *) input_storage_media_buffer,
@@ -5532,33 +6040,42 @@ int export_handle_export_input(
 			}
 			export_handle->last_offset_hashed += input_storage_media_buffer->processed_size;
 
-			if( ( export_handle->use_chunk_data_functions != 0 )
-			 && ( output_storage_media_buffer == NULL ) )
+			if( export_handle->use_positional_write != 0 )
 			{
-				if( storage_media_buffer_initialize(
-				     &output_storage_media_buffer,
-				     export_handle->ewf_output_handle,
-				     STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA,
-				     export_handle->output_chunk_size,
-				     error ) != 1 )
+				write_count = export_handle_write_storage_media_buffer_at_offset(
+				               export_handle,
+				               input_storage_media_buffer,
+				               error );
+			}
+			else
+			{
+				if( ( export_handle->use_chunk_data_functions != 0 )
+				 && ( output_storage_media_buffer == NULL ) )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create output storage media buffer.",
-					 function );
+					if( storage_media_buffer_initialize(
+					     &output_storage_media_buffer,
+					     export_handle->ewf_output_handle,
+					     STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA,
+					     export_handle->output_chunk_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create output storage media buffer.",
+						 function );
 
-					goto on_error;
+						goto on_error;
+					}
 				}
+				write_count = export_handle_write(
+				               export_handle,
+				               input_storage_media_buffer,
+				               output_storage_media_buffer,
+				               input_storage_media_buffer->processed_size,
+				               error );
 			}
-			write_count = export_handle_write(
-			               export_handle,
-			               input_storage_media_buffer,
-			               output_storage_media_buffer,
-			               input_storage_media_buffer->processed_size,
-			               error );
-
 			if( write_count < 0 )
 			{
 				libcerror_error_set(
@@ -5652,9 +6169,9 @@ int export_handle_export_input(
 			goto on_error;
 		}
 	}
-	if( export_handle->output_list != NULL )
+	if( export_handle->output_ring != NULL )
 	{
-		if( export_handle_empty_output_list(
+		if( export_handle_empty_output_ring(
 		     export_handle,
 		     error ) != 1 )
 		{
@@ -5662,21 +6179,20 @@ int export_handle_export_input(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty output list.",
+			 "%s: unable to empty output ring.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcdata_list_free(
-		     &( export_handle->output_list ),
-		     NULL,
+		if( storage_media_buffer_ring_free(
+		     &( export_handle->output_ring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
+			 "%s: unable to free output ring.",
 			 function );
 
 			goto on_error;
@@ -5695,6 +6211,21 @@ int export_handle_export_input(
 			 "%s: unable to free storage media buffer queue.",
 			 function );
 
+			goto on_error;
+		}
+	}	if( export_handle->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( export_handle->output_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output mutex.",
+			 function );
+
 			goto on_error;
 		}
 	}
@@ -5861,14 +6392,13 @@ on_error:
 		 &( export_handle->output_thread_pool ),
 		 NULL );
 	}
-	if( export_handle->output_list != NULL )
+	if( export_handle->output_ring != NULL )
 	{
-		export_handle_empty_output_list(
+		export_handle_empty_output_ring(
 		 export_handle,
 		 NULL );
-		libcdata_list_free(
-		 &( export_handle->output_list ),
-		 NULL,
+		storage_media_buffer_ring_free(
+		 &( export_handle->output_ring ),
 		 NULL );
 	}
 	if( export_handle->storage_media_buffer_queue != NULL )
@@ -5877,6 +6407,12 @@ on_error:
 		 &( export_handle->storage_media_buffer_queue ),
 		 NULL );
 	}
+	if( export_handle->output_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( export_handle->output_mutex ),
+		 NULL );
+	}
 #endif
 	return( -1 );
 }
@@ -5892,9 +6428,13 @@ int export_handle_export_single_files(
      libcerror_error_t **error )
 {
 	libewf_file_entry_t *file_entry    = NULL;
+	system_character_t *name           = NULL;
+	system_character_t *root_path      = NULL;
 	system_character_t *sanitized_name = NULL;
 	static char *function              = "export_handle_export_single_files";
 	size_t export_path_length          = 0;
+	size_t name_size                   = 0;
+	size_t root_path_size              = 0;
 	size_t sanitized_name_size         = 0;
 	int result                         = 0;
 	int status                         = PROCESS_STATUS_COMPLETED;
@@ -6021,6 +6561,25 @@ int export_handle_export_single_files(
 	 "Created directory: %" PRIs_SYSTEM ".\n",
 	 sanitized_name );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads != 0 )
+	{
+		if( libcdata_array_initialize(
+		     &( export_handle->single_file_jobs ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create single file jobs array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 	result = export_handle_export_file_entry(
 	          export_handle,
 	          file_entry,
@@ -6041,8 +6600,125 @@ int export_handle_export_single_files(
 
 		goto on_error;
 	}
-	memory_free(
-	 sanitized_name );
+	/* The root file entry name is used as the top level directory
+	 */
+	result = export_handle_get_file_entry_name(
+	          file_entry,
+	          &name,
+	          &name_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root file entry name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( export_handle_join_sanitized_name(
+		     sanitized_name,
+		     sanitized_name_size,
+		     name,
+		     name_size - 1,
+		     &root_path,
+		     &root_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create root path.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 name );
+
+		name = NULL;
+	}
+	if( root_path != NULL )
+	{
+		result = export_handle_export_single_files_in_media_order(
+		          export_handle,
+		          root_path,
+		          root_path_size,
+		          sanitized_name_size - 1,
+		          log_handle,
+		          error );
+	}
+	else
+	{
+		result = export_handle_export_single_files_in_media_order(
+		          export_handle,
+		          sanitized_name,
+		          sanitized_name_size,
+		          sanitized_name_size - 1,
+		          log_handle,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export single files in media order.",
+		 function );
+
+		goto on_error;
+	}
+	if( root_path != NULL )
+	{
+		memory_free(
+		 root_path );
+
+		root_path = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->single_file_jobs != NULL )
+	{
+		result = export_handle_export_single_file_jobs(
+		          export_handle,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export single file jobs.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_free(
+		     &( export_handle->single_file_jobs ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &single_file_job_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free single file jobs array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	memory_free(
+	 sanitized_name );
 
 	sanitized_name = NULL;
 
@@ -6105,12 +6781,31 @@ on_error:
 		 &( export_handle->process_status ),
 		 NULL );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->single_file_jobs != NULL )
+	{
+		libcdata_array_free(
+		 &( export_handle->single_file_jobs ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &single_file_job_free,
+		 NULL );
+	}
+#endif
 	if( file_entry != NULL )
 	{
 		libewf_file_entry_free(
 		 &file_entry,
 		 NULL );
 	}
+	if( root_path != NULL )
+	{
+		memory_free(
+		 root_path );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
 	if( sanitized_name != NULL )
 	{
 		memory_free(
@@ -6119,74 +6814,94 @@ on_error:
 	return( -1 );
 }
 
-/* Exports a (single) file entry
- * Returns 1 if successful, 0 if not or -1 on error
+/* Retrieves the name of a (single) file entry as a system string
+ * The name is returned in an allocated buffer that should be freed by the caller
+ * Returns 1 if successful, 0 if the file entry has no name or -1 on error
  */
-int export_handle_export_file_entry(
-     export_handle_t *export_handle,
+int export_handle_get_file_entry_name(
      libewf_file_entry_t *file_entry,
-     const system_character_t *export_path,
-     size_t export_path_size,
-     size_t file_entry_path_index,
-     log_handle_t *log_handle,
+     system_character_t **name,
+     size_t *name_size,
      libcerror_error_t **error )
 {
-	system_character_t *name           = NULL;
-	system_character_t *sanitized_name = NULL;
-	system_character_t *target_path    = NULL;
-	static char *function              = "export_handle_export_file_entry";
-	size_t name_size                   = 0;
-	size_t sanitized_name_size         = 0;
-	size_t target_path_size            = 0;
-	uint8_t file_entry_type            = 0;
-	int result                         = 0;
-	int return_value                   = 0;
+	system_character_t *safe_name = NULL;
+	static char *function         = "export_handle_get_file_entry_name";
+	size_t safe_name_size         = 0;
+	int result                    = 0;
 
-	if( export_handle == NULL )
+	if( name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 "%s: invalid name.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_entry == NULL )
+	if( name_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid name size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libewf_file_entry_get_type(
-	     file_entry,
-	     &file_entry_type,
-	     error ) != 1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &safe_name_size,
+	          error );
+#else
+	result = libewf_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &safe_name_size,
+	          error );
+#endif
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry type.",
+		 "%s: unable to retrieve the name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_name_size <= 1 )
+	{
+		return( 0 );
+	}
+	safe_name = system_string_allocate(
+	             safe_name_size );
+
+	if( safe_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
 		 function );
 
 		goto on_error;
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libewf_file_entry_get_utf16_name_size(
+	result = libewf_file_entry_get_utf16_name(
 	          file_entry,
-	          &name_size,
+	          (uint16_t *) safe_name,
+	          safe_name_size,
 	          error );
 #else
-	result = libewf_file_entry_get_utf8_name_size(
+	result = libewf_file_entry_get_utf8_name(
 	          file_entry,
-	          &name_size,
+	          (uint8_t *) safe_name,
+	          safe_name_size,
 	          error );
 #endif
 	if( result != 1 )
@@ -6200,243 +6915,1368 @@ int export_handle_export_file_entry(
 
 		goto on_error;
 	}
-	if( name_size > 1 )
+	*name      = safe_name;
+	*name_size = safe_name_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_name != NULL )
 	{
-		name = system_string_allocate(
-		        name_size );
+		memory_free(
+		 safe_name );
+	}
+	return( -1 );
+}
 
-		if( name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create name.",
-			 function );
+/* Joins a path with a sanitized version of a name
+ * The target path is returned in an allocated buffer that should be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_join_sanitized_name(
+     const system_character_t *path,
+     size_t path_size,
+     const system_character_t *name,
+     size_t name_length,
+     system_character_t **target_path,
+     size_t *target_path_size,
+     libcerror_error_t **error )
+{
+	system_character_t *sanitized_name = NULL;
+	static char *function              = "export_handle_join_sanitized_name";
+	size_t sanitized_name_size         = 0;
 
-			goto on_error;
-		}
+	if( path_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid path size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libewf_file_entry_get_utf16_name(
-		          file_entry,
-		          (uint16_t *) name,
-		          name_size,
-		          error );
+	if( libcpath_path_get_sanitized_filename_wide(
+	     name,
+	     name_length,
+	     &sanitized_name,
+	     &sanitized_name_size,
+	     error ) != 1 )
 #else
-		result = libewf_file_entry_get_utf8_name(
-		          file_entry,
-		          (uint8_t *) name,
-		          name_size,
-		          error );
+	if( libcpath_path_get_sanitized_filename(
+	     name,
+	     name_length,
+	     &sanitized_name,
+	     &sanitized_name_size,
+	     error ) != 1 )
 #endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the name.",
-			 function );
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable sanitize name.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libcpath_path_get_sanitized_filename_wide(
-		     name,
-		     name_size - 1,
-		     &sanitized_name,
-		     &sanitized_name_size,
-		     error ) != 1 )
+	if( libcpath_path_join_wide(
+	     target_path,
+	     target_path_size,
+	     path,
+	     path_size - 1,
+	     sanitized_name,
+	     sanitized_name_size - 1,
+	     error ) != 1 )
 #else
-		if( libcpath_path_get_sanitized_filename(
-		     name,
-		     name_size - 1,
-		     &sanitized_name,
-		     &sanitized_name_size,
-		     error ) != 1 )
+	if( libcpath_path_join(
+	     target_path,
+	     target_path_size,
+	     path,
+	     path_size - 1,
+	     sanitized_name,
+	     sanitized_name_size - 1,
+	     error ) != 1 )
 #endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable sanitize name.",
-			 function );
-
-			goto on_error;
-		}
-		memory_free(
-		 name );
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create target path.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 sanitized_name );
+
+	return( 1 );
+
+on_error:
+	if( sanitized_name != NULL )
+	{
+		memory_free(
+		 sanitized_name );
+	}
+	return( -1 );
+}
+
+/* Retrieves the target path of a (single) file entry
+ * The target path is created from the path of the file entry, where every path segment is sanitized
+ * The target path is returned in an allocated buffer that should be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_file_entry_target_path(
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     system_character_t **target_path,
+     size_t *target_path_size,
+     libcerror_error_t **error )
+{
+	system_character_t *path           = NULL;
+	system_character_t *safe_path      = NULL;
+	system_character_t *segment_path   = NULL;
+	system_character_t *string_segment = NULL;
+	static char *function              = "export_handle_get_file_entry_target_path";
+	size_t path_size                   = 0;
+	size_t safe_path_size              = 0;
+	size_t segment_path_size           = 0;
+	size_t string_segment_size         = 0;
+	int number_of_segments             = 0;
+	int result                         = 0;
+	int segment_index                  = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	libcsplit_wide_split_string_t *path_segments   = NULL;
+#else
+	libcsplit_narrow_split_string_t *path_segments = NULL;
+#endif
+
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_path_size(
+	          file_entry,
+	          &path_size,
+	          error );
+#else
+	result = libewf_file_entry_get_utf8_path_size(
+	          file_entry,
+	          &path_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the path size.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_size <= 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	path = system_string_allocate(
+	        path_size );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_path(
+	          file_entry,
+	          (uint16_t *) path,
+	          path_size,
+	          error );
+#else
+	result = libewf_file_entry_get_utf8_path(
+	          file_entry,
+	          (uint8_t *) path,
+	          path_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcsplit_wide_string_split(
+	     path,
+	     path_size,
+	     (wchar_t) LIBEWF_SEPARATOR,
+	     &path_segments,
+	     error ) != 1 )
+#else
+	if( libcsplit_narrow_string_split(
+	     path,
+	     path_size,
+	     (char) LIBEWF_SEPARATOR,
+	     &path_segments,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcsplit_wide_split_string_get_number_of_segments(
+	     path_segments,
+	     &number_of_segments,
+	     error ) != 1 )
+#else
+	if( libcsplit_narrow_split_string_get_number_of_segments(
+	     path_segments,
+	     &number_of_segments,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of path segments.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libcsplit_wide_split_string_get_segment_by_index(
+		     path_segments,
+		     segment_index,
+		     &string_segment,
+		     &string_segment_size,
+		     error ) != 1 )
+#else
+		if( libcsplit_narrow_split_string_get_segment_by_index(
+		     path_segments,
+		     segment_index,
+		     &string_segment,
+		     &string_segment_size,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		/* Ignore the empty segment before the leading separator
+		 */
+		if( ( string_segment == NULL )
+		 || ( string_segment_size <= 1 ) )
+		{
+			continue;
+		}
+		if( safe_path == NULL )
+		{
+			result = export_handle_join_sanitized_name(
+			          export_path,
+			          export_path_size,
+			          string_segment,
+			          string_segment_size - 1,
+			          &segment_path,
+			          &segment_path_size,
+			          error );
+		}
+		else
+		{
+			result = export_handle_join_sanitized_name(
+			          safe_path,
+			          safe_path_size,
+			          string_segment,
+			          string_segment_size - 1,
+			          &segment_path,
+			          &segment_path_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to join path segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( safe_path != NULL )
+		{
+			memory_free(
+			 safe_path );
+		}
+		safe_path         = segment_path;
+		safe_path_size    = segment_path_size;
+		segment_path      = NULL;
+		segment_path_size = 0;
+	}
+	if( safe_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path - missing path segments.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcsplit_wide_split_string_free(
+	     &path_segments,
+	     error ) != 1 )
+#else
+	if( libcsplit_narrow_split_string_free(
+	     &path_segments,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free path segments.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	*target_path      = safe_path;
+	*target_path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( path_segments != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		libcsplit_wide_split_string_free(
+		 &path_segments,
+		 NULL );
+#else
+		libcsplit_narrow_split_string_free(
+		 &path_segments,
+		 NULL );
+#endif
+	}
+	if( safe_path != NULL )
+	{
+		memory_free(
+		 safe_path );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Exports the (single) file entries of type file in media order
+ * Files of a logical evidence file are stored in media order, exporting them in this order
+ * keeps the reads of the input sequential instead of seeking back and forth in tree order
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_single_files_in_media_order(
+     export_handle_t *export_handle,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     size_t file_entry_path_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *file_entry    = NULL;
+	system_character_t *target_path    = NULL;
+	static char *function              = "export_handle_export_single_files_in_media_order";
+	size_t target_path_size            = 0;
+	int file_entry_index               = 0;
+	int number_of_file_entries         = 0;
+	int result                         = 0;
+	int return_value                   = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	single_file_job_t *single_file_job = NULL;
+	int entry_index                    = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_number_of_file_entries_in_media_order(
+	     export_handle->input_handle,
+	     &number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries in media order.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_entry_index = 0;
+	     file_entry_index < number_of_file_entries;
+	     file_entry_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libewf_handle_get_file_entry_in_media_order(
+		     export_handle->input_handle,
+		     file_entry_index,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d in media order.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+		if( export_handle_get_file_entry_target_path(
+		     file_entry,
+		     export_path,
+		     export_path_size,
+		     &target_path,
+		     &target_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve target path of file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_exists_wide(
+			  target_path,
+			  error );
+#else
+		result = libcfile_file_exists(
+			  target_path,
+			  error );
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+			 function,
+			 target_path );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Skipping file entry it already exists.\n" );
+		}
+		else
+		{
+			if( file_entry_path_index >= target_path_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: file entry path index value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			/* TODO what about NTFS streams ?
+			 */
+			fprintf(
+			 export_handle->notify_stream,
+			 "Single file: %" PRIs_SYSTEM "\n",
+			 &( target_path[ file_entry_path_index ] ) );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			/* When exporting with multiple threads the data is exported
+			 * after all the file entries have been scheduled
+			 */
+			if( export_handle->single_file_jobs != NULL )
+			{
+				if( single_file_job_initialize(
+				     &single_file_job,
+				     file_entry,
+				     file_entry_index,
+				     target_path,
+				     target_path_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create single file job.",
+					 function );
+
+					goto on_error;
+				}
+				if( libcdata_array_append_entry(
+				     export_handle->single_file_jobs,
+				     &entry_index,
+				     (intptr_t *) single_file_job,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append single file job to array.",
+					 function );
+
+					goto on_error;
+				}
+				single_file_job = NULL;
+			}
+			else
+#endif
+			{
+				result = export_handle_export_file_entry_data(
+				          export_handle,
+				          file_entry,
+				          target_path,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to export file entry data.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					fprintf(
+					 export_handle->notify_stream,
+					 "FAILED\n" );
+
+					if( log_handle != NULL )
+					{
+						log_handle_printf(
+						 log_handle,
+						 "FAILED\n" );
+					}
+					return_value = 0;
+				}
+			}
+		}
+		memory_free(
+		 target_path );
+
+		target_path = NULL;
+
+		if( libewf_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+	}
+	return( return_value );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( single_file_job != NULL )
+	{
+		single_file_job_free(
+		 &single_file_job,
+		 NULL );
+	}
+#endif
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a (single) file entry
+ * Only the directories are created, the file entries of type file are exported in media order
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_file_entry(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     size_t file_entry_path_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *name           = NULL;
+	system_character_t *sanitized_name = NULL;
+	system_character_t *target_path    = NULL;
+	static char *function              = "export_handle_export_file_entry";
+	size_t name_size                   = 0;
+	size_t sanitized_name_size         = 0;
+	size_t target_path_size            = 0;
+	uint8_t file_entry_type            = 0;
+	int result                         = 0;
+	int return_value                   = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_file_entry_get_type(
+	     file_entry,
+	     &file_entry_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry type.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data of file entries of type file is exported in media order
+	 * by export_handle_export_single_files_in_media_order
+	 */
+	if( file_entry_type != LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#else
+	result = libewf_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the name.",
+		 function );
+
+		goto on_error;
+	}
+	if( name_size > 1 )
+	{
+		name = system_string_allocate(
+		        name_size );
+
+		if( name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libewf_file_entry_get_utf16_name(
+		          file_entry,
+		          (uint16_t *) name,
+		          name_size,
+		          error );
+#else
+		result = libewf_file_entry_get_utf8_name(
+		          file_entry,
+		          (uint8_t *) name,
+		          name_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the name.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libcpath_path_get_sanitized_filename_wide(
+		     name,
+		     name_size - 1,
+		     &sanitized_name,
+		     &sanitized_name_size,
+		     error ) != 1 )
+#else
+		if( libcpath_path_get_sanitized_filename(
+		     name,
+		     name_size - 1,
+		     &sanitized_name,
+		     &sanitized_name_size,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable sanitize name.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 name );
 
 		name = NULL;
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libcpath_path_join_wide(
-		     &target_path,
-		     &target_path_size,
-		     export_path,
-		     export_path_size - 1,
-		     sanitized_name,
-		     sanitized_name_size - 1,
-		     error ) != 1 )
+		if( libcpath_path_join_wide(
+		     &target_path,
+		     &target_path_size,
+		     export_path,
+		     export_path_size - 1,
+		     sanitized_name,
+		     sanitized_name_size - 1,
+		     error ) != 1 )
+#else
+		if( libcpath_path_join(
+		     &target_path,
+		     &target_path_size,
+		     export_path,
+		     export_path_size - 1,
+		     sanitized_name,
+		     sanitized_name_size - 1,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create target path.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 sanitized_name );
+
+		sanitized_name = NULL;
+
+		if( target_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid target path.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_exists_wide(
+			  target_path,
+			  error );
+#else
+		result = libcfile_file_exists(
+			  target_path,
+			  error );
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+			 function,
+			 target_path );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Skipping file entry it already exists.\n" );
+		}
+		else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			if( libcpath_path_make_directory_wide(
+			     target_path,
+			     error ) != 1 )
+#else
+			if( libcpath_path_make_directory(
+			     target_path,
+			     error ) != 1 )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to create directory: %" PRIs_SYSTEM "",
+				 function,
+				 target_path );
+
+				goto on_error;
+			}
+			log_handle_printf(
+			 log_handle,
+			 "Created directory: %" PRIs_SYSTEM ".\n",
+			 target_path );
+		}
+	}
+	else
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping file entry without a name.\n" );
+
+		target_path      = (system_character_t *) export_path;
+		target_path_size = export_path_size;
+	}
+	if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
+	{
+		result = export_handle_export_file_entry_sub_file_entries(
+		          export_handle,
+		          file_entry,
+		          target_path,
+		          target_path_size,
+		          file_entry_path_index,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export sub file entries.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return_value = 0;
+		}
+	}
+	if( target_path != export_path )
+	{
+		memory_free(
+		 target_path );
+	}
+	return( return_value );
+
+on_error:
+	if( ( target_path != NULL )
+	 && ( target_path != export_path ) )
+	{
+		memory_free(
+		 target_path );
+	}
+	if( sanitized_name != NULL )
+	{
+		memory_free(
+		 sanitized_name );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	return( -1 );
+}
+
+/* Exports the data of a (single) file entry
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_file_entry_data(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file         = NULL;
+	uint8_t *file_entry_data      = NULL;
+	static char *function         = "export_handle_export_file_entry_data";
+	size64_t file_entry_data_size = 0;
+	size_t process_buffer_size    = EXPORT_HANDLE_BUFFER_SIZE;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	ssize_t write_count           = 0;
+	int result                    = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing input chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_chunk_size > (size32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid export handle - process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     export_path,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
 #else
-		if( libcpath_path_join(
-		     &target_path,
-		     &target_path_size,
-		     export_path,
-		     export_path_size - 1,
-		     sanitized_name,
-		     sanitized_name_size - 1,
-		     error ) != 1 )
+	if( libcfile_file_open(
+	     file,
+	     export_path,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
 #endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 export_path );
+
+		goto on_error;
+	}
+	/* Export the file entry data
+	 */
+	if( libewf_file_entry_get_size(
+	     file_entry,
+	     &file_entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* If there is no file entry data an empty file is written
+	 */
+	if( file_entry_data_size > 0 )
+	{
+		if( export_handle->process_buffer_size == 0 )
+		{
+			process_buffer_size = export_handle->input_chunk_size;
+		}
+		else
+		{
+			process_buffer_size = export_handle->process_buffer_size;
+		}
+		/* This function in not necessary for normal use
+		 * but it was added for testing
+		 */
+		if( libewf_file_entry_seek_offset(
+		     file_entry,
+		     0,
+		     SEEK_SET,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create target path.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to seek the start of the file entry data.",
 			 function );
 
 			goto on_error;
 		}
-		memory_free(
-		 sanitized_name );
-
-		sanitized_name = NULL;
+		file_entry_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * process_buffer_size );
 
-		if( target_path == NULL )
+		if( file_entry_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid target path.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file entry data.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_exists_wide(
-			  target_path,
-			  error );
-#else
-		result = libcfile_file_exists(
-			  target_path,
-			  error );
-#endif
-		if( result == -1 )
+		while( file_entry_data_size > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
-			 function,
-			 target_path );
+			if( file_entry_data_size >= EXPORT_HANDLE_BUFFER_SIZE )
+			{
+				read_size = EXPORT_HANDLE_BUFFER_SIZE;
+			}
+			else
+			{
+				read_size = (size_t) file_entry_data_size;
+			}
+			read_count = libewf_file_entry_read_buffer(
+			              file_entry,
+			              file_entry_data,
+			              read_size,
+			              error );
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			log_handle_printf(
-			 log_handle,
-			 "Skipping file entry it already exists.\n" );
-		}
-		else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_FILE )
-		{
-			if( file_entry_path_index >= target_path_size )
+			if( read_count == (ssize_t) -1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: file entry path index value out of bounds.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file entry data.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-			/* TODO what about NTFS streams ?
-			 */
-			fprintf(
-			 export_handle->notify_stream,
-			 "Single file: %" PRIs_SYSTEM "\n",
-			 &( target_path[ file_entry_path_index ] ) );
+			else if( read_count != (ssize_t) read_size )
+			{
+				result = 0;
+
+				break;
+			}
+			file_entry_data_size -= read_size;
 
-			return_value = export_handle_export_file_entry_data(
-				        export_handle,
-			                file_entry,
-			                target_path,
-			                error );
+			write_count = libcfile_file_write_buffer(
+			               file,
+			               file_entry_data,
+			               read_size,
+			               error );
 
-			if( return_value == -1 )
+			if( write_count != (ssize_t) read_size )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to export file entry data.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write file entry data.",
 				 function );
 
 				goto on_error;
 			}
-			if( return_value == 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "FAILED\n" );
+		}
+		memory_free(
+		 file_entry_data );
+
+		file_entry_data = NULL;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_entry_data != NULL )
+	{
+		memory_free(
+		 file_entry_data );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a (single) file entry sub file entries
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_file_entry_sub_file_entries(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     size_t file_entry_path_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *sub_file_entry = NULL;
+	static char *function               = "export_handle_export_file_entry_sub_file_entries";
+	int number_of_sub_file_entries      = 0;
+	int result                          = 0;
+	int return_value                    = 1;
+	int sub_file_entry_index            = 0;
 
-				if( log_handle != NULL )
-				{
-					log_handle_printf(
-					 log_handle,
-					 "FAILED\n" );
-				}
-			}
-		}
-		else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
-		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			if( libcpath_path_make_directory_wide(
-			     target_path,
-			     error ) != 1 )
-#else
-			if( libcpath_path_make_directory(
-			     target_path,
-			     error ) != 1 )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to create directory: %" PRIs_SYSTEM "",
-				 function,
-				 target_path );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-				goto on_error;
-			}
-			log_handle_printf(
-			 log_handle,
-			 "Created directory: %" PRIs_SYSTEM ".\n",
-			 target_path );
-		}
+		return( -1 );
 	}
-	else
+	if( libewf_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping file entry without a name.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
 
-		target_path      = (system_character_t *) export_path;
-		target_path_size = export_path_size;
+		goto on_error;
 	}
-	if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
 	{
-		result = export_handle_export_file_entry_sub_file_entries(
+		if( libewf_file_entry_get_sub_file_entry(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to free retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		result = export_handle_export_file_entry(
 		          export_handle,
-		          file_entry,
-		          target_path,
-		          target_path_size,
+		          sub_file_entry,
+		          export_path,
+		          export_path_size,
 		          file_entry_path_index,
 		          log_handle,
 		          error );
@@ -6447,8 +8287,9 @@ int export_handle_export_file_entry(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export sub file entries.",
-			 function );
+			 "%s: unable to export sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
 
 			goto on_error;
 		}
@@ -6456,52 +8297,53 @@ int export_handle_export_file_entry(
 		{
 			return_value = 0;
 		}
-	}
-	if( target_path != export_path )
-	{
-		memory_free(
-		 target_path );
+		if( libewf_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
 	}
 	return( return_value );
 
 on_error:
-	if( ( target_path != NULL )
-	 && ( target_path != export_path ) )
-	{
-		memory_free(
-		 target_path );
-	}
-	if( sanitized_name != NULL )
-	{
-		memory_free(
-		 sanitized_name );
-	}
-	if( name != NULL )
+	if( sub_file_entry != NULL )
 	{
-		memory_free(
-		 name );
+		libewf_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Exports the data of a (single) file entry
+/* Exports the data of a single file job
  * Returns 1 if successful, 0 if not or -1 on error
  */
-int export_handle_export_file_entry_data(
+int export_handle_export_single_file_job_data(
      export_handle_t *export_handle,
-     libewf_file_entry_t *file_entry,
-     const system_character_t *export_path,
+     single_file_job_t *single_file_job,
+     libewf_handle_t *input_handle,
      libcerror_error_t **error )
 {
-	libcfile_file_t *file         = NULL;
-	uint8_t *file_entry_data      = NULL;
-	static char *function         = "export_handle_export_file_entry_data";
-	size64_t file_entry_data_size = 0;
-	size_t process_buffer_size    = EXPORT_HANDLE_BUFFER_SIZE;
-	size_t read_size              = 0;
-	ssize_t read_count            = 0;
-	ssize_t write_count           = 0;
-	int result                    = 1;
+	libcfile_file_t *file           = NULL;
+	libewf_file_entry_t *file_entry = NULL;
+	uint8_t *file_data              = NULL;
+	static char *function           = "export_handle_export_single_file_job_data";
+	size64_t remaining_size         = 0;
+	size_t process_buffer_size      = EXPORT_HANDLE_BUFFER_SIZE;
+	size_t read_size                = 0;
+	ssize_t read_count              = 0;
+	ssize_t write_count             = 0;
+	off64_t file_offset             = 0;
+	int result                      = 1;
 
 	if( export_handle == NULL )
 	{
@@ -6514,49 +8356,57 @@ int export_handle_export_file_entry_data(
 
 		return( -1 );
 	}
-	if( export_handle->input_chunk_size == 0 )
+	if( export_handle->process_buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing input chunk size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid export handle - process buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle->input_chunk_size > (size32_t) INT32_MAX )
+	if( single_file_job == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid input chunk size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file job.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	if( single_file_job->target_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid export handle - process buffer size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid single file job - missing target path.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_path == NULL )
+	/* The file entry is retrieved from the input handle clone so that
+	 * its data is read with the file IO pool of the clone
+	 */
+	if( libewf_handle_get_file_entry_in_media_order(
+	     input_handle,
+	     single_file_job->file_entry_index,
+	     &file_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %d in media order.",
+		 function,
+		 single_file_job->file_entry_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libcfile_file_initialize(
 	     &file,
@@ -6574,13 +8424,13 @@ int export_handle_export_file_entry_data(
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libcfile_file_open_wide(
 	     file,
-	     export_path,
+	     single_file_job->target_path,
 	     LIBCFILE_OPEN_WRITE,
 	     error ) != 1 )
 #else
 	if( libcfile_file_open(
 	     file,
-	     export_path,
+	     single_file_job->target_path,
 	     LIBCFILE_OPEN_WRITE,
 	     error ) != 1 )
 #endif
@@ -6591,84 +8441,59 @@ int export_handle_export_file_entry_data(
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
 		 "%s: unable to open file: %" PRIs_SYSTEM ".",
 		 function,
-		 export_path );
+		 single_file_job->target_path );
 
 		goto on_error;
 	}
-	/* Export the file entry data
-	 */
-	if( libewf_file_entry_get_size(
-	     file_entry,
-	     &file_entry_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry data size.",
-		 function );
+	remaining_size = single_file_job->size;
 
-		goto on_error;
-	}
-	/* If there is no file entry data an empty file is written
+	/* If there is no file data an empty file is written
 	 */
-	if( file_entry_data_size > 0 )
+	if( remaining_size > 0 )
 	{
-		if( export_handle->process_buffer_size == 0 )
-		{
-			process_buffer_size = export_handle->input_chunk_size;
-		}
-		else
+		if( export_handle->process_buffer_size != 0 )
 		{
 			process_buffer_size = export_handle->process_buffer_size;
 		}
-		/* This function in not necessary for normal use
-		 * but it was added for testing
-		 */
-		if( libewf_file_entry_seek_offset(
-		     file_entry,
-		     0,
-		     SEEK_SET,
-		     error ) != 0 )
+		else if( export_handle->input_chunk_size != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to seek the start of the file entry data.",
-			 function );
-
-			goto on_error;
+			process_buffer_size = (size_t) export_handle->input_chunk_size;
 		}
-		file_entry_data = (uint8_t *) memory_allocate(
-		                               sizeof( uint8_t ) * process_buffer_size );
+		file_data = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * process_buffer_size );
 
-		if( file_entry_data == NULL )
+		if( file_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create file entry data.",
+			 "%s: unable to create file data.",
 			 function );
 
 			goto on_error;
 		}
-		while( file_entry_data_size > 0 )
+		while( remaining_size > 0 )
 		{
-			if( file_entry_data_size >= EXPORT_HANDLE_BUFFER_SIZE )
+			if( export_handle->abort != 0 )
 			{
-				read_size = EXPORT_HANDLE_BUFFER_SIZE;
+				result = 0;
+
+				break;
+			}
+			if( remaining_size >= (size64_t) process_buffer_size )
+			{
+				read_size = process_buffer_size;
 			}
 			else
 			{
-				read_size = (size_t) file_entry_data_size;
+				read_size = (size_t) remaining_size;
 			}
-			read_count = libewf_file_entry_read_buffer(
+			read_count = libewf_file_entry_read_buffer_at_offset(
 			              file_entry,
-			              file_entry_data,
+			              file_data,
 			              read_size,
+			              file_offset,
 			              error );
 
 			if( read_count == (ssize_t) -1 )
@@ -6677,7 +8502,7 @@ int export_handle_export_file_entry_data(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file entry data.",
+				 "%s: unable to read file data.",
 				 function );
 
 				goto on_error;
@@ -6688,11 +8513,12 @@ int export_handle_export_file_entry_data(
 
 				break;
 			}
-			file_entry_data_size -= read_size;
+			file_offset    += read_size;
+			remaining_size -= read_size;
 
 			write_count = libcfile_file_write_buffer(
 			               file,
-			               file_entry_data,
+			               file_data,
 			               read_size,
 			               error );
 
@@ -6702,16 +8528,16 @@ int export_handle_export_file_entry_data(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write file entry data.",
+				 "%s: unable to write file data.",
 				 function );
 
 				goto on_error;
 			}
 		}
 		memory_free(
-		 file_entry_data );
+		 file_data );
 
-		file_entry_data = NULL;
+		file_data = NULL;
 	}
 	if( libcfile_file_close(
 	     file,
@@ -6726,15 +8552,28 @@ int export_handle_export_file_entry_data(
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
-	     &file,
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_file_entry_free(
+	     &file_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file.",
+		 "%s: unable to free file entry.",
 		 function );
 
 		goto on_error;
@@ -6742,10 +8581,10 @@ int export_handle_export_file_entry_data(
 	return( result );
 
 on_error:
-	if( file_entry_data != NULL )
+	if( file_data != NULL )
 	{
 		memory_free(
-		 file_entry_data );
+		 file_data );
 	}
 	if( file != NULL )
 	{
@@ -6753,27 +8592,137 @@ on_error:
 		 &file,
 		 NULL );
 	}
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
 	return( -1 );
 }
 
-/* Exports a (single) file entry sub file entries
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Exports the data of a single file job
+ * Callback function for the single file thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_single_file_job_callback(
+     single_file_job_t *single_file_job,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error      = NULL;
+	libewf_handle_t *input_handle = NULL;
+	static char *function         = "export_handle_export_single_file_job_callback";
+
+	if( single_file_job == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file job.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( input_handle_pool_grab_handle(
+	     export_handle->input_handle_pool,
+	     &input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab input handle clone from pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* The result is reported by the thread that pushed the job after the thread pool was joined
+	 */
+	single_file_job->result = export_handle_export_single_file_job_data(
+	                           export_handle,
+	                           single_file_job,
+	                           input_handle,
+	                           &error );
+
+	if( single_file_job->result == -1 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( input_handle_pool_release_handle(
+	     export_handle->input_handle_pool,
+	     input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release input handle clone to pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Exports the single file jobs collected by export_handle_export_file_entry
+ * The jobs are exported by the single file thread pool in media data offset order,
+ * each thread reads using its own clone of the input handle
  * Returns 1 if successful, 0 if not or -1 on error
  */
-int export_handle_export_file_entry_sub_file_entries(
+int export_handle_export_single_file_jobs(
      export_handle_t *export_handle,
-     libewf_file_entry_t *file_entry,
-     const system_character_t *export_path,
-     size_t export_path_size,
-     size_t file_entry_path_index,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libewf_file_entry_t *sub_file_entry = NULL;
-	static char *function               = "export_handle_export_file_entry_sub_file_entries";
-	int number_of_sub_file_entries      = 0;
-	int result                          = 0;
-	int return_value                    = 1;
-	int sub_file_entry_index            = 0;
+	single_file_job_t **single_file_jobs = NULL;
+	static char *function                = "export_handle_export_single_file_jobs";
+	int job_index                        = 0;
+	int number_of_jobs                   = 0;
+	int number_of_threads                = 0;
+	int result                           = 1;
 
 	if( export_handle == NULL )
 	{
@@ -6786,92 +8735,226 @@ int export_handle_export_file_entry_sub_file_entries(
 
 		return( -1 );
 	}
-	if( libewf_file_entry_get_number_of_sub_file_entries(
-	     file_entry,
-	     &number_of_sub_file_entries,
+	if( export_handle->single_file_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - single file thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     export_handle->single_file_jobs,
+	     &number_of_jobs,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
+		 "%s: unable to retrieve number of single file jobs.",
 		 function );
 
 		goto on_error;
 	}
-	for( sub_file_entry_index = 0;
-	     sub_file_entry_index < number_of_sub_file_entries;
-	     sub_file_entry_index++ )
+	if( number_of_jobs == 0 )
 	{
-		if( libewf_file_entry_get_sub_file_entry(
-		     file_entry,
-		     sub_file_entry_index,
-		     &sub_file_entry,
+		return( 1 );
+	}
+	single_file_jobs = (single_file_job_t **) memory_allocate(
+	                                           sizeof( single_file_job_t * ) * number_of_jobs );
+
+	if( single_file_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create single file jobs.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     export_handle->single_file_jobs,
+		     job_index,
+		     (intptr_t **) &( single_file_jobs[ job_index ] ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to free retrieve sub file entry: %d.",
+			 "%s: unable to retrieve single file job: %d.",
 			 function,
-			 sub_file_entry_index );
+			 job_index );
 
 			goto on_error;
 		}
-		result = export_handle_export_file_entry(
-		          export_handle,
-		          sub_file_entry,
-		          export_path,
-		          export_path_size,
-		          file_entry_path_index,
-		          log_handle,
-		          error );
+	}
+	number_of_threads = export_handle->number_of_threads;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+	if( number_of_threads > number_of_jobs )
+	{
+		number_of_threads = number_of_jobs;
+	}
+	if( input_handle_pool_initialize(
+	     &( export_handle->input_handle_pool ),
+	     export_handle->input_handle,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input handle clones.",
+		 function );
 
-			goto on_error;
-		}
-		else if( result == 0 )
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( export_handle->single_file_thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     number_of_threads * 2,
+	     (int (*)(intptr_t *, void *)) &export_handle_export_single_file_job_callback,
+	     (void *) export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize single file thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( export_handle->abort != 0 )
 		{
-			return_value = 0;
+			break;
 		}
-		if( libewf_file_entry_free(
-		     &sub_file_entry,
+		if( libcthreads_thread_pool_push(
+		     export_handle->single_file_thread_pool,
+		     (intptr_t *) single_file_jobs[ job_index ],
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub file entry: %d.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push single file job: %d onto thread pool queue.",
 			 function,
-			 sub_file_entry_index );
+			 job_index );
 
 			goto on_error;
 		}
 	}
-	return( return_value );
+	if( libcthreads_thread_pool_join(
+	     &( export_handle->single_file_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join single file thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( input_handle_pool_free(
+	     &( export_handle->input_handle_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->abort == 0 )
+	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( single_file_jobs[ job_index ]->result == 1 )
+			{
+				continue;
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "Single file: %" PRIs_SYSTEM " FAILED\n",
+			 single_file_jobs[ job_index ]->target_path );
+
+			if( log_handle != NULL )
+			{
+				log_handle_printf(
+				 log_handle,
+				 "Single file: %" PRIs_SYSTEM " FAILED\n",
+				 single_file_jobs[ job_index ]->target_path );
+			}
+			if( ( single_file_jobs[ job_index ]->result == -1 )
+			 && ( result != -1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export single file: %" PRIs_SYSTEM ".",
+				 function,
+				 single_file_jobs[ job_index ]->target_path );
+
+				result = -1;
+			}
+			else if( result == 1 )
+			{
+				result = 0;
+			}
+		}
+	}
+	memory_free(
+	 single_file_jobs );
+
+	return( result );
 
 on_error:
-	if( sub_file_entry != NULL )
+	if( export_handle->single_file_thread_pool != NULL )
 	{
-		libewf_file_entry_free(
-		 &sub_file_entry,
+		libcthreads_thread_pool_join(
+		 &( export_handle->single_file_thread_pool ),
 		 NULL );
 	}
+	input_handle_pool_free(
+	 &( export_handle->input_handle_pool ),
+	 NULL );
+
+	if( single_file_jobs != NULL )
+	{
+		memory_free(
+		 single_file_jobs );
+	}
 	return( -1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Print the hash values to a stream
  * Returns 1 if successful or -1 on error
  */
@@ -26,15 +26,19 @@
 #include <types.h>
 
 #include "digest_hash.h"
+#include "digest_hash_threads.h"
 #include "ewftools_libcdata.h"
 #include "ewftools_libcerror.h"
 #include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
 #include "ewftools_libsmraw.h"
+#include "input_handle_pool.h"
 #include "log_handle.h"
 #include "process_status.h"
+#include "single_file_job.h"
 #include "storage_media_buffer.h"
+#include "storage_media_buffer_ring.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -155,6 +159,14 @@ struct export_handle
 	 */
 	uint8_t use_chunk_data_functions;
 
+	/* Value to indicate if the packed chunk data should be copied from the input to the output when possible
+	 */
+	uint8_t use_packed_chunk_data;
+
+	/* Value to indicate if the packed chunk data is copied from the input to the output
+	 */
+	uint8_t copy_packed_chunk_data;
+
 	/* The process buffer size
 	 */
 	size_t process_buffer_size;
@@ -173,14 +185,35 @@ struct export_handle
 	 */
 	libcthreads_thread_pool_t *output_thread_pool;
 
-	/* The output list
+	/* The output ring
 	 */
-	libcdata_list_t *output_list;
+	storage_media_buffer_ring_t *output_ring;
 
 	/* The storage media buffer queue
 	 */
 	libcthreads_queue_t *storage_media_buffer_queue;
 
+	/* The digest hash threads
+	 */
+	digest_hash_threads_t *digest_hash_threads;
+
+	/* The output mutex
+	 */
+	libcthreads_mutex_t *output_mutex;
+
+	/* The single file jobs, which are collected when exporting single files
+	 * with multiple threads
+	 */
+	libcdata_array_t *single_file_jobs;
+
+	/* The single file thread pool
+	 */
+	libcthreads_thread_pool_t *single_file_thread_pool;
+
+	/* The pool of input handle clones used by the single file thread pool
+	 */
+	input_handle_pool_t *input_handle_pool;
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* The libewf input handle
@@ -195,6 +228,10 @@ struct export_handle
 	 */
 	uint8_t use_stdout;
 
+	/* Value to indicate if the raw output is written at the storage media offset
+	 */
+	uint8_t use_positional_write;
+
 	/* The libewf output handle
 	 */
 	libewf_handle_t *ewf_output_handle;
@@ -305,6 +342,11 @@ ssize_t export_handle_write_storage_media_buffer(
          size_t write_size,
          libcerror_error_t **error );
 
+ssize_t export_handle_write_storage_media_buffer_at_offset(
+         export_handle_t *export_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         libcerror_error_t **error );
+
 off64_t export_handle_seek_offset(
          export_handle_t *export_handle,
          off64_t offset,
@@ -482,12 +524,17 @@ int export_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      export_handle_t *export_handle );
 
-int export_handle_empty_output_list(
+int export_handle_empty_output_ring(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
+int export_handle_check_copy_packed_chunk_data(
+     export_handle_t *export_handle,
+     uint8_t swap_byte_pairs,
+     libcerror_error_t **error );
+
 int export_handle_export_input(
      export_handle_t *export_handle,
      uint8_t swap_byte_pairs,
@@ -502,6 +549,37 @@ int export_handle_export_single_files(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_get_file_entry_name(
+     libewf_file_entry_t *file_entry,
+     system_character_t **name,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+int export_handle_join_sanitized_name(
+     const system_character_t *path,
+     size_t path_size,
+     const system_character_t *name,
+     size_t name_length,
+     system_character_t **target_path,
+     size_t *target_path_size,
+     libcerror_error_t **error );
+
+int export_handle_get_file_entry_target_path(
+     libewf_file_entry_t *file_entry,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     system_character_t **target_path,
+     size_t *target_path_size,
+     libcerror_error_t **error );
+
+int export_handle_export_single_files_in_media_order(
+     export_handle_t *export_handle,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     size_t file_entry_path_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_file_entry(
      export_handle_t *export_handle,
      libewf_file_entry_t *file_entry,
@@ -526,6 +604,25 @@ int export_handle_export_file_entry_sub_file_entries(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_single_file_job_data(
+     export_handle_t *export_handle,
+     single_file_job_t *single_file_job,
+     libewf_handle_t *input_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_export_single_file_job_callback(
+     single_file_job_t *single_file_job,
+     export_handle_t *export_handle );
+
+int export_handle_export_single_file_jobs(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_hash_values_fprint(
      export_handle_t *export_handle,
      FILE *stream,
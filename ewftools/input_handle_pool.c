@@ -0,0 +1,393 @@
+/*
+ * Input handle pool
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libewf.h"
+#include "input_handle_pool.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates an input handle pool
+ * Make sure the value input_handle_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int input_handle_pool_initialize(
+     input_handle_pool_t **input_handle_pool,
+     libewf_handle_t *input_handle,
+     int number_of_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "input_handle_pool_initialize";
+	int handle_index      = 0;
+
+	if( input_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_handles <= 0 )
+	 || ( number_of_handles > INPUT_HANDLE_POOL_MAXIMUM_NUMBER_OF_HANDLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*input_handle_pool = memory_allocate_structure(
+	                      input_handle_pool_t );
+
+	if( *input_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *input_handle_pool,
+	     0,
+	     sizeof( input_handle_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input handle pool.",
+		 function );
+
+		memory_free(
+		 *input_handle_pool );
+
+		*input_handle_pool = NULL;
+
+		return( -1 );
+	}
+	( *input_handle_pool )->handles = (libewf_handle_t **) memory_allocate(
+	                                                        sizeof( libewf_handle_t * ) * number_of_handles );
+
+	if( ( *input_handle_pool )->handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *input_handle_pool )->handles,
+	     0,
+	     sizeof( libewf_handle_t * ) * number_of_handles ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handles.",
+		 function );
+
+		goto on_error;
+	}
+	( *input_handle_pool )->number_of_handles = number_of_handles;
+
+	if( libcthreads_queue_initialize(
+	     &( ( *input_handle_pool )->handles_queue ),
+	     number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handles queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		if( libewf_handle_clone(
+		     &( ( *input_handle_pool )->handles[ handle_index ] ),
+		     input_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone input handle: %d.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     ( *input_handle_pool )->handles_queue,
+		     (intptr_t *) ( *input_handle_pool )->handles[ handle_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push input handle clone: %d onto queue.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *input_handle_pool != NULL )
+	{
+		input_handle_pool_free(
+		 input_handle_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an input handle pool including the input handle clones
+ * Returns 1 if successful or -1 on error
+ */
+int input_handle_pool_free(
+     input_handle_pool_t **input_handle_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "input_handle_pool_free";
+	int handle_index      = 0;
+	int result            = 1;
+
+	if( input_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_handle_pool != NULL )
+	{
+		/* The input handle clones are freed separately since the queue only references them
+		 */
+		if( ( *input_handle_pool )->handles_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *input_handle_pool )->handles_queue ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free handles queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *input_handle_pool )->handles != NULL )
+		{
+			for( handle_index = 0;
+			     handle_index < ( *input_handle_pool )->number_of_handles;
+			     handle_index++ )
+			{
+				if( ( *input_handle_pool )->handles[ handle_index ] != NULL )
+				{
+					if( libewf_handle_free(
+					     &( ( *input_handle_pool )->handles[ handle_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free input handle clone: %d.",
+						 function,
+						 handle_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *input_handle_pool )->handles );
+		}
+		memory_free(
+		 *input_handle_pool );
+
+		*input_handle_pool = NULL;
+	}
+	return( result );
+}
+
+/* Grabs an input handle clone that is not in use
+ * Blocks until an input handle clone is available
+ * Returns 1 if successful or -1 on error
+ */
+int input_handle_pool_grab_handle(
+     input_handle_pool_t *input_handle_pool,
+     libewf_handle_t **handle,
+     libcerror_error_t **error )
+{
+	static char *function = "input_handle_pool_grab_handle";
+
+	if( input_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_pop(
+	     input_handle_pool->handles_queue,
+	     (intptr_t **) handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop input handle clone from queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases an input handle clone that was grabbed from the pool
+ * Returns 1 if successful or -1 on error
+ */
+int input_handle_pool_release_handle(
+     input_handle_pool_t *input_handle_pool,
+     libewf_handle_t *handle,
+     libcerror_error_t **error )
+{
+	static char *function = "input_handle_pool_release_handle";
+
+	if( input_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_push(
+	     input_handle_pool->handles_queue,
+	     (intptr_t *) handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push input handle clone onto queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,87 @@
+/*
+ * Input handle pool
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INPUT_HANDLE_POOL_H )
+#define _INPUT_HANDLE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libewf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#define INPUT_HANDLE_POOL_MAXIMUM_NUMBER_OF_HANDLES	32
+
+typedef struct input_handle_pool input_handle_pool_t;
+
+/* The input handle pool contains clones of an input handle
+ * so that multiple threads can read the input concurrently
+ */
+struct input_handle_pool
+{
+	/* The clones of the input handle
+	 */
+	libewf_handle_t **handles;
+
+	/* The number of clones of the input handle
+	 */
+	int number_of_handles;
+
+	/* The queue of clones that are not in use
+	 */
+	libcthreads_queue_t *handles_queue;
+};
+
+int input_handle_pool_initialize(
+     input_handle_pool_t **input_handle_pool,
+     libewf_handle_t *input_handle,
+     int number_of_handles,
+     libcerror_error_t **error );
+
+int input_handle_pool_free(
+     input_handle_pool_t **input_handle_pool,
+     libcerror_error_t **error );
+
+int input_handle_pool_grab_handle(
+     input_handle_pool_t *input_handle_pool,
+     libewf_handle_t **handle,
+     libcerror_error_t **error );
+
+int input_handle_pool_release_handle(
+     input_handle_pool_t *input_handle_pool,
+     libewf_handle_t *handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INPUT_HANDLE_POOL_H ) */
+
@@ -1136,6 +1136,30 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 			return( -1 );
 		}
 	}
+	else if( ( file_entry->file_system != NULL )
+	      && ( file_entry->ewf_handle == file_entry->file_system->ewf_handle ) )
+	{
+		read_count = mount_file_system_read_buffer_at_offset(
+		              file_entry->file_system,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from file system.",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+	}
 	else
 	{
 		read_count = libewf_handle_read_buffer_at_offset(
@@ -41,6 +41,7 @@
 
 #include "ewftools_libcerror.h"
 #include "ewftools_libcpath.h"
+#include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
 #include "ewftools_libuna.h"
 #include "mount_file_system.h"
@@ -234,6 +235,21 @@ int mount_file_system_free(
 	}
 	if( *file_system != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( mount_file_system_free_handle_clones(
+		     *file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free handle clones.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( ( *file_system )->path_prefix != NULL )
 		{
 			memory_free(
@@ -256,6 +272,10 @@ int mount_file_system_signal_abort(
 {
 	static char *function = "mount_file_system_signal_abort";
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int handle_clone_index = 0;
+#endif
+
 	if( file_system == NULL )
 	{
 		libcerror_error_set(
@@ -283,6 +303,30 @@ int mount_file_system_signal_abort(
 			return( -1 );
 		}
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( file_system->handle_clones != NULL )
+	{
+		for( handle_clone_index = 0;
+		     handle_clone_index < file_system->number_of_handle_clones;
+		     handle_clone_index++ )
+		{
+			if( libewf_handle_signal_abort(
+			     file_system->handle_clones[ handle_clone_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal handle clone: %d to abort.",
+				 function,
+				 handle_clone_index );
+
+				return( -1 );
+			}
+		}
+	}
+#endif
 	return( 1 );
 }
 
@@ -349,6 +393,429 @@ int mount_file_system_get_handle(
 	return( 1 );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates clones of the handle to read concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_create_handle_clones(
+     mount_file_system_t *file_system,
+     int number_of_handle_clones,
+     libcerror_error_t **error )
+{
+	static char *function  = "mount_file_system_create_handle_clones";
+	int handle_clone_index = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->ewf_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->handle_clones != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - handle clones value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_handle_clones <= 0 )
+	 || ( number_of_handle_clones > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of handle clones value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->handle_clones = (libewf_handle_t **) memory_allocate(
+	                                                   sizeof( libewf_handle_t * ) * number_of_handle_clones );
+
+	if( file_system->handle_clones == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     file_system->handle_clones,
+	     0,
+	     sizeof( libewf_handle_t * ) * number_of_handle_clones ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handle clones.",
+		 function );
+
+		goto on_error;
+	}
+	file_system->number_of_handle_clones = number_of_handle_clones;
+
+	if( libcthreads_queue_initialize(
+	     &( file_system->handle_clones_queue ),
+	     number_of_handle_clones,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle clones queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( handle_clone_index = 0;
+	     handle_clone_index < number_of_handle_clones;
+	     handle_clone_index++ )
+	{
+		if( libewf_handle_clone(
+		     &( file_system->handle_clones[ handle_clone_index ] ),
+		     file_system->ewf_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone handle: %d.",
+			 function,
+			 handle_clone_index );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     file_system->handle_clones_queue,
+		     (intptr_t *) file_system->handle_clones[ handle_clone_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push handle clone: %d onto queue.",
+			 function,
+			 handle_clone_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	mount_file_system_free_handle_clones(
+	 file_system,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the clones of the handle
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_free_handle_clones(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	static char *function  = "mount_file_system_free_handle_clones";
+	int handle_clone_index = 0;
+	int result             = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	/* The handle clones are freed separately since the queue only references them
+	 */
+	if( file_system->handle_clones_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( file_system->handle_clones_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free handle clones queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( file_system->handle_clones != NULL )
+	{
+		for( handle_clone_index = 0;
+		     handle_clone_index < file_system->number_of_handle_clones;
+		     handle_clone_index++ )
+		{
+			if( file_system->handle_clones[ handle_clone_index ] != NULL )
+			{
+				if( libewf_handle_free(
+				     &( file_system->handle_clones[ handle_clone_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free handle clone: %d.",
+					 function,
+					 handle_clone_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 file_system->handle_clones );
+
+		file_system->handle_clones = NULL;
+	}
+	file_system->number_of_handle_clones = 0;
+
+	return( result );
+}
+
+/* Grabs a clone of the handle for reading, waits until one is available
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_grab_handle_clone(
+     mount_file_system_t *file_system,
+     libewf_handle_t **ewf_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_grab_handle_clone";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->handle_clones_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing handle clones queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( ewf_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_pop(
+	     file_system->handle_clones_queue,
+	     (intptr_t **) ewf_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop handle clone from queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases a clone of the handle after reading
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_release_handle_clone(
+     mount_file_system_t *file_system,
+     libewf_handle_t *ewf_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_release_handle_clone";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->handle_clones_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing handle clones queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_push(
+	     file_system->handle_clones_queue,
+	     (intptr_t *) ewf_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push handle clone onto queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Reads a buffer at a specific offset from the media data of the handle
+ * A clone of the handle is used if available so that concurrent reads
+ * do not have to wait for the lock of a single handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t mount_file_system_read_buffer_at_offset(
+         mount_file_system_t *file_system,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libewf_handle_t *ewf_handle = NULL;
+	static char *function       = "mount_file_system_read_buffer_at_offset";
+	ssize_t read_count          = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	ewf_handle = file_system->ewf_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( file_system->handle_clones_queue != NULL )
+	{
+		if( mount_file_system_grab_handle_clone(
+		     file_system,
+		     &ewf_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab handle clone.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	read_count = libewf_handle_read_buffer_at_offset(
+	              ewf_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ewf_handle != file_system->ewf_handle )
+	{
+		if( mount_file_system_release_handle_clone(
+		     file_system,
+		     ewf_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle clone.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from handle.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
 /* Sets the path prefix
  * Returns 1 if successful or -1 on error
  */
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
 
 #if defined( __cplusplus )
@@ -51,6 +52,22 @@ struct mount_file_system
 	/* The handle
 	 */
 	libewf_handle_t *ewf_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	/* The handle clones, used to read concurrently
+	 */
+	libewf_handle_t **handle_clones;
+
+	/* The number of handle clones
+	 */
+	int number_of_handle_clones;
+
+	/* The queue of handle clones that are available for reading
+	 */
+	libcthreads_queue_t *handle_clones_queue;
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 };
 
 int mount_file_system_initialize(
@@ -75,6 +92,36 @@ int mount_file_system_get_handle(
      libewf_handle_t **ewf_handle,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int mount_file_system_create_handle_clones(
+     mount_file_system_t *file_system,
+     int number_of_handle_clones,
+     libcerror_error_t **error );
+
+int mount_file_system_free_handle_clones(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_grab_handle_clone(
+     mount_file_system_t *file_system,
+     libewf_handle_t **ewf_handle,
+     libcerror_error_t **error );
+
+int mount_file_system_release_handle_clone(
+     mount_file_system_t *file_system,
+     libewf_handle_t *ewf_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+ssize_t mount_file_system_read_buffer_at_offset(
+         mount_file_system_t *file_system,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int mount_file_system_set_path_prefix(
      mount_file_system_t *file_system,
      const system_character_t *path_prefix,
@@ -0,0 +1,2492 @@
+/*
+ * Mount tool network block device (NBD) functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_SOCKET_H )
+#include <sys/socket.h>
+#endif
+
+#if defined( HAVE_SYS_UN_H )
+#include <sys/un.h>
+#endif
+
+#if defined( HAVE_POLL_H )
+#include <poll.h>
+#endif
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcnotify.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libewf.h"
+#include "ewftools_unused.h"
+#include "mount_file_system.h"
+#include "mount_nbd.h"
+
+#if defined( HAVE_MOUNT_NBD )
+
+#if defined( MSG_NOSIGNAL )
+#define MOUNT_NBD_SEND_FLAGS	MSG_NOSIGNAL
+#else
+#define MOUNT_NBD_SEND_FLAGS	0
+#endif
+
+/* Creates a NBD server
+ * Make sure the value server is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_server_initialize(
+     mount_nbd_server_t **server,
+     mount_file_system_t *file_system,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libewf_handle_t *ewf_handle = NULL;
+	static char *function       = "mount_nbd_server_initialize";
+
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *server != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid server value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*server = memory_allocate_structure(
+	           mount_nbd_server_t );
+
+	if( *server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create server.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *server,
+	     0,
+	     sizeof( mount_nbd_server_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear server.",
+		 function );
+
+		memory_free(
+		 *server );
+
+		*server = NULL;
+
+		return( -1 );
+	}
+	( *server )->socket_descriptor = -1;
+
+	if( mount_file_system_get_handle(
+	     file_system,
+	     &ewf_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle from file system.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_media_size(
+	     ewf_handle,
+	     &( ( *server )->media_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	( *server )->file_system       = file_system;
+	( *server )->number_of_threads = number_of_threads;
+
+	/* At least one thread is needed to handle the read requests
+	 */
+	if( ( *server )->number_of_threads == 0 )
+	{
+		( *server )->number_of_threads = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *server != NULL )
+	{
+		memory_free(
+		 *server );
+
+		*server = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a NBD server
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_server_free(
+     mount_nbd_server_t **server,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_server_free";
+	int result            = 1;
+
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *server != NULL )
+	{
+		if( ( *server )->socket_descriptor != -1 )
+		{
+			if( mount_nbd_server_close(
+			     *server,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close server.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *server );
+
+		*server = NULL;
+	}
+	return( result );
+}
+
+/* Signals the NBD server to abort
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_server_signal_abort(
+     mount_nbd_server_t *server,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_server_signal_abort";
+
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		return( -1 );
+	}
+	server->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the NBD server on an Unix domain socket
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_server_open(
+     mount_nbd_server_t *server,
+     const char *socket_path,
+     libcerror_error_t **error )
+{
+	struct sockaddr_un socket_address;
+
+	static char *function   = "mount_nbd_server_open";
+	size_t socket_path_size = 0;
+	int socket_descriptor   = -1;
+
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		return( -1 );
+	}
+	if( server->socket_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid server - socket descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket path.",
+		 function );
+
+		return( -1 );
+	}
+	socket_path_size = 1 + narrow_string_length(
+	                        socket_path );
+
+	if( socket_path_size > sizeof( socket_address.sun_path ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid socket path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_un ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		goto on_error;
+	}
+	socket_address.sun_family = AF_UNIX;
+
+	if( memory_copy(
+	     socket_address.sun_path,
+	     socket_path,
+	     socket_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy socket path.",
+		 function );
+
+		goto on_error;
+	}
+	server->socket_path = narrow_string_allocate(
+	                       socket_path_size );
+
+	if( server->socket_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create socket path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     server->socket_path,
+	     socket_path,
+	     socket_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy socket path.",
+		 function );
+
+		goto on_error;
+	}
+	socket_descriptor = socket(
+	                     AF_UNIX,
+	                     SOCK_STREAM,
+	                     0 );
+
+	if( socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create socket.",
+		 function );
+
+		goto on_error;
+	}
+	/* An existing socket file is not removed, bind fails if the path exists
+	 */
+	if( bind(
+	     socket_descriptor,
+	     (struct sockaddr *) &socket_address,
+	     sizeof( struct sockaddr_un ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to bind socket to: %s.",
+		 function,
+		 socket_path );
+
+		goto on_error;
+	}
+	if( listen(
+	     socket_descriptor,
+	     MOUNT_NBD_MAXIMUM_NUMBER_OF_CONNECTIONS ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to listen on socket.",
+		 function );
+
+		unlink(
+		 socket_path );
+
+		goto on_error;
+	}
+	server->socket_descriptor = socket_descriptor;
+
+	return( 1 );
+
+on_error:
+	if( socket_descriptor != -1 )
+	{
+		close(
+		 socket_descriptor );
+	}
+	if( server->socket_path != NULL )
+	{
+		memory_free(
+		 server->socket_path );
+
+		server->socket_path = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes the NBD server and removes the socket file
+ * Returns 0 if successful or -1 on error
+ */
+int mount_nbd_server_close(
+     mount_nbd_server_t *server,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_server_close";
+	int result            = 0;
+
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		return( -1 );
+	}
+	if( server->socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid server - missing socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( close(
+	     server->socket_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close socket.",
+		 function );
+
+		result = -1;
+	}
+	server->socket_descriptor = -1;
+
+	if( server->socket_path != NULL )
+	{
+		if( unlink(
+		     server->socket_path ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove socket: %s.",
+			 function,
+			 server->socket_path );
+
+			result = -1;
+		}
+		memory_free(
+		 server->socket_path );
+
+		server->socket_path = NULL;
+	}
+	return( result );
+}
+
+/* Runs the NBD server until abort is signalled
+ * Every connection is served by a thread of the connection thread pool
+ * while the read requests of all connections are handled by the request thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_server_run(
+     mount_nbd_server_t *server,
+     libcerror_error_t **error )
+{
+	struct pollfd poll_descriptor;
+
+	mount_nbd_connection_t *connection = NULL;
+	static char *function              = "mount_nbd_server_run";
+	int result                         = 0;
+	int socket_descriptor              = -1;
+
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		return( -1 );
+	}
+	if( server->socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid server - missing socket descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_pool_create(
+	     &( server->request_thread_pool ),
+	     NULL,
+	     server->number_of_threads,
+	     server->number_of_threads * 4,
+	     (int (*)(intptr_t *, void *)) &mount_nbd_server_request_callback,
+	     (void *) server,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize request thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( server->connection_thread_pool ),
+	     NULL,
+	     MOUNT_NBD_MAXIMUM_NUMBER_OF_CONNECTIONS,
+	     MOUNT_NBD_MAXIMUM_NUMBER_OF_CONNECTIONS,
+	     (int (*)(intptr_t *, void *)) &mount_nbd_server_connection_callback,
+	     (void *) server,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize connection thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	while( server->abort == 0 )
+	{
+		poll_descriptor.fd      = server->socket_descriptor;
+		poll_descriptor.events  = POLLIN;
+		poll_descriptor.revents = 0;
+
+		/* The timeout allows to check for an abort
+		 */
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          MOUNT_NBD_POLL_TIMEOUT );
+
+		if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to poll socket.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		socket_descriptor = accept(
+		                     server->socket_descriptor,
+		                     NULL,
+		                     NULL );
+
+		if( socket_descriptor == -1 )
+		{
+			if( ( errno == EINTR )
+			 || ( errno == ECONNABORTED ) )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to accept connection.",
+			 function );
+
+			goto on_error;
+		}
+		if( mount_nbd_connection_initialize(
+		     &connection,
+		     server,
+		     socket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create connection.",
+			 function );
+
+			close(
+			 socket_descriptor );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_push(
+		     server->connection_thread_pool,
+		     (intptr_t *) connection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push connection onto connection thread pool queue.",
+			 function );
+
+			goto on_error;
+		}
+		connection = NULL;
+	}
+	/* The connections wait for their pending requests before they are closed
+	 * hence the connection thread pool is joined first
+	 */
+	if( libcthreads_thread_pool_join(
+	     &( server->connection_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join connection thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_join(
+	     &( server->request_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join request thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( connection != NULL )
+	{
+		mount_nbd_connection_free(
+		 &connection,
+		 NULL );
+	}
+	server->abort = 1;
+
+	if( server->connection_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( server->connection_thread_pool ),
+		 NULL );
+	}
+	if( server->request_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( server->request_thread_pool ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Serves a connection, called by the connection thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_server_connection_callback(
+     mount_nbd_connection_t *connection,
+     mount_nbd_server_t *server EWFTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_nbd_server_connection_callback";
+	int result               = 0;
+
+	EWFTOOLS_UNREFERENCED_PARAMETER( server )
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		goto on_error;
+	}
+	result = mount_nbd_connection_negotiate(
+	          connection,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to negotiate connection.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( mount_nbd_connection_handle_requests(
+		     connection,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to handle requests.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( mount_nbd_connection_wait_for_pending_requests(
+	     connection,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to wait for pending requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_nbd_connection_free(
+	     &connection,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free connection.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( connection != NULL )
+	{
+		/* The pending requests reference the connection
+		 */
+		if( mount_nbd_connection_wait_for_pending_requests(
+		     connection,
+		     NULL ) == 1 )
+		{
+			mount_nbd_connection_free(
+			 &connection,
+			 NULL );
+		}
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Handles a read request, called by the request thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_server_request_callback(
+     mount_nbd_request_t *request,
+     mount_nbd_server_t *server )
+{
+	libcerror_error_t *error           = NULL;
+	mount_nbd_connection_t *connection = NULL;
+	uint8_t *data                      = NULL;
+	static char *function              = "mount_nbd_server_request_callback";
+	ssize_t read_count                 = 0;
+	uint32_t error_code                = MOUNT_NBD_ERROR_NONE;
+	int result                         = 1;
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		goto on_error;
+	}
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		goto on_error;
+	}
+	connection = request->connection;
+
+	if( request->size > 0 )
+	{
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * request->size );
+
+		if( data == NULL )
+		{
+			error_code = MOUNT_NBD_ERROR_ENOMEM;
+		}
+		else
+		{
+			read_count = mount_file_system_read_buffer_at_offset(
+			              server->file_system,
+			              data,
+			              (size_t) request->size,
+			              (off64_t) request->offset,
+			              &error );
+
+			if( read_count != (ssize_t) request->size )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( ( libcnotify_verbose != 0 )
+				 && ( error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+
+				error_code = MOUNT_NBD_ERROR_EIO;
+			}
+		}
+	}
+	/* On error no data is send in a simple reply
+	 */
+	if( mount_nbd_connection_write_simple_reply(
+	     connection,
+	     error_code,
+	     request->cookie,
+	     data,
+	     ( error_code == MOUNT_NBD_ERROR_NONE ) ? (size_t) request->size : 0,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write reply.",
+		 function );
+
+		result = -1;
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+
+		data = NULL;
+	}
+	memory_free(
+	 request );
+
+	request = NULL;
+
+	if( mount_nbd_connection_remove_pending_request(
+	     connection,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove pending request.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( request != NULL )
+	{
+		memory_free(
+		 request );
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Creates a connection
+ * Make sure the value connection is referencing, is set to NULL
+ * The connection takes over the socket descriptor on success
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_initialize(
+     mount_nbd_connection_t **connection,
+     mount_nbd_server_t *server,
+     int socket_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_connection_initialize";
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *connection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid connection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid server.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid socket descriptor value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*connection = memory_allocate_structure(
+	               mount_nbd_connection_t );
+
+	if( *connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create connection.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *connection,
+	     0,
+	     sizeof( mount_nbd_connection_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear connection.",
+		 function );
+
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *connection )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *connection )->request_done_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize request done condition.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( SO_NOSIGPIPE )
+	{
+		int option_value = 1;
+
+		setsockopt(
+		 socket_descriptor,
+		 SOL_SOCKET,
+		 SO_NOSIGPIPE,
+		 &option_value,
+		 sizeof( int ) );
+	}
+#endif
+	( *connection )->server            = server;
+	( *connection )->socket_descriptor = socket_descriptor;
+
+	return( 1 );
+
+on_error:
+	if( *connection != NULL )
+	{
+		if( ( *connection )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *connection )->mutex ),
+			 NULL );
+		}
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a connection and closes its socket
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_free(
+     mount_nbd_connection_t **connection,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_connection_free";
+	int result            = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *connection != NULL )
+	{
+		if( close(
+		     ( *connection )->socket_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close socket.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( ( *connection )->request_done_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free request done condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *connection )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+	}
+	return( result );
+}
+
+/* Reads data from the connection
+ * Returns 1 if successful, 0 if the connection was closed or abort was signalled or -1 on error
+ */
+int mount_nbd_connection_read_data(
+     mount_nbd_connection_t *connection,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	struct pollfd poll_descriptor;
+
+	static char *function = "mount_nbd_connection_read_data";
+	size_t data_offset    = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection->server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid connection - missing server.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		if( connection->server->abort != 0 )
+		{
+			return( 0 );
+		}
+		poll_descriptor.fd      = connection->socket_descriptor;
+		poll_descriptor.events  = POLLIN;
+		poll_descriptor.revents = 0;
+
+		/* The timeout allows to check for an abort
+		 */
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          MOUNT_NBD_POLL_TIMEOUT );
+
+		if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to poll socket.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		read_count = recv(
+		              connection->socket_descriptor,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              0 );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			if( errno == ECONNRESET )
+			{
+				return( 0 );
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from socket.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			return( 0 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	return( 1 );
+}
+
+/* Writes data to the connection
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_write_data(
+     mount_nbd_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_connection_write_data";
+	size_t data_offset    = 0;
+	ssize_t write_count   = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		write_count = send(
+		               connection->socket_descriptor,
+		               &( data[ data_offset ] ),
+		               data_size - data_offset,
+		               MOUNT_NBD_SEND_FLAGS );
+
+		if( write_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to socket.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( 1 );
+}
+
+/* Writes an option reply, used during negotiation
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_write_option_reply(
+     mount_nbd_connection_t *connection,
+     uint32_t option,
+     uint32_t reply_type,
+     const uint8_t *data,
+     uint32_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t reply_header[ 20 ];
+
+	static char *function = "mount_nbd_connection_write_option_reply";
+
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 &( reply_header[ 0 ] ),
+	 MOUNT_NBD_MAGIC_OPTION_REPLY );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 8 ] ),
+	 option );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 12 ] ),
+	 reply_type );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 16 ] ),
+	 data_size );
+
+	if( mount_nbd_connection_write_data(
+	     connection,
+	     reply_header,
+	     20,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write option reply header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( mount_nbd_connection_write_data(
+		     connection,
+		     data,
+		     (size_t) data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write option reply data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a simple reply, used during transmission
+ * The reply is written while holding the connection mutex so that replies
+ * of concurrently handled requests do not interleave
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_write_simple_reply(
+     mount_nbd_connection_t *connection,
+     uint32_t error_code,
+     uint64_t cookie,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t reply_header[ 16 ];
+
+	static char *function = "mount_nbd_connection_write_simple_reply";
+	int result            = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 0 ] ),
+	 MOUNT_NBD_MAGIC_SIMPLE_REPLY );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 4 ] ),
+	 error_code );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( reply_header[ 8 ] ),
+	 cookie );
+
+	if( libcthreads_mutex_grab(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_nbd_connection_write_data(
+	     connection,
+	     reply_header,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write simple reply header.",
+		 function );
+
+		result = -1;
+	}
+	else if( data_size > 0 )
+	{
+		if( mount_nbd_connection_write_data(
+		     connection,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write simple reply data.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Negotiates the connection using the fixed newstyle handshake
+ * Returns 1 if the transmission phase was entered, 0 if the client ended the negotiation or -1 on error
+ */
+int mount_nbd_connection_negotiate(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error )
+{
+	uint8_t export_data[ 134 ];
+	uint8_t handshake_data[ 18 ];
+	uint8_t option_header[ 16 ];
+	uint8_t option_data[ 4096 ];
+
+	static char *function        = "mount_nbd_connection_negotiate";
+	size_t export_data_size      = 0;
+	size_t read_size             = 0;
+	uint64_t magic               = 0;
+	uint32_t client_flags        = 0;
+	uint32_t name_size           = 0;
+	uint32_t option              = 0;
+	uint32_t option_data_size    = 0;
+	uint32_t remaining_data_size = 0;
+	uint32_t reply_type          = 0;
+	uint16_t number_of_requests  = 0;
+	int result                   = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection->server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid connection - missing server.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 &( handshake_data[ 0 ] ),
+	 MOUNT_NBD_MAGIC_INIT_PASSWORD );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( handshake_data[ 8 ] ),
+	 MOUNT_NBD_MAGIC_OPTION );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( handshake_data[ 16 ] ),
+	 MOUNT_NBD_HANDSHAKE_FLAG_FIXED_NEWSTYLE | MOUNT_NBD_HANDSHAKE_FLAG_NO_ZEROES );
+
+	if( mount_nbd_connection_write_data(
+	     connection,
+	     handshake_data,
+	     18,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write handshake.",
+		 function );
+
+		return( -1 );
+	}
+	result = mount_nbd_connection_read_data(
+	          connection,
+	          handshake_data,
+	          4,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 handshake_data,
+	 client_flags );
+
+	if( ( client_flags & ~( (uint32_t) MOUNT_NBD_HANDSHAKE_FLAG_FIXED_NEWSTYLE | MOUNT_NBD_HANDSHAKE_FLAG_NO_ZEROES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported client flags: 0x%08" PRIx32 ".",
+		 function,
+		 client_flags );
+
+		return( -1 );
+	}
+	/* The export data consists of:
+	 * the export size, the transmission flags and optionally 124 bytes of zero padding
+	 */
+	if( memory_set(
+	     export_data,
+	     0,
+	     134 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 &( export_data[ 0 ] ),
+	 connection->server->media_size );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( export_data[ 8 ] ),
+	 MOUNT_NBD_TRANSMISSION_FLAG_HAS_FLAGS | MOUNT_NBD_TRANSMISSION_FLAG_READ_ONLY | MOUNT_NBD_TRANSMISSION_FLAG_CAN_MULTI_CONN );
+
+	export_data_size = 10;
+
+	if( ( client_flags & MOUNT_NBD_HANDSHAKE_FLAG_NO_ZEROES ) == 0 )
+	{
+		export_data_size += 124;
+	}
+	while( connection->server->abort == 0 )
+	{
+		result = mount_nbd_connection_read_data(
+		          connection,
+		          option_header,
+		          16,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		byte_stream_copy_to_uint64_big_endian(
+		 &( option_header[ 0 ] ),
+		 magic );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( option_header[ 8 ] ),
+		 option );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( option_header[ 12 ] ),
+		 option_data_size );
+
+		if( magic != MOUNT_NBD_MAGIC_OPTION )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported option magic: 0x%08" PRIx64 ".",
+			 function,
+			 magic );
+
+			return( -1 );
+		}
+		if( option_data_size > (uint32_t) sizeof( option_data ) )
+		{
+			/* Option data that does not fit in the buffer is discarded
+			 */
+			remaining_data_size = option_data_size;
+
+			while( remaining_data_size > 0 )
+			{
+				read_size = sizeof( option_data );
+
+				if( read_size > (size_t) remaining_data_size )
+				{
+					read_size = (size_t) remaining_data_size;
+				}
+				result = mount_nbd_connection_read_data(
+				          connection,
+				          option_data,
+				          read_size,
+				          error );
+
+				if( result != 1 )
+				{
+					return( result );
+				}
+				remaining_data_size -= (uint32_t) read_size;
+			}
+			/* The export name is ignored hence its option data is not needed,
+			 * other options are rejected and the negotiation continues
+			 */
+			if( option != MOUNT_NBD_OPTION_EXPORT_NAME )
+			{
+				if( mount_nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     MOUNT_NBD_OPTION_REPLY_ERROR_TOO_BIG,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write option reply.",
+					 function );
+
+					return( -1 );
+				}
+				continue;
+			}
+			option_data_size = 0;
+		}
+		else if( option_data_size > 0 )
+		{
+			result = mount_nbd_connection_read_data(
+			          connection,
+			          option_data,
+			          (size_t) option_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				return( result );
+			}
+		}
+		switch( option )
+		{
+			case MOUNT_NBD_OPTION_EXPORT_NAME:
+				/* A single export is provided hence the export name is ignored
+				 */
+				if( mount_nbd_connection_write_data(
+				     connection,
+				     export_data,
+				     export_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write export data.",
+					 function );
+
+					return( -1 );
+				}
+				return( 1 );
+
+			case MOUNT_NBD_OPTION_ABORT:
+				if( mount_nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     MOUNT_NBD_OPTION_REPLY_ACK,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write option reply.",
+					 function );
+
+					return( -1 );
+				}
+				return( 0 );
+
+			case MOUNT_NBD_OPTION_LIST:
+				if( option_data_size != 0 )
+				{
+					reply_type = MOUNT_NBD_OPTION_REPLY_ERROR_INVALID;
+
+					break;
+				}
+				/* The export has an empty name
+				 */
+				byte_stream_copy_from_uint32_big_endian(
+				 option_data,
+				 0 );
+
+				if( mount_nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     MOUNT_NBD_OPTION_REPLY_SERVER,
+				     option_data,
+				     4,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write option reply.",
+					 function );
+
+					return( -1 );
+				}
+				reply_type = MOUNT_NBD_OPTION_REPLY_ACK;
+
+				break;
+
+			case MOUNT_NBD_OPTION_INFO:
+			case MOUNT_NBD_OPTION_GO:
+				reply_type = MOUNT_NBD_OPTION_REPLY_ERROR_INVALID;
+
+				if( option_data_size < 6 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint32_big_endian(
+				 option_data,
+				 name_size );
+
+				if( name_size > ( option_data_size - 6 ) )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint16_big_endian(
+				 &( option_data[ 4 + name_size ] ),
+				 number_of_requests );
+
+				if( option_data_size != ( 6 + name_size + ( 2 * (uint32_t) number_of_requests ) ) )
+				{
+					break;
+				}
+				/* Only the mandatory export information is provided
+				 */
+				byte_stream_copy_from_uint16_big_endian(
+				 option_data,
+				 0 );
+
+				if( memory_copy(
+				     &( option_data[ 2 ] ),
+				     export_data,
+				     10 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy export data.",
+					 function );
+
+					return( -1 );
+				}
+				if( mount_nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     MOUNT_NBD_OPTION_REPLY_INFO,
+				     option_data,
+				     12,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write option reply.",
+					 function );
+
+					return( -1 );
+				}
+				if( mount_nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     MOUNT_NBD_OPTION_REPLY_ACK,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write option reply.",
+					 function );
+
+					return( -1 );
+				}
+				if( option == MOUNT_NBD_OPTION_GO )
+				{
+					return( 1 );
+				}
+				reply_type = 0;
+
+				break;
+
+			default:
+				reply_type = MOUNT_NBD_OPTION_REPLY_ERROR_UNSUPPORTED;
+
+				break;
+		}
+		if( reply_type != 0 )
+		{
+			if( mount_nbd_connection_write_option_reply(
+			     connection,
+			     option,
+			     reply_type,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write option reply.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
+/* Handles the requests of the connection until the client disconnects
+ * Read requests are handed to the request thread pool, other requests are answered directly
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_handle_requests(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error )
+{
+	uint8_t discard_data[ 4096 ];
+	uint8_t request_header[ 28 ];
+
+	mount_nbd_request_t *request = NULL;
+	static char *function        = "mount_nbd_connection_handle_requests";
+	size_t read_size             = 0;
+	uint64_t cookie              = 0;
+	uint64_t offset              = 0;
+	uint32_t error_code          = 0;
+	uint32_t magic               = 0;
+	uint32_t size                = 0;
+	uint16_t command             = 0;
+	int result                   = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection->server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid connection - missing server.",
+		 function );
+
+		return( -1 );
+	}
+	while( connection->server->abort == 0 )
+	{
+		result = mount_nbd_connection_read_data(
+		          connection,
+		          request_header,
+		          28,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read request header.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 &( request_header[ 0 ] ),
+		 magic );
+
+		byte_stream_copy_to_uint16_big_endian(
+		 &( request_header[ 6 ] ),
+		 command );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( request_header[ 8 ] ),
+		 cookie );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( request_header[ 16 ] ),
+		 offset );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( request_header[ 24 ] ),
+		 size );
+
+		if( magic != MOUNT_NBD_MAGIC_REQUEST )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported request magic: 0x%08" PRIx32 ".",
+			 function,
+			 magic );
+
+			goto on_error;
+		}
+		if( command == MOUNT_NBD_COMMAND_DISCONNECT )
+		{
+			break;
+		}
+		error_code = MOUNT_NBD_ERROR_NONE;
+
+		switch( command )
+		{
+			case MOUNT_NBD_COMMAND_READ:
+				if( ( size > MOUNT_NBD_MAXIMUM_REQUEST_SIZE )
+				 || ( offset > connection->server->media_size )
+				 || ( (size64_t) size > ( connection->server->media_size - offset ) ) )
+				{
+					error_code = MOUNT_NBD_ERROR_EINVAL;
+
+					break;
+				}
+				request = memory_allocate_structure(
+				           mount_nbd_request_t );
+
+				if( request == NULL )
+				{
+					error_code = MOUNT_NBD_ERROR_ENOMEM;
+
+					break;
+				}
+				request->connection = connection;
+				request->cookie     = cookie;
+				request->offset     = offset;
+				request->size       = size;
+
+				if( mount_nbd_connection_add_pending_request(
+				     connection,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add pending request.",
+					 function );
+
+					goto on_error;
+				}
+				if( libcthreads_thread_pool_push(
+				     connection->server->request_thread_pool,
+				     (intptr_t *) request,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push request onto request thread pool queue.",
+					 function );
+
+					mount_nbd_connection_remove_pending_request(
+					 connection,
+					 NULL );
+
+					goto on_error;
+				}
+				request = NULL;
+
+				break;
+
+			case MOUNT_NBD_COMMAND_WRITE:
+				/* The write data is discarded since the export is read-only
+				 */
+				if( size > MOUNT_NBD_MAXIMUM_REQUEST_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid write request size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				while( size > 0 )
+				{
+					read_size = sizeof( discard_data );
+
+					if( read_size > (size_t) size )
+					{
+						read_size = (size_t) size;
+					}
+					result = mount_nbd_connection_read_data(
+					          connection,
+					          discard_data,
+					          read_size,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read write request data.",
+						 function );
+
+						goto on_error;
+					}
+					else if( result == 0 )
+					{
+						return( 1 );
+					}
+					size -= (uint32_t) read_size;
+				}
+				error_code = MOUNT_NBD_ERROR_EPERM;
+
+				break;
+
+			case MOUNT_NBD_COMMAND_TRIM:
+			case MOUNT_NBD_COMMAND_WRITE_ZEROES:
+				error_code = MOUNT_NBD_ERROR_EPERM;
+
+				break;
+
+			default:
+				error_code = MOUNT_NBD_ERROR_EINVAL;
+
+				break;
+		}
+		if( ( command != MOUNT_NBD_COMMAND_READ )
+		 || ( error_code != MOUNT_NBD_ERROR_NONE ) )
+		{
+			if( mount_nbd_connection_write_simple_reply(
+			     connection,
+			     error_code,
+			     cookie,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write reply.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( request != NULL )
+	{
+		memory_free(
+		 request );
+	}
+	return( -1 );
+}
+
+/* Adds a pending request to the connection
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_add_pending_request(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_connection_add_pending_request";
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	connection->number_of_pending_requests += 1;
+
+	if( libcthreads_mutex_release(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a pending request from the connection and signals that it is done
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_remove_pending_request(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_connection_remove_pending_request";
+	int result            = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	connection->number_of_pending_requests -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     connection->request_done_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast request done condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits until all pending requests of the connection are done
+ * Returns 1 if successful or -1 on error
+ */
+int mount_nbd_connection_wait_for_pending_requests(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_nbd_connection_wait_for_pending_requests";
+	int result            = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( connection->number_of_pending_requests > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     connection->request_done_condition,
+		     connection->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for request done condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     connection->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MOUNT_NBD ) */
+
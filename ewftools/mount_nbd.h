@@ -0,0 +1,296 @@
+/*
+ * Mount tool network block device (NBD) functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_NBD_H )
+#define _MOUNT_NBD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "mount_file_system.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_SYS_UN_H ) && defined( HAVE_POLL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define HAVE_MOUNT_NBD	1
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MOUNT_NBD )
+
+/* The maximum number of connections that are served concurrently
+ */
+#define MOUNT_NBD_MAXIMUM_NUMBER_OF_CONNECTIONS		16
+
+/* The maximum size of the data of a single read request
+ */
+#define MOUNT_NBD_MAXIMUM_REQUEST_SIZE			( 32 * 1024 * 1024 )
+
+/* The poll timeout in milliseconds, used to check for an abort
+ */
+#define MOUNT_NBD_POLL_TIMEOUT				500
+
+/* The NBD protocol magic values
+ */
+#define MOUNT_NBD_MAGIC_INIT_PASSWORD			0x4e42444d41474943ULL
+#define MOUNT_NBD_MAGIC_OPTION				0x49484156454f5054ULL
+#define MOUNT_NBD_MAGIC_OPTION_REPLY			0x0003e889045565a9ULL
+#define MOUNT_NBD_MAGIC_REQUEST				0x25609513UL
+#define MOUNT_NBD_MAGIC_SIMPLE_REPLY			0x67446698UL
+
+enum MOUNT_NBD_HANDSHAKE_FLAGS
+{
+	MOUNT_NBD_HANDSHAKE_FLAG_FIXED_NEWSTYLE		= 0x0001,
+	MOUNT_NBD_HANDSHAKE_FLAG_NO_ZEROES		= 0x0002
+};
+
+enum MOUNT_NBD_TRANSMISSION_FLAGS
+{
+	MOUNT_NBD_TRANSMISSION_FLAG_HAS_FLAGS		= 0x0001,
+	MOUNT_NBD_TRANSMISSION_FLAG_READ_ONLY		= 0x0002,
+	MOUNT_NBD_TRANSMISSION_FLAG_CAN_MULTI_CONN	= 0x0100
+};
+
+enum MOUNT_NBD_OPTIONS
+{
+	MOUNT_NBD_OPTION_EXPORT_NAME			= 1,
+	MOUNT_NBD_OPTION_ABORT				= 2,
+	MOUNT_NBD_OPTION_LIST				= 3,
+	MOUNT_NBD_OPTION_INFO				= 6,
+	MOUNT_NBD_OPTION_GO				= 7
+};
+
+enum MOUNT_NBD_OPTION_REPLY_TYPES
+{
+	MOUNT_NBD_OPTION_REPLY_ACK			= 0x00000001UL,
+	MOUNT_NBD_OPTION_REPLY_SERVER			= 0x00000002UL,
+	MOUNT_NBD_OPTION_REPLY_INFO			= 0x00000003UL,
+	MOUNT_NBD_OPTION_REPLY_ERROR_UNSUPPORTED	= 0x80000001UL,
+	MOUNT_NBD_OPTION_REPLY_ERROR_INVALID		= 0x80000003UL,
+	MOUNT_NBD_OPTION_REPLY_ERROR_TOO_BIG		= 0x80000009UL
+};
+
+enum MOUNT_NBD_COMMANDS
+{
+	MOUNT_NBD_COMMAND_READ				= 0,
+	MOUNT_NBD_COMMAND_WRITE				= 1,
+	MOUNT_NBD_COMMAND_DISCONNECT			= 2,
+	MOUNT_NBD_COMMAND_FLUSH				= 3,
+	MOUNT_NBD_COMMAND_TRIM				= 4,
+	MOUNT_NBD_COMMAND_CACHE				= 5,
+	MOUNT_NBD_COMMAND_WRITE_ZEROES			= 6
+};
+
+enum MOUNT_NBD_ERRORS
+{
+	MOUNT_NBD_ERROR_NONE				= 0,
+	MOUNT_NBD_ERROR_EPERM				= 1,
+	MOUNT_NBD_ERROR_EIO				= 5,
+	MOUNT_NBD_ERROR_ENOMEM				= 12,
+	MOUNT_NBD_ERROR_EINVAL				= 22
+};
+
+typedef struct mount_nbd_server mount_nbd_server_t;
+
+struct mount_nbd_server
+{
+	/* The file system
+	 */
+	mount_file_system_t *file_system;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The socket path
+	 */
+	char *socket_path;
+
+	/* The listening socket descriptor
+	 */
+	int socket_descriptor;
+
+	/* The number of threads that handle read requests
+	 */
+	int number_of_threads;
+
+	/* The connection thread pool
+	 */
+	libcthreads_thread_pool_t *connection_thread_pool;
+
+	/* The request thread pool
+	 */
+	libcthreads_thread_pool_t *request_thread_pool;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+typedef struct mount_nbd_connection mount_nbd_connection_t;
+
+struct mount_nbd_connection
+{
+	/* The server
+	 */
+	mount_nbd_server_t *server;
+
+	/* The socket descriptor
+	 */
+	int socket_descriptor;
+
+	/* The mutex, serializes the replies and protects the number of pending requests
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, signalled when a pending request is done
+	 */
+	libcthreads_condition_t *request_done_condition;
+
+	/* The number of pending requests
+	 */
+	int number_of_pending_requests;
+};
+
+typedef struct mount_nbd_request mount_nbd_request_t;
+
+struct mount_nbd_request
+{
+	/* The connection
+	 */
+	mount_nbd_connection_t *connection;
+
+	/* The cookie (or handle) that identifies the request
+	 */
+	uint64_t cookie;
+
+	/* The offset
+	 */
+	uint64_t offset;
+
+	/* The size
+	 */
+	uint32_t size;
+};
+
+int mount_nbd_server_initialize(
+     mount_nbd_server_t **server,
+     mount_file_system_t *file_system,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int mount_nbd_server_free(
+     mount_nbd_server_t **server,
+     libcerror_error_t **error );
+
+int mount_nbd_server_signal_abort(
+     mount_nbd_server_t *server,
+     libcerror_error_t **error );
+
+int mount_nbd_server_open(
+     mount_nbd_server_t *server,
+     const char *socket_path,
+     libcerror_error_t **error );
+
+int mount_nbd_server_close(
+     mount_nbd_server_t *server,
+     libcerror_error_t **error );
+
+int mount_nbd_server_run(
+     mount_nbd_server_t *server,
+     libcerror_error_t **error );
+
+int mount_nbd_server_connection_callback(
+     mount_nbd_connection_t *connection,
+     mount_nbd_server_t *server );
+
+int mount_nbd_server_request_callback(
+     mount_nbd_request_t *request,
+     mount_nbd_server_t *server );
+
+int mount_nbd_connection_initialize(
+     mount_nbd_connection_t **connection,
+     mount_nbd_server_t *server,
+     int socket_descriptor,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_free(
+     mount_nbd_connection_t **connection,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_read_data(
+     mount_nbd_connection_t *connection,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_write_data(
+     mount_nbd_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_write_option_reply(
+     mount_nbd_connection_t *connection,
+     uint32_t option,
+     uint32_t reply_type,
+     const uint8_t *data,
+     uint32_t data_size,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_write_simple_reply(
+     mount_nbd_connection_t *connection,
+     uint32_t error_code,
+     uint64_t cookie,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_negotiate(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_handle_requests(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_add_pending_request(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_remove_pending_request(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error );
+
+int mount_nbd_connection_wait_for_pending_requests(
+     mount_nbd_connection_t *connection,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MOUNT_NBD ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_NBD_H ) */
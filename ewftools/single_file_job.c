@@ -0,0 +1,240 @@
+/*
+ * Single file job
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libewf.h"
+#include "single_file_job.h"
+
+/* Creates a single file job
+ * Make sure the value single_file_job is referencing, is set to NULL
+ * The target path is optional and is copied into the job
+ * Returns 1 if successful or -1 on error
+ */
+int single_file_job_initialize(
+     single_file_job_t **single_file_job,
+     libewf_file_entry_t *file_entry,
+     int file_entry_index,
+     const system_character_t *target_path,
+     size_t target_path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "single_file_job_initialize";
+
+	if( single_file_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *single_file_job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid single file job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path != NULL )
+	{
+		if( ( target_path_size == 0 )
+		 || ( target_path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid target path size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*single_file_job = memory_allocate_structure(
+	                    single_file_job_t );
+
+	if( *single_file_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create single file job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *single_file_job,
+	     0,
+	     sizeof( single_file_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear single file job.",
+		 function );
+
+		memory_free(
+		 *single_file_job );
+
+		*single_file_job = NULL;
+
+		return( -1 );
+	}
+	if( target_path != NULL )
+	{
+		( *single_file_job )->target_path = system_string_allocate(
+		                                     target_path_size );
+
+		if( ( *single_file_job )->target_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create target path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *single_file_job )->target_path,
+		     target_path,
+		     target_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy target path.",
+			 function );
+
+			goto on_error;
+		}
+		( *single_file_job )->target_path[ target_path_size - 1 ] = 0;
+
+		( *single_file_job )->target_path_size = target_path_size;
+	}
+	( *single_file_job )->file_entry_index = file_entry_index;
+
+	if( libewf_file_entry_get_size(
+	     file_entry,
+	     &( ( *single_file_job )->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *single_file_job != NULL )
+	{
+		if( ( *single_file_job )->target_path != NULL )
+		{
+			memory_free(
+			 ( *single_file_job )->target_path );
+		}
+		memory_free(
+		 *single_file_job );
+
+		*single_file_job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a single file job
+ * Returns 1 if successful or -1 on error
+ */
+int single_file_job_free(
+     single_file_job_t **single_file_job,
+     libcerror_error_t **error )
+{
+	static char *function = "single_file_job_free";
+
+	if( single_file_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *single_file_job != NULL )
+	{
+		if( ( *single_file_job )->target_path != NULL )
+		{
+			memory_free(
+			 ( *single_file_job )->target_path );
+		}
+		memory_free(
+		 *single_file_job );
+
+		*single_file_job = NULL;
+	}
+	return( 1 );
+}
+
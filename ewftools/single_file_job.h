@@ -0,0 +1,99 @@
+/*
+ * Single file job
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SINGLE_FILE_JOB_H )
+#define _SINGLE_FILE_JOB_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libewf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct single_file_job single_file_job_t;
+
+struct single_file_job
+{
+	/* The target path
+	 */
+	system_character_t *target_path;
+
+	/* The target path size
+	 */
+	size_t target_path_size;
+
+	/* The index of the file entry in media order
+	 * used to retrieve the file entry from a clone of the input handle
+	 */
+	int file_entry_index;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The calculated MD5 digest hash, used when verifying
+	 */
+	uint8_t calculated_md5_hash[ 16 ];
+
+	/* The calculated SHA1 digest hash, used when verifying
+	 */
+	uint8_t calculated_sha1_hash[ 20 ];
+
+	/* The calculated SHA256 digest hash, used when verifying
+	 */
+	uint8_t calculated_sha256_hash[ 32 ];
+
+	/* Value to indicate a stored MD5 digest hash is available
+	 */
+	int stored_md5_hash_available;
+
+	/* The stored MD5 digest hash string, used when verifying
+	 */
+	system_character_t stored_md5_hash_string[ 33 ];
+
+	/* The result, 1 if successful, 0 if not or -1 on error
+	 */
+	int result;
+};
+
+int single_file_job_initialize(
+     single_file_job_t **single_file_job,
+     libewf_file_entry_t *file_entry,
+     int file_entry_index,
+     const system_character_t *target_path,
+     size_t target_path_size,
+     libcerror_error_t **error );
+
+int single_file_job_free(
+     single_file_job_t **single_file_job,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SINGLE_FILE_JOB_H ) */
+
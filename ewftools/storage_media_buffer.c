@@ -64,7 +64,8 @@ int storage_media_buffer_initialize(
 		return( -1 );
 	}
 	if( ( mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
-	 && ( mode != STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA ) )
+	 && ( mode != STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	 && ( mode != STORAGE_MEDIA_BUFFER_MODE_PACKED_CHUNK_DATA ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -156,7 +157,7 @@ int storage_media_buffer_initialize(
 
 		( *buffer )->raw_buffer_size = size;
 	}
-	if( mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	if( mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
 	{
 		if( libewf_handle_get_data_chunk(
 		     handle,
@@ -301,50 +302,6 @@ int storage_media_buffer_get_data(
 	return( 1 );
 }
 
-/* Compares two storage media buffers
- * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER
- * if successful or -1 on error
- */
-int storage_media_buffer_compare(
-     storage_media_buffer_t *first_buffer,
-     storage_media_buffer_t *second_buffer,
-     libcerror_error_t **error )
-{
-	static char *function = "storage_media_buffer_compare";
-
-	if( first_buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid first buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( second_buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid second buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( first_buffer->storage_media_offset < second_buffer->storage_media_offset )
-	{
-		return( LIBCDATA_COMPARE_LESS ); 
-	}
-	else if( first_buffer->storage_media_offset > second_buffer->storage_media_offset )
-	{
-		return( LIBCDATA_COMPARE_GREATER ); 
-	}
-	return( LIBCDATA_COMPARE_EQUAL ); 
-}
-
 /* Reads a storage media buffer from the input handle
  * Returns the number of bytes read, 0 when no longer data can be read or -1 on error
  */
@@ -379,6 +336,13 @@ ssize_t storage_media_buffer_read_from_handle(
 	                      storage_media_buffer->data_chunk,
 		              error );
 	}
+	else if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_PACKED_CHUNK_DATA )
+	{
+		read_count = libewf_handle_read_packed_data_chunk(
+	                      handle,
+	                      storage_media_buffer->data_chunk,
+		              error );
+	}
 	else
 	{
 		read_count = libewf_handle_read_buffer(
@@ -403,10 +367,76 @@ ssize_t storage_media_buffer_read_from_handle(
 		storage_media_buffer->raw_buffer_data_size = (size_t) read_count;
 	}
 	storage_media_buffer->requested_size = read_size;
+	storage_media_buffer->is_sparse      = 0;
 
 	return( read_count );
 }
 
+/* Sets a storage media buffer to contain a specific number of 0-byte values
+ * This is used instead of reading data that is known to be filled with 0-byte values
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_set_sparse(
+     storage_media_buffer_t *storage_media_buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_set_sparse";
+
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->raw_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid storage media buffer - missing raw buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > storage_media_buffer->raw_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     storage_media_buffer->raw_buffer,
+	     0,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear raw buffer.",
+		 function );
+
+		return( -1 );
+	}
+	storage_media_buffer->raw_buffer_data_size = size;
+	storage_media_buffer->requested_size       = size;
+	storage_media_buffer->is_sparse            = 1;
+
+	return( 1 );
+}
+
 /* Processes a storage media buffer after read
  * Returns the resulting buffer size or -1 on error
  */
@@ -428,13 +458,27 @@ ssize_t storage_media_buffer_read_process(
 
 		return( -1 );
 	}
-	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	if( ( storage_media_buffer->mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
+	 && ( storage_media_buffer->is_sparse == 0 ) )
 	{
-		process_count = libewf_data_chunk_read_buffer(
-		                 storage_media_buffer->data_chunk,
-		                 storage_media_buffer->raw_buffer,
-		                 storage_media_buffer->raw_buffer_size,
-		                 error );
+		/* The packed chunk data is kept as-is so that it can be written without repacking
+		 */
+		if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_PACKED_CHUNK_DATA )
+		{
+			process_count = libewf_data_chunk_read_buffer_from_copy(
+			                 storage_media_buffer->data_chunk,
+			                 storage_media_buffer->raw_buffer,
+			                 storage_media_buffer->raw_buffer_size,
+			                 error );
+		}
+		else
+		{
+			process_count = libewf_data_chunk_read_buffer(
+			                 storage_media_buffer->data_chunk,
+			                 storage_media_buffer->raw_buffer,
+			                 storage_media_buffer->raw_buffer_size,
+			                 error );
+		}
 
 		if( process_count < 0 )
 		{
@@ -546,7 +590,7 @@ ssize_t storage_media_buffer_write_to_handle(
 	{
 		return( 0 );
 	}
-	if( storage_media_buffer->mode == STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA )
+	if( storage_media_buffer->mode != STORAGE_MEDIA_BUFFER_MODE_BUFFERED )
 	{
 		write_count = libewf_handle_write_data_chunk(
 		               handle,
@@ -35,7 +35,8 @@ extern "C" {
 enum STORAGE_MEDIA_BUFFER_MODES
 {
 	STORAGE_MEDIA_BUFFER_MODE_BUFFERED	= 0,
-	STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA	= 1
+	STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA	= 1,
+	STORAGE_MEDIA_BUFFER_MODE_PACKED_CHUNK_DATA	= 2
 };
 
 typedef struct storage_media_buffer storage_media_buffer_t;
@@ -50,6 +51,10 @@ struct storage_media_buffer
 	 */
 	off64_t storage_media_offset;
 
+	/* The sequence number, used to put the buffers back in order after processing
+	 */
+	uint64_t sequence_number;
+
 	/* The raw buffer
 	 */
 	uint8_t *raw_buffer;
@@ -73,6 +78,10 @@ struct storage_media_buffer
 	/* The processed size
 	 */
 	size_t processed_size;
+
+	/* Value to indicate the buffer contains 0-byte values that were not read
+	 */
+	uint8_t is_sparse;
 };
 
 int storage_media_buffer_initialize(
@@ -92,17 +101,17 @@ int storage_media_buffer_get_data(
      size_t *data_size,
      libcerror_error_t **error );
 
-int storage_media_buffer_compare(
-     storage_media_buffer_t *first_buffer,
-     storage_media_buffer_t *second_buffer,
-     libcerror_error_t **error );
-
 ssize_t storage_media_buffer_read_from_handle(
          storage_media_buffer_t *storage_media_buffer,
          libewf_handle_t *handle,
          size_t read_size,
          libcerror_error_t **error );
 
+int storage_media_buffer_set_sparse(
+     storage_media_buffer_t *storage_media_buffer,
+     size_t size,
+     libcerror_error_t **error );
+
 ssize_t storage_media_buffer_read_process(
          storage_media_buffer_t *storage_media_buffer,
          libcerror_error_t **error );
@@ -0,0 +1,682 @@
+/*
+ * Storage media buffer reader
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "storage_media_buffer.h"
+#include "storage_media_buffer_queue.h"
+#include "storage_media_buffer_reader.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a storage media buffer reader
+ * Make sure the value reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_reader_initialize(
+     storage_media_buffer_reader_t **reader,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     int maximum_number_of_read_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_reader_initialize";
+
+	if( reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_read_buffers <= 0 )
+	 || ( maximum_number_of_read_buffers > (int) ( INT_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of read buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*reader = memory_allocate_structure(
+	           storage_media_buffer_reader_t );
+
+	if( *reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *reader,
+	     0,
+	     sizeof( storage_media_buffer_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear reader.",
+		 function );
+
+		memory_free(
+		 *reader );
+
+		*reader = NULL;
+
+		return( -1 );
+	}
+	if( libcthreads_queue_initialize(
+	     &( ( *reader )->read_queue ),
+	     maximum_number_of_read_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	/* The end of input buffer does not contain data it only
+	 * signals that the read thread has stopped
+	 */
+	if( storage_media_buffer_initialize(
+	     &( ( *reader )->end_of_input_buffer ),
+	     NULL,
+	     STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create end of input buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *reader )->storage_media_buffer_queue = storage_media_buffer_queue;
+
+	return( 1 );
+
+on_error:
+	if( *reader != NULL )
+	{
+		if( ( *reader )->read_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( ( *reader )->read_queue ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *reader );
+
+		*reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a storage media buffer reader
+ * The read thread is stopped if it is still running
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_reader_free(
+     storage_media_buffer_reader_t **reader,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_reader_free";
+	int result            = 1;
+
+	if( reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *reader != NULL )
+	{
+		if( storage_media_buffer_reader_stop(
+		     *reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop reader.",
+			 function );
+
+			result = -1;
+		}
+		/* The buffers in the read queue are owned by the storage media buffer queue
+		 */
+		if( libcthreads_queue_free(
+		     &( ( *reader )->read_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read queue.",
+			 function );
+
+			result = -1;
+		}
+		if( storage_media_buffer_free(
+		     &( ( *reader )->end_of_input_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free end of input buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *reader )->read_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *reader )->read_error ) );
+		}
+		memory_free(
+		 *reader );
+
+		*reader = NULL;
+	}
+	return( result );
+}
+
+/* Reads the input into storage media buffers
+ * This function is run by the read thread, it always ends with pushing
+ * the end of input buffer onto the read queue
+ * Reading stops at the end of the input or when the size has been read
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_reader_read_thread_function(
+     storage_media_buffer_reader_t *reader )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "storage_media_buffer_reader_read_thread_function";
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	int result                                   = 1;
+
+	if( reader == NULL )
+	{
+		return( -1 );
+	}
+	while( ( reader->size == 0 )
+	    || ( reader->remaining_size > 0 ) )
+	{
+		if( reader->abort != 0 )
+		{
+			break;
+		}
+		if( storage_media_buffer_queue_grab_buffer(
+		     reader->storage_media_buffer_queue,
+		     &storage_media_buffer,
+		     &( reader->read_error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( reader->read_error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab storage media buffer from queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( storage_media_buffer == NULL )
+		{
+			libcerror_error_set(
+			 &( reader->read_error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing storage media buffer.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		/* The abort can be signalled while waiting for a storage media buffer
+		 */
+		if( reader->abort != 0 )
+		{
+			break;
+		}
+		read_size = reader->read_size;
+
+		if( ( reader->size != 0 )
+		 && ( reader->remaining_size < (size64_t) read_size ) )
+		{
+			read_size = (size_t) reader->remaining_size;
+		}
+		read_count = reader->read_function(
+		              reader->input_handle,
+		              storage_media_buffer,
+		              reader->storage_media_offset,
+		              read_size,
+		              &( reader->read_error ) );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 &( reader->read_error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: error reading data from input.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		if( libcthreads_queue_push(
+		     reader->read_queue,
+		     (intptr_t *) storage_media_buffer,
+		     &( reader->read_error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( reader->read_error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push storage media buffer onto read queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		storage_media_buffer = NULL;
+
+		reader->storage_media_offset += read_count;
+
+		if( reader->size != 0 )
+		{
+			reader->remaining_size -= read_count;
+		}
+	}
+	if( storage_media_buffer != NULL )
+	{
+		if( storage_media_buffer_queue_release_buffer(
+		     reader->storage_media_buffer_queue,
+		     storage_media_buffer,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( libcthreads_queue_push(
+	     reader->read_queue,
+	     (intptr_t *) reader->end_of_input_buffer,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+/* Starts reading the input on the read thread
+ * A size of 0 represents that the input is read until its end
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_reader_start(
+     storage_media_buffer_reader_t *reader,
+     intptr_t *input_handle,
+     ssize_t (*read_function)(
+                intptr_t *input_handle,
+                storage_media_buffer_t *storage_media_buffer,
+                off64_t storage_media_offset,
+                size_t read_size,
+                libcerror_error_t **error ),
+     off64_t storage_media_offset,
+     size64_t size,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_reader_start";
+
+	if( reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( reader->read_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid reader - read thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid storage media offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_size == 0 )
+	 || ( read_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	reader->input_handle         = input_handle;
+	reader->read_function        = read_function;
+	reader->storage_media_offset = storage_media_offset;
+	reader->size                 = size;
+	reader->remaining_size       = size;
+	reader->read_size            = read_size;
+	reader->end_of_input         = 0;
+	reader->abort                = 0;
+
+	if( libcthreads_thread_create(
+	     &( reader->read_thread ),
+	     NULL,
+	     (int (*)(void *)) &storage_media_buffer_reader_read_thread_function,
+	     (void *) reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the read thread
+ * The storage media buffers that were read but not grabbed are released
+ * onto the storage media buffer queue
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_reader_stop(
+     storage_media_buffer_reader_t *reader,
+     libcerror_error_t **error )
+{
+	intptr_t *value       = NULL;
+	static char *function = "storage_media_buffer_reader_stop";
+
+	if( reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( reader->read_thread == NULL )
+	{
+		return( 1 );
+	}
+	reader->abort = 1;
+
+	/* Keep releasing the storage media buffers until the read thread
+	 * has pushed the end of input buffer, otherwise it can block waiting
+	 * for a storage media buffer
+	 */
+	while( reader->end_of_input == 0 )
+	{
+		if( libcthreads_queue_pop(
+		     reader->read_queue,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop storage media buffer from read queue.",
+			 function );
+
+			return( -1 );
+		}
+		if( value == (intptr_t *) reader->end_of_input_buffer )
+		{
+			reader->end_of_input = 1;
+		}
+		else if( storage_media_buffer_queue_release_buffer(
+		          reader->storage_media_buffer_queue,
+		          (storage_media_buffer_t *) value,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release storage media buffer onto queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_thread_join(
+	     &( reader->read_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join read thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( reader->read_error != NULL )
+	{
+		libcerror_error_free(
+		 &( reader->read_error ) );
+	}
+	return( 1 );
+}
+
+/* Grabs a storage media buffer that was read
+ * Returns 1 if successful, 0 if no more storage media buffers are available or -1 on error
+ */
+int storage_media_buffer_reader_grab_buffer(
+     storage_media_buffer_reader_t *reader,
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	intptr_t *value       = NULL;
+	static char *function = "storage_media_buffer_reader_grab_buffer";
+
+	if( reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( reader->read_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid reader - missing read thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( reader->end_of_input != 0 )
+	{
+		return( 0 );
+	}
+	if( libcthreads_queue_pop(
+	     reader->read_queue,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop storage media buffer from read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( value != (intptr_t *) reader->end_of_input_buffer )
+	{
+		*buffer = (storage_media_buffer_t *) value;
+
+		return( 1 );
+	}
+	reader->end_of_input = 1;
+
+	if( reader->read_error != NULL )
+	{
+		/* Hand over the error of the read thread
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = reader->read_error;
+
+			reader->read_error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
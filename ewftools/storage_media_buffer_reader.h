@@ -0,0 +1,146 @@
+/*
+ * Storage media buffer reader
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _STORAGE_MEDIA_BUFFER_READER_H )
+#define _STORAGE_MEDIA_BUFFER_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "storage_media_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct storage_media_buffer_reader storage_media_buffer_reader_t;
+
+/* The storage media buffer reader reads the input ahead on a separate thread
+ * so that reading the input overlaps with processing the data
+ */
+struct storage_media_buffer_reader
+{
+	/* The storage media buffer queue the buffers are grabbed from
+	 */
+	libcthreads_queue_t *storage_media_buffer_queue;
+
+	/* The queue of buffers that have been read
+	 */
+	libcthreads_queue_t *read_queue;
+
+	/* The buffer that signals the end of the input
+	 */
+	storage_media_buffer_t *end_of_input_buffer;
+
+	/* The read thread
+	 */
+	libcthreads_thread_t *read_thread;
+
+	/* The input handle
+	 */
+	intptr_t *input_handle;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           intptr_t *input_handle,
+	           storage_media_buffer_t *storage_media_buffer,
+	           off64_t storage_media_offset,
+	           size_t read_size,
+	           libcerror_error_t **error );
+
+	/* The storage media offset
+	 */
+	off64_t storage_media_offset;
+
+	/* The size, where 0 represents read until the end of input
+	 */
+	size64_t size;
+
+	/* The remaining size
+	 */
+	size64_t remaining_size;
+
+	/* The (maximum) read size
+	 */
+	size_t read_size;
+
+	/* The error of the read thread
+	 */
+	libcerror_error_t *read_error;
+
+	/* Value to indicate the end of input buffer was grabbed
+	 */
+	int end_of_input;
+
+	/* Value to indicate the read thread should abort
+	 */
+	int abort;
+};
+
+int storage_media_buffer_reader_initialize(
+     storage_media_buffer_reader_t **reader,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     int maximum_number_of_read_buffers,
+     libcerror_error_t **error );
+
+int storage_media_buffer_reader_free(
+     storage_media_buffer_reader_t **reader,
+     libcerror_error_t **error );
+
+int storage_media_buffer_reader_read_thread_function(
+     storage_media_buffer_reader_t *reader );
+
+int storage_media_buffer_reader_start(
+     storage_media_buffer_reader_t *reader,
+     intptr_t *input_handle,
+     ssize_t (*read_function)(
+                intptr_t *input_handle,
+                storage_media_buffer_t *storage_media_buffer,
+                off64_t storage_media_offset,
+                size_t read_size,
+                libcerror_error_t **error ),
+     off64_t storage_media_offset,
+     size64_t size,
+     size_t read_size,
+     libcerror_error_t **error );
+
+int storage_media_buffer_reader_stop(
+     storage_media_buffer_reader_t *reader,
+     libcerror_error_t **error );
+
+int storage_media_buffer_reader_grab_buffer(
+     storage_media_buffer_reader_t *reader,
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _STORAGE_MEDIA_BUFFER_READER_H ) */
+
@@ -39,6 +39,7 @@
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
 #include "ewftools_system_string.h"
+#include "input_handle_pool.h"
 #include "log_handle.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
@@ -292,6 +293,24 @@ int verification_handle_free(
 
 			result = -1;
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *verification_handle )->digest_hash_threads != NULL )
+		{
+			if( digest_hash_threads_free(
+			     &( ( *verification_handle )->digest_hash_threads ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest hash threads.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( ( *verification_handle )->md5_context != NULL )
 		{
 			if( libhmac_md5_free(
@@ -370,6 +389,27 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->stored_sha256_hash_string );
 		}
+		if( ( *verification_handle )->chunk_hash_map != NULL )
+		{
+			if( chunk_hash_map_free(
+			     &( ( *verification_handle )->chunk_hash_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk hash map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->region_mismatches != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->region_mismatches );
+		}
 		memory_free(
 		 *verification_handle );
 
@@ -760,9 +800,98 @@ int verification_handle_initialize_integrity_hash(
 		}
 		verification_handle->sha256_context_initialized = 1;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Each digest hash is updated on its own thread when multiple are calculated
+	 */
+	if( ( verification_handle->number_of_threads != 0 )
+	 && ( ( verification_handle->calculate_md5 + verification_handle->calculate_sha1 + verification_handle->calculate_sha256 ) > 1 ) )
+	{
+		if( digest_hash_threads_initialize(
+		     &( verification_handle->digest_hash_threads ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest hash threads.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle->calculate_md5 != 0 )
+		{
+			if( digest_hash_threads_append_digest(
+			     verification_handle->digest_hash_threads,
+			     (intptr_t *) verification_handle->md5_context,
+			     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append MD5 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( verification_handle->calculate_sha1 != 0 )
+		{
+			if( digest_hash_threads_append_digest(
+			     verification_handle->digest_hash_threads,
+			     (intptr_t *) verification_handle->sha1_context,
+			     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha1_update,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append SHA1 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( verification_handle->calculate_sha256 != 0 )
+		{
+			if( digest_hash_threads_append_digest(
+			     verification_handle->digest_hash_threads,
+			     (intptr_t *) verification_handle->sha256_context,
+			     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha256_update,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append SHA256 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#endif
 	return( 1 );
 
 on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->digest_hash_threads != NULL )
+	{
+		digest_hash_threads_free(
+		 &( verification_handle->digest_hash_threads ),
+		 NULL );
+	}
+#endif
+	if( verification_handle->sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &( verification_handle->sha256_context ),
+		 NULL );
+	}
 	if( verification_handle->sha1_context != NULL )
 	{
 		libhmac_sha1_free(
@@ -823,6 +952,27 @@ int verification_handle_update_integrity_hash(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->digest_hash_threads != NULL )
+	{
+		if( digest_hash_threads_update(
+		     verification_handle->digest_hash_threads,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
 	if( verification_handle->calculate_md5 != 0 )
 	{
 		if( libhmac_md5_update(
@@ -904,6 +1054,24 @@ int verification_handle_finalize_integrity_hash(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->digest_hash_threads != NULL )
+	{
+		if( digest_hash_threads_free(
+		     &( verification_handle->digest_hash_threads ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest hash threads.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
 	if( verification_handle->calculate_md5 != 0 )
 	{
 		if( verification_handle->calculated_md5_hash_string == NULL )
@@ -1203,12 +1371,11 @@ int verification_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      verification_handle_t *verification_handle )
 {
-	libcdata_list_element_t *element      = NULL;
-	libcdata_list_element_t *next_element = NULL;
         libcerror_error_t *error              = NULL;
 	uint8_t *data                         = NULL;
         static char *function                 = "verification_handle_process_storage_media_buffer_callback";
 	size_t data_size                      = 0;
+	int result                            = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -1232,68 +1399,41 @@ int verification_handle_output_storage_media_buffer_callback(
 
 		goto on_error;
 	}
-	if( libcdata_list_insert_value(
-	     verification_handle->output_list,
-	     (intptr_t *) storage_media_buffer,
-	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &storage_media_buffer_compare,
-	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	if( storage_media_buffer_ring_insert_buffer(
+	     verification_handle->output_ring,
+	     storage_media_buffer,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert storage media buffer into output list.",
+		 "%s: unable to insert storage media buffer into output ring.",
 		 function );
 
 		goto on_error;
 	}
 	storage_media_buffer = NULL;
 
-	if( libcdata_list_get_first_element(
-	     verification_handle->output_list,
-	     &element,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
-		 function );
-
-		goto on_error;
-	}
-	while( element != NULL )
+	while( 1 )
 	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
-			 function );
+		result = storage_media_buffer_ring_remove_next_buffer(
+		          verification_handle->output_ring,
+		          &storage_media_buffer,
+		          &error );
 
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( storage_media_buffer == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove next storage media buffer from output ring.",
 			 function );
 
 			goto on_error;
 		}
-		if( storage_media_buffer->storage_media_offset != verification_handle->last_offset_hashed )
+		else if( result == 0 )
 		{
 			break;
 		}
@@ -1310,8 +1450,6 @@ int verification_handle_output_storage_media_buffer_callback(
 			 "%s: unable to determine storage media buffer data.",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
 		if( verification_handle_update_integrity_hash(
@@ -1327,62 +1465,10 @@ int verification_handle_output_storage_media_buffer_callback(
 			 "%s: unable to update integrity hash(es).",
 			 function );
 
-			storage_media_buffer = NULL;
-
 			goto on_error;
 		}
 		verification_handle->last_offset_hashed = storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size;
 
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		if( libcdata_list_remove_element(
-		     verification_handle->output_list,
-		     element,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			storage_media_buffer = NULL;
-
-			goto on_error;
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
-			goto on_error;
-		}
-		element = next_element;
-
 		if( storage_media_buffer_queue_release_buffer(
 		     verification_handle->storage_media_buffer_queue,
 		     storage_media_buffer,
@@ -1452,17 +1538,16 @@ on_error:
 	return( -1 );
 }
 
-/* Empties the output list
+/* Empties the output ring
  * Returns 1 if successful or -1 on error
  */
-int verification_handle_empty_output_list(
+int verification_handle_empty_output_ring(
      verification_handle_t *verification_handle,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *element             = NULL;
-	libcdata_list_element_t *next_element        = NULL;
 	storage_media_buffer_t *storage_media_buffer = NULL;
-        static char *function                        = "verification_handle_empty_output_list";
+        static char *function                        = "verification_handle_empty_output_ring";
+	int result                                   = 1;
 
 	if( verification_handle == NULL )
 	{
@@ -1475,113 +1560,47 @@ int verification_handle_empty_output_list(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     verification_handle->output_list,
-	     &element,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
-		 function );
-
-		return( -1 );
-	}
-	while( element != NULL )
+	while( result == 1 )
 	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
-			 function );
+		result = storage_media_buffer_ring_remove_buffer(
+		          verification_handle->output_ring,
+		          &storage_media_buffer,
+		          error );
 
-			return( -1 );
-		}
-		if( storage_media_buffer == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove storage media buffer from output ring.",
 			 function );
 
 			return( -1 );
 		}
-		if( storage_media_buffer_queue_release_buffer(
-		     verification_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     error ) != 1 )
+		else if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to release storage media buffer onto queue.",
-			 function );
+			if( storage_media_buffer_queue_release_buffer(
+			     verification_handle->storage_media_buffer_queue,
+			     storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to release storage media buffer onto queue.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
+			storage_media_buffer = NULL;
 		}
-		storage_media_buffer = NULL;
-
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
+	}
+	return( 1 );
+}
 
-			return( -1 );
-		}
-		if( libcdata_list_remove_element(
-		     verification_handle->output_list,
-		     element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
-
-			return( -1 );
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
-			return( -1 );
-		}
-		element = next_element;
-	}
-	return( 1 );
-}
-
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 /* Verifies the input
  * Returns 1 if successful, 0 if not or -1 on error
@@ -1597,6 +1616,7 @@ int verification_handle_verify_input(
 	static char *function                        = "verification_handle_verify_input";
 	off64_t storage_media_offset                 = 0;
 	size64_t remaining_media_size                = 0;
+	uint64_t sequence_number                     = 0;
 	size_t data_size                             = 0;
 	size_t process_buffer_size                   = 0;
 	size_t read_size                             = 0;
@@ -1740,15 +1760,16 @@ int verification_handle_verify_input(
 
 			goto on_error;
 		}
-		if( libcdata_list_initialize(
-		     &( verification_handle->output_list ),
+		if( storage_media_buffer_ring_initialize(
+		     &( verification_handle->output_ring ),
+		     maximum_number_of_queued_items,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create output list.",
+			 "%s: unable to create output ring.",
 			 function );
 
 			goto on_error;
@@ -1816,6 +1837,25 @@ int verification_handle_verify_input(
 
 		goto on_error;
 	}
+	verification_handle->last_offset_hashed = 0;
+
+	/* The input is read sequentially from the start of the media
+	 */
+	if( libewf_handle_seek_offset(
+	     verification_handle->input_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of input.",
+		 function );
+
+		goto on_error;
+	}
 	if( verification_handle->number_of_threads == 0 )
 	{
 		if( storage_media_buffer_initialize(
@@ -1915,6 +1955,10 @@ int verification_handle_verify_input(
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( verification_handle->number_of_threads != 0 )
 		{
+			storage_media_buffer->sequence_number = sequence_number;
+
+			sequence_number++;
+
 			if( libcthreads_thread_pool_push(
 			     verification_handle->process_thread_pool,
 			     (intptr_t *) storage_media_buffer,
@@ -2069,9 +2113,9 @@ int verification_handle_verify_input(
 			goto on_error;
 		}
 	}
-	if( verification_handle->output_list != NULL )
+	if( verification_handle->output_ring != NULL )
 	{
-		if( verification_handle_empty_output_list(
+		if( verification_handle_empty_output_ring(
 		     verification_handle,
 		     error ) != 1 )
 		{
@@ -2079,21 +2123,20 @@ int verification_handle_verify_input(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty output list.",
+			 "%s: unable to empty output ring.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcdata_list_free(
-		     &( verification_handle->output_list ),
-		     NULL,
+		if( storage_media_buffer_ring_free(
+		     &( verification_handle->output_ring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
+			 "%s: unable to free output ring.",
 			 function );
 
 			goto on_error;
@@ -2369,14 +2412,13 @@ on_error:
 		 &( verification_handle->output_thread_pool ),
 		 NULL );
 	}
-	if( verification_handle->output_list != NULL )
+	if( verification_handle->output_ring != NULL )
 	{
-		verification_handle_empty_output_list(
+		verification_handle_empty_output_ring(
 		 verification_handle,
 		 NULL );
-		libcdata_list_free(
-		 &( verification_handle->output_list ),
-		 NULL,
+		storage_media_buffer_ring_free(
+		 &( verification_handle->output_ring ),
 		 NULL );
 	}
 	if( verification_handle->storage_media_buffer_queue != NULL )
@@ -2389,19 +2431,15 @@ on_error:
 	return( -1 );
 }
 
-/* Verifies single files
- * Returns 1 if successful, 0 if not or -1 on error
+/* Reads the chunk hash map
+ * Returns 1 if successful or -1 on error
  */
-int verification_handle_verify_single_files(
+int verification_handle_read_chunk_hash_map(
      verification_handle_t *verification_handle,
-     uint8_t print_status_information,
-     log_handle_t *log_handle,
+     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	libewf_file_entry_t *file_entry    = NULL;
-	static char *function              = "verification_handle_verify_single_files";
-	uint32_t number_of_checksum_errors = 0;
-	int result                         = 0;
+	static char *function = "verification_handle_read_chunk_hash_map";
 
 	if( verification_handle == NULL )
 	{
@@ -2414,180 +2452,60 @@ int verification_handle_verify_single_files(
 
 		return( -1 );
 	}
-	if( libewf_handle_get_root_file_entry(
-	     verification_handle->input_handle,
-	     &file_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root file entry.",
-		 function );
-
-		goto on_error;
-	}
-	if( process_status_initialize(
-	     &( verification_handle->process_status ),
-	     _SYSTEM_STRING( "Verify" ),
-	     _SYSTEM_STRING( "verified" ),
-	     _SYSTEM_STRING( "Read" ),
-	     verification_handle->notify_stream,
-	     print_status_information,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create process status.",
-		 function );
-
-		goto on_error;
-	}
-	if( process_status_start(
-	     verification_handle->process_status,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to start process status.",
-		 function );
-
-		goto on_error;
-	}
-	result = verification_handle_verify_file_entry(
-	          verification_handle,
-	          file_entry,
-	          _SYSTEM_STRING( "" ),
-	          0,
-	          log_handle,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to verify root file entry.",
-		 function );
-
-		goto on_error;
-	}
-	if( process_status_stop(
-	     verification_handle->process_status,
-	     0,
-	     PROCESS_STATUS_COMPLETED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to stop process status.",
-		 function );
-
-		goto on_error;
-	}
-	if( process_status_free(
-	     &( verification_handle->process_status ),
-	     error ) != 1 )
+	if( verification_handle->chunk_hash_map != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free process status.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - chunk hash map value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libewf_file_entry_free(
-	     &file_entry,
+	if( chunk_hash_map_read_file(
+	     &( verification_handle->chunk_hash_map ),
+	     filename,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root file entry.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_handle_get_number_of_checksum_errors(
-	     verification_handle->input_handle,
-	     &number_of_checksum_errors,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve the number of checksum errors.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk hash map.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( result != 0 )
-	 && ( number_of_checksum_errors == 0 ) )
-	{
-		return( 1 );
-	}
-	return( 0 );
-
-on_error:
-	if( verification_handle->process_status != NULL )
-	{
-		process_status_stop(
-		 verification_handle->process_status,
-		 0,
-		 PROCESS_STATUS_FAILED,
-		 NULL );
-		process_status_free(
-		 &( verification_handle->process_status ),
-		 NULL );
-	}
-	if( file_entry != NULL )
-	{
-		libewf_file_entry_free(
-		 &file_entry,
-		 NULL );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Verifies a (single) file entry
- * Returns 1 if successful, 0 if not or -1 on error
+/* Verifies the chunks in a range of the input
+ * The chunk data is read, decompressed and its checksum validated by libewf,
+ * chunks that fail validation are tracked as checksum errors of the input handle
+ * If a chunk hash map is set the digest hash of every region in the range
+ * is compared with the chunk hash map, the range must be region aligned
+ * Returns 1 if successful or -1 on error
  */
-int verification_handle_verify_file_entry(
+int verification_handle_verify_range(
      verification_handle_t *verification_handle,
-     libewf_file_entry_t *file_entry,
-     const system_character_t *file_entry_path,
-     size_t file_entry_path_length,
-     log_handle_t *log_handle,
+     libewf_handle_t *input_handle,
+     off64_t range_offset,
+     size64_t range_size,
      libcerror_error_t **error )
 {
-	system_character_t *name        = NULL;
-	system_character_t *target_path = NULL;
-	uint8_t *file_entry_data        = NULL;
-	static char *function           = "verification_handle_verify_file_entry";
-	size64_t file_entry_data_size   = 0;
-	size_t name_size                = 0;
-	size_t process_buffer_size      = 0;
-	size_t read_size                = 0;
-	size_t target_path_size         = 0;
-	ssize_t read_count              = 0;
-	uint8_t file_entry_type         = 0;
-	int md5_hash_compare            = 0;
-	int result                      = 0;
-	int return_value                = 0;
-	int sha1_hash_compare           = 0;
-	int sha256_hash_compare         = 0;
+	uint8_t calculated_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	libhmac_md5_context_t *md5_context = NULL;
+	uint8_t *buffer                    = NULL;
+	static char *function              = "verification_handle_verify_range";
+	size64_t region_remaining_size     = 0;
+	size_t buffer_size                 = 0;
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	uint64_t region_index              = 0;
+	uint8_t region_read_failed         = 0;
+	int result                         = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -2611,444 +2529,3114 @@ int verification_handle_verify_file_entry(
 
 		return( -1 );
 	}
-	if( verification_handle->chunk_size > (size32_t) INT32_MAX )
+	if( ( verification_handle->chunk_hash_map != NULL )
+	 && ( verification_handle->region_mismatches == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid chunk size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing region mismatches.",
 		 function );
 
 		return( -1 );
 	}
-	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	if( input_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid process buffer size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libewf_file_entry_get_utf16_name_size(
-		  file_entry,
-		  &name_size,
-		  error );
-#else
-	result = libewf_file_entry_get_utf8_name_size(
-		  file_entry,
-		  &name_size,
-		  error );
-#endif
-	if( result != 1 )
+	if( range_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve the name.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( name_size > 0 )
+	if( verification_handle->process_buffer_size == 0 )
 	{
-		name = system_string_allocate(
-			name_size );
+		buffer_size = verification_handle->chunk_size;
+	}
+	else
+	{
+		buffer_size = verification_handle->process_buffer_size;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
 
-		if( name == NULL )
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->chunk_hash_map != NULL )
+	{
+		region_index = (uint64_t) range_offset / verification_handle->chunk_hash_map->region_size;
+	}
+	while( range_size > 0 )
+	{
+		if( verification_handle->abort != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create name.",
-			 function );
+			break;
+		}
+		read_size = buffer_size;
 
-			goto on_error;
+		if( range_size < (size64_t) read_size )
+		{
+			read_size = (size_t) range_size;
+		}
+		if( verification_handle->chunk_hash_map != NULL )
+		{
+			if( md5_context == NULL )
+			{
+				if( libhmac_md5_initialize(
+				     &md5_context,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to initialize MD5 context.",
+					 function );
+
+					goto on_error;
+				}
+				region_remaining_size = verification_handle->chunk_hash_map->region_size;
+				region_read_failed    = 0;
+			}
+			if( region_remaining_size < (size64_t) read_size )
+			{
+				read_size = (size_t) region_remaining_size;
+			}
+		}
+		read_count = libewf_handle_read_buffer_at_offset(
+		              input_handle,
+		              buffer,
+		              read_size,
+		              range_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			/* Track the unreadable data as a checksum error
+			 */
+			if( libewf_handle_append_checksum_error(
+			     input_handle,
+			     (uint64_t) range_offset / verification_handle->bytes_per_sector,
+			     (uint64_t) read_size / verification_handle->bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append checksum error.",
+				 function );
+
+				goto on_error;
+			}
+			read_count         = (ssize_t) read_size;
+			region_read_failed = 1;
+		}
+		else if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 range_offset,
+			 range_offset );
+
+			goto on_error;
+		}
+		else if( md5_context != NULL )
+		{
+			if( libhmac_md5_update(
+			     md5_context,
+			     buffer,
+			     (size_t) read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		range_offset += (off64_t) read_count;
+		range_size   -= (size64_t) read_count;
+
+		if( md5_context != NULL )
+		{
+			region_remaining_size -= (size64_t) read_count;
+
+			/* The last region of the media can be smaller than the region size
+			 */
+			if( ( region_remaining_size == 0 )
+			 || ( (size64_t) range_offset >= verification_handle->media_size ) )
+			{
+				if( libhmac_md5_finalize(
+				     md5_context,
+				     calculated_md5_hash,
+				     LIBHMAC_MD5_HASH_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to finalize MD5 hash.",
+					 function );
+
+					goto on_error;
+				}
+				if( libhmac_md5_free(
+				     &md5_context,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free MD5 context.",
+					 function );
+
+					goto on_error;
+				}
+				result = 0;
+
+				if( region_read_failed == 0 )
+				{
+					result = chunk_hash_map_compare_digest_hash(
+					          verification_handle->chunk_hash_map,
+					          region_index,
+					          calculated_md5_hash,
+					          LIBHMAC_MD5_HASH_SIZE,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compare digest hash of region: %" PRIu64 ".",
+						 function,
+						 region_index );
+
+						goto on_error;
+					}
+				}
+				/* Every region is only verified by a single thread
+				 */
+				verification_handle->region_mismatches[ region_index ] = (uint8_t) ( result == 0 );
+
+				region_index++;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( verification_handle->process_status_mutex != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     verification_handle->process_status_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab process status mutex.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		verification_handle->last_offset_hashed += (off64_t) read_count;
+
+		result = process_status_update(
+		          verification_handle->process_status,
+		          verification_handle->last_offset_hashed,
+		          verification_handle->media_size,
+		          error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( verification_handle->process_status_mutex != NULL )
+		{
+			if( libcthreads_mutex_release(
+			     verification_handle->process_status_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release process status mutex.",
+				 function );
+
+				goto on_error;
+			}
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libewf_file_entry_get_utf16_name(
-			  file_entry,
-			  (uint16_t *) name,
-			  name_size,
-			  error );
-#else
-		result = libewf_file_entry_get_utf8_name(
-			  file_entry,
-			  (uint8_t *) name,
-			  name_size,
-			  error );
 #endif
 		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the name.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update process status.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( md5_context != NULL )
+	{
+		if( libhmac_md5_free(
+		     &md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
 			 function );
 
-			memory_free(
-			 name );
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Verifies the chunks in a range of the input on a separate thread
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_verify_range_thread_function(
+     verification_range_t *verification_range )
+{
+	static char *function = "verification_handle_verify_range_thread_function";
+	int result            = 0;
+
+	if( verification_range == NULL )
+	{
+		return( -1 );
+	}
+	result = verification_handle_verify_range(
+	          verification_range->verification_handle,
+	          verification_range->input_handle,
+	          verification_range->range_offset,
+	          verification_range->range_size,
+	          &( verification_range->verify_error ) );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &( verification_range->verify_error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify range.",
+		 function );
+
+		/* Stop the other threads
+		 */
+		verification_range->verification_handle->abort = 1;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Verifies the chunks of the input without calculating the integrity hash(es)
+ * The input is split into contiguous chunk aligned ranges that are verified
+ * in parallel on clones of the input handle when multi-threading is used
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_chunks(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	verification_range_t *verification_ranges = NULL;
+	static char *function                     = "verification_handle_verify_chunks";
+	size64_t range_size                       = 0;
+	size64_t unit_size                        = 0;
+	uint64_t number_of_units                  = 0;
+	uint64_t start_sector                     = 0;
+	uint64_t number_of_sectors                = 0;
+	uint32_t checksum_error_index             = 0;
+	uint32_t number_of_checksum_errors        = 0;
+	int has_region_mismatches                 = 0;
+	int is_corrupted                          = 0;
+	int number_of_ranges                      = 1;
+	int range_index                           = 0;
+	int status                                = PROCESS_STATUS_COMPLETED;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->number_of_threads != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_handle_get_media_size(
+	     verification_handle->input_handle,
+	     &( verification_handle->media_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The ranges are aligned to the regions of the chunk hash map if set
+	 * otherwise to the chunks
+	 */
+	if( verification_handle->chunk_hash_map != NULL )
+	{
+		if( verification_handle->chunk_hash_map->media_size != verification_handle->media_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: media size of chunk hash map does not match media size.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle->region_mismatches != NULL )
+		{
+			memory_free(
+			 verification_handle->region_mismatches );
+
+			verification_handle->region_mismatches = NULL;
+		}
+		if( verification_handle->chunk_hash_map->number_of_regions > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid chunk hash map - number of regions value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle->chunk_hash_map->number_of_regions > 0 )
+		{
+			verification_handle->region_mismatches = (uint8_t *) memory_allocate(
+			                                                      sizeof( uint8_t ) * (size_t) verification_handle->chunk_hash_map->number_of_regions );
+
+			if( verification_handle->region_mismatches == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create region mismatches.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     verification_handle->region_mismatches,
+			     0,
+			     sizeof( uint8_t ) * (size_t) verification_handle->chunk_hash_map->number_of_regions ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear region mismatches.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		unit_size = verification_handle->chunk_hash_map->region_size;
+	}
+	else
+	{
+		unit_size = verification_handle->chunk_size;
+	}
+	number_of_units = verification_handle->media_size / unit_size;
+
+	if( ( verification_handle->media_size % unit_size ) != 0 )
+	{
+		number_of_units += 1;
+	}
+	if( verification_handle->number_of_threads > 1 )
+	{
+		number_of_ranges = verification_handle->number_of_threads;
+
+		if( (uint64_t) number_of_ranges > number_of_units )
+		{
+			number_of_ranges = (int) number_of_units;
+		}
+		if( number_of_ranges < 1 )
+		{
+			number_of_ranges = 1;
+		}
+	}
+	verification_ranges = (verification_range_t *) memory_allocate(
+	                                                sizeof( verification_range_t ) * number_of_ranges );
+
+	if( verification_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verification ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verification_ranges,
+	     0,
+	     sizeof( verification_range_t ) * number_of_ranges ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verification ranges.",
+		 function );
+
+		memory_free(
+		 verification_ranges );
+
+		verification_ranges = NULL;
+
+		goto on_error;
+	}
+	/* Every range but the last one covers the same number of chunks or regions
+	 */
+	range_size = ( number_of_units / number_of_ranges ) * unit_size;
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		verification_ranges[ range_index ].verification_handle = verification_handle;
+		verification_ranges[ range_index ].range_offset        = (off64_t) range_index * range_size;
+
+		if( range_index == ( number_of_ranges - 1 ) )
+		{
+			verification_ranges[ range_index ].range_size = verification_handle->media_size
+			                                              - (size64_t) verification_ranges[ range_index ].range_offset;
+		}
+		else
+		{
+			verification_ranges[ range_index ].range_size = range_size;
+		}
+	}
+	if( process_status_initialize(
+	     &( verification_handle->process_status ),
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     verification_handle->process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+	verification_handle->last_offset_hashed = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_ranges > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( verification_handle->process_status_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create process status mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* Clone the input handle for every range before any of the threads starts reading
+		 */
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libewf_handle_clone(
+			     &( verification_ranges[ range_index ].input_handle ),
+			     verification_handle->input_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone input handle: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( verification_ranges[ range_index ].thread ),
+			     NULL,
+			     (int (*)(void *)) &verification_handle_verify_range_thread_function,
+			     (void *) &( verification_ranges[ range_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( verification_ranges[ range_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( verification_ranges[ range_index ].verify_error != NULL )
+			{
+				*error = verification_ranges[ range_index ].verify_error;
+
+				verification_ranges[ range_index ].verify_error = NULL;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			/* Merge the checksum errors of the clone into the input handle
+			 */
+			if( libewf_handle_get_number_of_checksum_errors(
+			     verification_ranges[ range_index ].input_handle,
+			     &number_of_checksum_errors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of checksum errors of range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			for( checksum_error_index = 0;
+			     checksum_error_index < number_of_checksum_errors;
+			     checksum_error_index++ )
+			{
+				if( libewf_handle_get_checksum_error(
+				     verification_ranges[ range_index ].input_handle,
+				     checksum_error_index,
+				     &start_sector,
+				     &number_of_sectors,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve checksum error: %" PRIu32 " of range: %d.",
+					 function,
+					 checksum_error_index,
+					 range_index );
+
+					goto on_error;
+				}
+				if( libewf_handle_append_checksum_error(
+				     verification_handle->input_handle,
+				     start_sector,
+				     number_of_sectors,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append checksum error.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libewf_handle_free(
+			     &( verification_ranges[ range_index ].input_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input handle of range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( verification_handle->process_status_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free process status mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		if( verification_handle_verify_range(
+		     verification_handle,
+		     verification_handle->input_handle,
+		     verification_ranges[ 0 ].range_offset,
+		     verification_ranges[ 0 ].range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 verification_ranges );
+
+	verification_ranges = NULL;
+
+	if( verification_handle->abort != 0 )
+	{
+		status = PROCESS_STATUS_ABORTED;
+	}
+	if( process_status_stop(
+	     verification_handle->process_status,
+	     verification_handle->last_offset_hashed,
+	     status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_free(
+	     &( verification_handle->process_status ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->abort == 0 )
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "\n" );
+
+		if( verification_handle_checksum_errors_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print checksum errors.",
+			 function );
+
+			goto on_error;
+		}
+		has_region_mismatches = verification_handle_region_mismatches_fprint(
+		                         verification_handle,
+		                         verification_handle->notify_stream,
+		                         error );
+
+		if( has_region_mismatches == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print region mismatches.",
+			 function );
+
+			goto on_error;
+		}
+		if( log_handle != NULL )
+		{
+			if( verification_handle_checksum_errors_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print checksum errors in log handle.",
+				 function );
+
+				goto on_error;
+			}
+			if( verification_handle_region_mismatches_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print region mismatches in log handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	is_corrupted = libewf_handle_segment_files_corrupted(
+	                verification_handle->input_handle,
+	                error );
+
+	if( is_corrupted == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if segment files are corrupted.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_number_of_checksum_errors(
+	     verification_handle->input_handle,
+	     &number_of_checksum_errors,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of checksum errors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_corrupted == 0 )
+	 && ( number_of_checksum_errors == 0 )
+	 && ( has_region_mismatches == 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	if( verification_ranges != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		verification_handle->abort = 1;
+
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( verification_ranges[ range_index ].thread != NULL )
+			{
+				libcthreads_thread_join(
+				 &( verification_ranges[ range_index ].thread ),
+				 NULL );
+			}
+			if( verification_ranges[ range_index ].verify_error != NULL )
+			{
+				libcerror_error_free(
+				 &( verification_ranges[ range_index ].verify_error ) );
+			}
+			if( verification_ranges[ range_index ].input_handle != NULL )
+			{
+				libewf_handle_free(
+				 &( verification_ranges[ range_index ].input_handle ),
+				 NULL );
+			}
+		}
+#endif
+		memory_free(
+		 verification_ranges );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->process_status_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( verification_handle->process_status_mutex ),
+		 NULL );
+	}
+#endif
+	if( verification_handle->process_status != NULL )
+	{
+		process_status_stop(
+		 verification_handle->process_status,
+		 verification_handle->last_offset_hashed,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &( verification_handle->process_status ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Verifies single files
+ * The file entries are verified in media order to keep reading the media data sequential
+ * When multiple threads are used the single files are verified concurrently
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_single_files(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *file_entry    = NULL;
+	system_character_t *path           = NULL;
+	static char *function              = "verification_handle_verify_single_files";
+	size_t path_size                   = 0;
+	uint32_t number_of_checksum_errors = 0;
+	int file_entry_index               = 0;
+	int number_of_file_entries         = 0;
+	int result                         = 1;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_number_of_file_entries_in_media_order(
+	     verification_handle->input_handle,
+	     &number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries in media order.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_initialize(
+	     &( verification_handle->process_status ),
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     verification_handle->process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->number_of_threads != 0 )
+	{
+		result = verification_handle_verify_single_file_jobs(
+		          verification_handle,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify single file jobs.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( verification_handle->number_of_threads == 0 )
+	{
+		for( file_entry_index = 0;
+		     file_entry_index < number_of_file_entries;
+		     file_entry_index++ )
+		{
+			if( verification_handle->abort != 0 )
+			{
+				break;
+			}
+			if( libewf_handle_get_file_entry_in_media_order(
+			     verification_handle->input_handle,
+			     file_entry_index,
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file entry: %d in media order.",
+				 function,
+				 file_entry_index );
+
+				goto on_error;
+			}
+			if( verification_handle_get_file_entry_path(
+			     file_entry,
+			     &path,
+			     &path_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path of file entry: %d.",
+				 function,
+				 file_entry_index );
+
+				goto on_error;
+			}
+			switch( verification_handle_verify_file_entry_data(
+			         verification_handle,
+			         file_entry,
+			         path,
+			         log_handle,
+			         error ) )
+			{
+				case -1:
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to verify file entry: %d.",
+					 function,
+					 file_entry_index );
+
+					goto on_error;
+
+				case 0:
+					result = 0;
+					break;
+
+				default:
+					break;
+			}
+			memory_free(
+			 path );
+
+			path = NULL;
+
+			if( libewf_file_entry_free(
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry: %d.",
+				 function,
+				 file_entry_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( process_status_stop(
+	     verification_handle->process_status,
+	     0,
+	     PROCESS_STATUS_COMPLETED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_free(
+	     &( verification_handle->process_status ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_number_of_checksum_errors(
+	     verification_handle->input_handle,
+	     &number_of_checksum_errors,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of checksum errors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result != 0 )
+	 && ( number_of_checksum_errors == 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	if( verification_handle->process_status != NULL )
+	{
+		process_status_stop(
+		 verification_handle->process_status,
+		 0,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &( verification_handle->process_status ),
+		 NULL );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the path of a (single) file entry as a system string
+ * The path is relative to the root file entry and uses the \ separator
+ * The path is returned in an allocated buffer that should be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_get_file_entry_path(
+     libewf_file_entry_t *file_entry,
+     system_character_t **path,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_path = NULL;
+	static char *function         = "verification_handle_get_file_entry_path";
+	size_t safe_path_size         = 0;
+	int result                    = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_path_size(
+		  file_entry,
+		  &safe_path_size,
+		  error );
+#else
+	result = libewf_file_entry_get_utf8_path_size(
+		  file_entry,
+		  &safe_path_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_path_size == 0 )
+	 || ( safe_path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_path = system_string_allocate(
+	             safe_path_size );
+
+	if( safe_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_path(
+		  file_entry,
+		  (uint16_t *) safe_path,
+		  safe_path_size,
+		  error );
+#else
+	result = libewf_file_entry_get_utf8_path(
+		  file_entry,
+		  (uint8_t *) safe_path,
+		  safe_path_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path.",
+		 function );
+
+		goto on_error;
+	}
+	*path      = safe_path;
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_path != NULL )
+	{
+		memory_free(
+		 safe_path );
+	}
+	return( -1 );
+}
+
+/* Verifies a (single) file entry
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_file_entry(
+     verification_handle_t *verification_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *file_entry_path,
+     size_t file_entry_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *name        = NULL;
+	system_character_t *target_path = NULL;
+	static char *function           = "verification_handle_verify_file_entry";
+	size_t name_size                = 0;
+	size_t target_path_size         = 0;
+	uint8_t file_entry_type         = 0;
+	int result                      = 0;
+	int return_value                = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_file_entry_get_utf16_name_size(
+		  file_entry,
+		  &name_size,
+		  error );
+#else
+	result = libewf_file_entry_get_utf8_name_size(
+		  file_entry,
+		  &name_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the name.",
+		 function );
+
+		goto on_error;
+	}
+	if( name_size > 0 )
+	{
+		name = system_string_allocate(
+			name_size );
+
+		if( name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libewf_file_entry_get_utf16_name(
+			  file_entry,
+			  (uint16_t *) name,
+			  name_size,
+			  error );
+#else
+		result = libewf_file_entry_get_utf8_name(
+			  file_entry,
+			  (uint8_t *) name,
+			  name_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the name.",
+			 function );
+
+			memory_free(
+			 name );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libcpath_path_join_wide(
+		     &target_path,
+		     &target_path_size,
+		     file_entry_path,
+		     file_entry_path_length,
+		     name,
+		     name_size - 1,
+		     error ) != 1 )
+#else
+		if( libcpath_path_join(
+		     &target_path,
+		     &target_path_size,
+		     file_entry_path,
+		     file_entry_path_length,
+		     name,
+		     name_size - 1,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create target path.",
+			 function );
+
+			memory_free(
+			 name );
+
+			goto on_error;
+		}
+		memory_free(
+		 name );
+	}
+	else
+	{
+		target_path      = (system_character_t *) file_entry_path;
+		target_path_size = file_entry_path_length + 1;
+	}
+	if( libewf_file_entry_get_type(
+	     file_entry,
+	     &file_entry_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry type.",
+		 function );
+
+		goto on_error;
+	}
+	/* TODO what about NTFS streams ?
+	 */
+	if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_FILE )
+	{
+		return_value = verification_handle_verify_file_entry_data(
+		                verification_handle,
+		                file_entry,
+		                target_path,
+		                log_handle,
+		                error );
+
+		if( return_value == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify file entry data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
+	{
+		return_value = verification_handle_verify_sub_file_entries(
+		                verification_handle,
+		                file_entry,
+		                target_path,
+		                target_path_size - 1,
+		                log_handle,
+		                error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify sub file entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( target_path != file_entry_path )
+	{
+		memory_free(
+		 target_path );
+	}
+	return( return_value );
+
+on_error:
+	if( ( target_path != NULL )
+	 && ( target_path != file_entry_path ) )
+	{
+		memory_free(
+		 target_path );
+	}
+	return( -1 );
+}
+
+/* Verifies the data of a (single) file entry of type file
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_file_entry_data(
+     verification_handle_t *verification_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *file_entry_path,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *file_entry_data      = NULL;
+	static char *function         = "verification_handle_verify_file_entry_data";
+	size64_t file_entry_data_size = 0;
+	size_t process_buffer_size    = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	int md5_hash_compare          = 0;
+	int result                    = 0;
+	int return_value              = 0;
+	int sha1_hash_compare         = 0;
+	int sha256_hash_compare       = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size > (size32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "Single file: %" PRIs_SYSTEM "\n",
+	 file_entry_path );
+
+	if( log_handle != NULL )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Single file: %" PRIs_SYSTEM "\n",
+		 file_entry_path );
+	}
+	if( libewf_file_entry_get_size(
+	     file_entry,
+	     &file_entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle_initialize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+	result = 1;
+
+	if( file_entry_data_size > 0 )
+	{
+		if( verification_handle->process_buffer_size == 0 )
+		{
+			process_buffer_size = verification_handle->chunk_size;
+		}
+		else
+		{
+			process_buffer_size = verification_handle->process_buffer_size;
+		}
+		/* This function in not necessary for normal use
+		 * but it was added for testing
+		 */
+		if( libewf_file_entry_seek_offset(
+		     file_entry,
+		     0,
+		     SEEK_SET,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to seek the start of the file entry data.",
+			 function );
+
+			goto on_error;
+		}
+		file_entry_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * process_buffer_size );
+
+		if( file_entry_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file entry data.",
+			 function );
+
+			goto on_error;
+		}
+		while( file_entry_data_size > 0 )
+		{
+			if( file_entry_data_size >= process_buffer_size )
+			{
+				read_size = process_buffer_size;
+			}
+			else
+			{
+				read_size = (size_t) file_entry_data_size;
+			}
+			read_count = libewf_file_entry_read_buffer(
+			              file_entry,
+			              file_entry_data,
+			              read_size,
+			              error );
+
+			if( read_count == (ssize_t) -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file entry data.",
+				 function );
+
+				goto on_error;
+			}
+			else if( read_count != (ssize_t) read_size )
+			{
+				result = 0;
+
+				break;
+			}
+			file_entry_data_size -= read_size;
+
+			if( verification_handle_update_integrity_hash(
+			     verification_handle,
+			     file_entry_data,
+			     read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update integrity hash(es).",
+				 function );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 file_entry_data );
+
+		file_entry_data = NULL;
+	}
+	if( verification_handle_finalize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		if( verification_handle_get_integrity_hash_from_file_entry(
+		     verification_handle,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to retrieve integrity hash(es) from file entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle_hash_values_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print hash values.",
+			 function );
+
+			goto on_error;
+		}
+		if( log_handle != NULL )
+		{
+			if( verification_handle_hash_values_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print hash values in log handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( verification_handle->calculate_md5 != 0 )
+		 && ( verification_handle->stored_md5_hash_available != 0 ) )
+		{
+			md5_hash_compare = system_string_compare(
+					    verification_handle->stored_md5_hash_string,
+					    verification_handle->calculated_md5_hash_string,
+					    33 );
+		}
+		if( ( verification_handle->calculate_sha1 != 0 )
+		 && ( verification_handle->stored_sha1_hash_available != 0 ) )
+		{
+			sha1_hash_compare = system_string_compare(
+					     verification_handle->stored_sha1_hash_string,
+					     verification_handle->calculated_sha1_hash_string,
+					     41 );
+		}
+		if( ( verification_handle->calculate_sha256 != 0 )
+		 && ( verification_handle->stored_sha256_hash_available != 0 ) )
+		{
+			sha256_hash_compare = system_string_compare(
+					       verification_handle->stored_sha256_hash_string,
+					       verification_handle->calculated_sha256_hash_string,
+					       65 );
+		}
+	}
+	if( ( result != 0 )
+	 && ( md5_hash_compare == 0 )
+	 && ( sha1_hash_compare == 0 )
+	 && ( sha256_hash_compare == 0 ) )
+	{
+		return_value = 1;
+	}
+	else
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "FAILED\n" );
+
+		if( log_handle != NULL )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "FAILED\n" );
+		}
+		return_value = 0;
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\n" );
+
+	return( return_value );
+
+on_error:
+	if( file_entry_data != NULL )
+	{
+		memory_free(
+		 file_entry_data );
+	}
+	return( -1 );
+}
+
+/* Verifies the data of a single file job
+ * The data is read using the input handle, which can be a clone of the input handle
+ * of the verification handle, and the digest hashes are stored in the single file job
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_single_file_job_data(
+     verification_handle_t *verification_handle,
+     single_file_job_t *single_file_job,
+     libewf_handle_t *input_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *file_entry          = NULL;
+	libhmac_md5_context_t *md5_context       = NULL;
+	libhmac_sha1_context_t *sha1_context     = NULL;
+	libhmac_sha256_context_t *sha256_context = NULL;
+	uint8_t *buffer                          = NULL;
+	static char *function                    = "verification_handle_verify_single_file_job_data";
+	size64_t remaining_size                  = 0;
+	size_t process_buffer_size               = 0;
+	size_t read_size                         = 0;
+	ssize_t read_count                       = 0;
+	off64_t offset                           = 0;
+	int result                               = 1;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size > (size32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_file_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file job.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->process_buffer_size == 0 )
+	{
+		process_buffer_size = verification_handle->chunk_size;
+	}
+	else
+	{
+		process_buffer_size = verification_handle->process_buffer_size;
+	}
+	/* The digest hashes are calculated on the calling thread since every
+	 * single file job already runs on a thread of its own
+	 */
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &sha1_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The file entry is retrieved from the input handle clone so that
+	 * its data is read with the file IO pool of the clone
+	 */
+	if( libewf_handle_get_file_entry_in_media_order(
+	     input_handle,
+	     single_file_job->file_entry_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %d in media order.",
+		 function,
+		 single_file_job->file_entry_index );
+
+		goto on_error;
+	}
+	remaining_size = single_file_job->size;
+
+	if( remaining_size > 0 )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * process_buffer_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( remaining_size > 0 )
+	{
+		if( remaining_size >= process_buffer_size )
+		{
+			read_size = process_buffer_size;
+		}
+		else
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = libewf_file_entry_read_buffer_at_offset(
+		              file_entry,
+		              buffer,
+		              read_size,
+		              offset,
+		              error );
+
+		if( read_count == (ssize_t) -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read single file data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( read_count != (ssize_t) read_size )
+		{
+			result = 0;
+
+			break;
+		}
+		offset         += read_count;
+		remaining_size -= read_count;
+
+		if( md5_context != NULL )
+		{
+			if( libhmac_md5_update(
+			     md5_context,
+			     buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( sha1_context != NULL )
+		{
+			if( libhmac_sha1_update(
+			     sha1_context,
+			     buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA1 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( sha256_context != NULL )
+		{
+			if( libhmac_sha256_update(
+			     sha256_context,
+			     buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA256 digest hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+	}
+	if( libewf_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     md5_context,
+		     single_file_job->calculated_md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_md5_free(
+		     &md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( sha1_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     sha1_context,
+		     single_file_job->calculated_sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA1 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha1_free(
+		     &sha1_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( sha256_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     sha256_context,
+		     single_file_job->calculated_sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_free(
+		     &sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reports the result of a single file job
+ * The digest hashes of the single file job are copied into the verification handle
+ * so that they are printed the same way as when verifying on a single thread
+ * Returns 1 if the single file was verified successfully, 0 if not or -1 on error
+ */
+int verification_handle_report_single_file_job(
+     verification_handle_t *verification_handle,
+     single_file_job_t *single_file_job,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_report_single_file_job";
+	int md5_hash_compare  = 0;
+	int return_value      = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->stored_md5_hash_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing stored MD5 hash string.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_file_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file job.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "Single file: %" PRIs_SYSTEM "\n",
+	 single_file_job->target_path );
+
+	if( log_handle != NULL )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Single file: %" PRIs_SYSTEM "\n",
+		 single_file_job->target_path );
+	}
+	if( single_file_job->result == 1 )
+	{
+		if( verification_handle->calculate_md5 != 0 )
+		{
+			if( digest_hash_copy_to_string(
+			     single_file_job->calculated_md5_hash,
+			     LIBHMAC_MD5_HASH_SIZE,
+			     verification_handle->calculated_md5_hash_string,
+			     33,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set calculated MD5 hash string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( verification_handle->calculate_sha1 != 0 )
+		{
+			if( digest_hash_copy_to_string(
+			     single_file_job->calculated_sha1_hash,
+			     LIBHMAC_SHA1_HASH_SIZE,
+			     verification_handle->calculated_sha1_hash_string,
+			     41,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set calculated SHA1 hash string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( verification_handle->calculate_sha256 != 0 )
+		{
+			if( digest_hash_copy_to_string(
+			     single_file_job->calculated_sha256_hash,
+			     LIBHMAC_SHA256_HASH_SIZE,
+			     verification_handle->calculated_sha256_hash_string,
+			     65,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set calculated SHA256 hash string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( system_string_copy(
+		     verification_handle->stored_md5_hash_string,
+		     single_file_job->stored_md5_hash_string,
+		     33 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy stored MD5 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		verification_handle->stored_md5_hash_available = single_file_job->stored_md5_hash_available;
+
+		verification_handle->stored_sha1_hash_available = 0;
+
+		verification_handle->stored_sha256_hash_available = 0;
+
+		if( verification_handle_hash_values_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print hash values.",
+			 function );
+
+			return( -1 );
+		}
+		if( log_handle != NULL )
+		{
+			if( verification_handle_hash_values_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print hash values in log handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( verification_handle->calculate_md5 != 0 )
+		 && ( verification_handle->stored_md5_hash_available != 0 ) )
+		{
+			md5_hash_compare = system_string_compare(
+					    verification_handle->stored_md5_hash_string,
+					    verification_handle->calculated_md5_hash_string,
+					    33 );
+		}
+	}
+	if( ( single_file_job->result == 1 )
+	 && ( md5_hash_compare == 0 ) )
+	{
+		return_value = 1;
+	}
+	else
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "FAILED\n" );
+
+		if( log_handle != NULL )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "FAILED\n" );
+		}
+		return_value = 0;
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\n" );
+
+	return( return_value );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
 
-			goto on_error;
+/* Verifies the data of a single file job
+ * Callback function for the single file thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_verify_single_file_job_callback(
+     single_file_job_t *single_file_job,
+     verification_handle_t *verification_handle )
+{
+	libcerror_error_t *error      = NULL;
+	libewf_handle_t *input_handle = NULL;
+	static char *function         = "verification_handle_verify_single_file_job_callback";
+
+	if( single_file_job == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file job.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( input_handle_pool_grab_handle(
+	     verification_handle->input_handle_pool,
+	     &input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab input handle clone from pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* The result is reported by the thread that pushed the job after the thread pool was joined
+	 */
+	single_file_job->result = verification_handle_verify_single_file_job_data(
+	                           verification_handle,
+	                           single_file_job,
+	                           input_handle,
+	                           &error );
+
+	if( single_file_job->result == -1 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libcpath_path_join_wide(
-		     &target_path,
-		     &target_path_size,
-		     file_entry_path,
-		     file_entry_path_length,
-		     name,
-		     name_size - 1,
-		     error ) != 1 )
-#else
-		if( libcpath_path_join(
-		     &target_path,
-		     &target_path_size,
-		     file_entry_path,
-		     file_entry_path_length,
-		     name,
-		     name_size - 1,
-		     error ) != 1 )
 #endif
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create target path.",
-			 function );
+		libcerror_error_free(
+		 &error );
+	}
+	if( input_handle_pool_release_handle(
+	     verification_handle->input_handle_pool,
+	     input_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release input handle clone to pool.",
+		 function );
 
-			memory_free(
-			 name );
+		goto on_error;
+	}
+	return( 1 );
 
-			goto on_error;
+on_error:
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
 		}
-		memory_free(
-		 name );
+#endif
+		libcerror_error_free(
+		 &error );
 	}
-	else
+	return( -1 );
+}
+
+/* Verifies single files using the single file thread pool
+ * A single file job is created per file entry in media order, each thread
+ * calculates the digest hashes of a file using its own clone of the input handle
+ * The results are reported in media order after the thread pool was joined
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_single_file_jobs(
+     verification_handle_t *verification_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libewf_file_entry_t *file_entry      = NULL;
+	single_file_job_t **single_file_jobs = NULL;
+	system_character_t *path             = NULL;
+	static char *function                = "verification_handle_verify_single_file_jobs";
+	size_t path_size                     = 0;
+	int job_index                        = 0;
+	int number_of_jobs                   = 0;
+	int number_of_threads                = 0;
+	int result                           = 1;
+
+	if( verification_handle == NULL )
 	{
-		target_path      = (system_character_t *) file_entry_path;
-		target_path_size = file_entry_path_length + 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( libewf_file_entry_get_type(
-	     file_entry,
-	     &file_entry_type,
+	if( verification_handle->single_file_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - single file thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_number_of_file_entries_in_media_order(
+	     verification_handle->input_handle,
+	     &number_of_jobs,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry type.",
+		 "%s: unable to retrieve number of file entries in media order.",
 		 function );
 
 		goto on_error;
 	}
-	/* TODO what about NTFS streams ?
-	 */
-	if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_FILE )
+	if( number_of_jobs == 0 )
 	{
-		fprintf(
-		 verification_handle->notify_stream,
-		 "Single file: %" PRIs_SYSTEM "\n",
-		 target_path );
+		return( 1 );
+	}
+	if( (size_t) number_of_jobs > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( single_file_job_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of file entries value exceeds maximum allocation size.",
+		 function );
 
-		if( log_handle != NULL )
+		goto on_error;
+	}
+	single_file_jobs = (single_file_job_t **) memory_allocate(
+	                                           sizeof( single_file_job_t * ) * number_of_jobs );
+
+	if( single_file_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create single file jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     single_file_jobs,
+	     0,
+	     sizeof( single_file_job_t * ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear single file jobs.",
+		 function );
+
+		memory_free(
+		 single_file_jobs );
+
+		single_file_jobs = NULL;
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libewf_handle_get_file_entry_in_media_order(
+		     verification_handle->input_handle,
+		     job_index,
+		     &file_entry,
+		     error ) != 1 )
 		{
-			log_handle_printf(
-			 log_handle,
-			 "Single file: %" PRIs_SYSTEM "\n",
-			 target_path );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %d in media order.",
+			 function,
+			 job_index );
+
+			goto on_error;
 		}
-		if( libewf_file_entry_get_size(
+		if( verification_handle_get_file_entry_path(
 		     file_entry,
-		     &file_entry_data_size,
+		     &path,
+		     &path_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry data size.",
-			 function );
+			 "%s: unable to retrieve path of file entry: %d.",
+			 function,
+			 job_index );
 
 			goto on_error;
 		}
-		if( verification_handle_initialize_integrity_hash(
-		     verification_handle,
+		if( single_file_job_initialize(
+		     &( single_file_jobs[ job_index ] ),
+		     file_entry,
+		     job_index,
+		     path,
+		     path_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize integrity hash(es).",
-			 function );
+			 "%s: unable to create single file job: %d.",
+			 function,
+			 job_index );
 
 			goto on_error;
 		}
-		result = 1;
-
-		if( file_entry_data_size > 0 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libewf_file_entry_get_utf16_hash_value_md5(
+			  file_entry,
+			  (uint16_t *) single_file_jobs[ job_index ]->stored_md5_hash_string,
+			  33,
+			  error );
+#else
+		result = libewf_file_entry_get_utf8_hash_value_md5(
+			  file_entry,
+			  (uint8_t *) single_file_jobs[ job_index ]->stored_md5_hash_string,
+			  33,
+			  error );
+#endif
+		if( result == -1 )
 		{
-			if( verification_handle->process_buffer_size == 0 )
-			{
-				process_buffer_size = verification_handle->chunk_size;
-			}
-			else
-			{
-				process_buffer_size = verification_handle->process_buffer_size;
-			}
-			/* This function in not necessary for normal use
-			 * but it was added for testing
-			 */
-			if( libewf_file_entry_seek_offset(
-			     file_entry,
-			     0,
-			     SEEK_SET,
-			     error ) != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to seek the start of the file entry data.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine stored MD5 hash string of file entry: %d.",
+			 function,
+			 job_index );
 
-				goto on_error;
-			}
-			file_entry_data = (uint8_t *) memory_allocate(
-			                               sizeof( uint8_t ) * process_buffer_size );
+			goto on_error;
+		}
+		single_file_jobs[ job_index ]->stored_md5_hash_available = result;
 
-			if( file_entry_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create file entry data.",
-				 function );
+		memory_free(
+		 path );
 
-				goto on_error;
-			}
-			while( file_entry_data_size > 0 )
-			{
-				if( file_entry_data_size >= process_buffer_size )
-				{
-					read_size = process_buffer_size;
-				}
-				else
-				{
-					read_size = (size_t) file_entry_data_size;
-				}
-				read_count = libewf_file_entry_read_buffer(
-				              file_entry,
-				              file_entry_data,
-				              read_size,
-				              error );
+		path = NULL;
 
-				if( read_count == (ssize_t) -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read file entry data.",
-					 function );
+		if( libewf_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %d.",
+			 function,
+			 job_index );
 
-					goto on_error;
-				}
-				else if( read_count != (ssize_t) read_size )
-				{
-					result = 0;
+			goto on_error;
+		}
+	}
+	result = 1;
 
-					break;
-				}
-				file_entry_data_size -= read_size;
+	number_of_threads = verification_handle->number_of_threads;
 
-				if( verification_handle_update_integrity_hash(
-				     verification_handle,
-				     file_entry_data,
-				     read_count,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to update integrity hash(es).",
-					 function );
+	if( number_of_threads > number_of_jobs )
+	{
+		number_of_threads = number_of_jobs;
+	}
+	if( input_handle_pool_initialize(
+	     &( verification_handle->input_handle_pool ),
+	     verification_handle->input_handle,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input handle clones.",
+		 function );
 
-					goto on_error;
-				}
-			}
-			memory_free(
-			 file_entry_data );
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( verification_handle->single_file_thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     number_of_threads * 2,
+	     (int (*)(intptr_t *, void *)) &verification_handle_verify_single_file_job_callback,
+	     (void *) verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize single file thread pool.",
+		 function );
 
-			file_entry_data = NULL;
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( verification_handle->abort != 0 )
+		{
+			break;
 		}
-		if( verification_handle_finalize_integrity_hash(
-		     verification_handle,
+		if( libcthreads_thread_pool_push(
+		     verification_handle->single_file_thread_pool,
+		     (intptr_t *) single_file_jobs[ job_index ],
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to finalize integrity hash(es).",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push single file job: %d onto thread pool queue.",
+			 function,
+			 job_index );
 
 			goto on_error;
 		}
-		if( result != 0 )
-		{
-			if( verification_handle_get_integrity_hash_from_file_entry(
-			     verification_handle,
-			     file_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to retrieve integrity hash(es) from file entry.",
-				 function );
+	}
+	if( libcthreads_thread_pool_join(
+	     &( verification_handle->single_file_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join single file thread pool.",
+		 function );
 
-				goto on_error;
-			}
-			if( verification_handle_hash_values_fprint(
-			     verification_handle,
-			     verification_handle->notify_stream,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print hash values.",
-				 function );
+		goto on_error;
+	}
+	if( input_handle_pool_free(
+	     &( verification_handle->input_handle_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input handle clones.",
+		 function );
 
-				goto on_error;
-			}
-			if( log_handle != NULL )
+		goto on_error;
+	}
+	if( verification_handle->abort == 0 )
+	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			switch( verification_handle_report_single_file_job(
+			         verification_handle,
+			         single_file_jobs[ job_index ],
+			         log_handle,
+			         error ) )
 			{
-				if( verification_handle_hash_values_fprint(
-				     verification_handle,
-				     log_handle->log_stream,
-				     error ) != 1 )
-				{
+				case -1:
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print hash values in log handle.",
-					 function );
+					 "%s: unable to report single file job: %d.",
+					 function,
+					 job_index );
 
 					goto on_error;
-				}
-			}
-			if( ( verification_handle->calculate_md5 != 0 )
-			 && ( verification_handle->stored_md5_hash_available != 0 ) )
-			{
-				md5_hash_compare = system_string_compare(
-						    verification_handle->stored_md5_hash_string,
-						    verification_handle->calculated_md5_hash_string,
-						    33 );
-			}
-			if( ( verification_handle->calculate_sha1 != 0 )
-			 && ( verification_handle->stored_sha1_hash_available != 0 ) )
-			{
-				sha1_hash_compare = system_string_compare(
-						     verification_handle->stored_sha1_hash_string,
-						     verification_handle->calculated_sha1_hash_string,
-						     41 );
-			}
-			if( ( verification_handle->calculate_sha256 != 0 )
-			 && ( verification_handle->stored_sha256_hash_available != 0 ) )
-			{
-				sha256_hash_compare = system_string_compare(
-						       verification_handle->stored_sha256_hash_string,
-						       verification_handle->calculated_sha256_hash_string,
-						       65 );
-			}
-		}
-		if( ( result != 0 )
-		 && ( md5_hash_compare == 0 )
-		 && ( sha1_hash_compare == 0 )
-		 && ( sha256_hash_compare == 0 ) )
-		{
-			return_value = 1;
-		}
-		else
-		{
-			fprintf(
-			 verification_handle->notify_stream,
-			 "FAILED\n" );
 
-			if( log_handle != NULL )
-			{
-				log_handle_printf(
-				 log_handle,
-				 "FAILED\n" );
+				case 0:
+					/* A single file that could not be read is reported as failed
+					 * and is returned as an error after all the results are reported
+					 */
+					if( ( single_file_jobs[ job_index ]->result == -1 )
+					 && ( result != -1 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to verify single file: %" PRIs_SYSTEM ".",
+						 function,
+						 single_file_jobs[ job_index ]->target_path );
+
+						result = -1;
+					}
+					else if( result == 1 )
+					{
+						result = 0;
+					}
+					break;
+
+				default:
+					break;
 			}
-			return_value = 0;
 		}
-		fprintf(
-		 verification_handle->notify_stream,
-		 "\n" );
 	}
-	else if( file_entry_type == LIBEWF_FILE_ENTRY_TYPE_DIRECTORY )
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
 	{
-		return_value = verification_handle_verify_sub_file_entries(
-		                verification_handle,
-		                file_entry,
-		                target_path,
-		                target_path_size - 1,
-		                log_handle,
-		                error );
-
-		if( result == -1 )
+		if( single_file_job_free(
+		     &( single_file_jobs[ job_index ] ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to verify sub file entries.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free single file job: %d.",
+			 function,
+			 job_index );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	if( target_path != file_entry_path )
+	memory_free(
+	 single_file_jobs );
+
+	return( result );
+
+on_error:
+	if( verification_handle->single_file_thread_pool != NULL )
 	{
-		memory_free(
-		 target_path );
+		libcthreads_thread_pool_join(
+		 &( verification_handle->single_file_thread_pool ),
+		 NULL );
 	}
-	return( return_value );
+	input_handle_pool_free(
+	 &( verification_handle->input_handle_pool ),
+	 NULL );
 
-on_error:
-	if( file_entry_data != NULL )
+	if( path != NULL )
 	{
 		memory_free(
-		 file_entry_data );
+		 path );
 	}
-	if( ( target_path != NULL )
-	 && ( target_path != file_entry_path ) )
+	if( file_entry != NULL )
+	{
+		libewf_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( single_file_jobs != NULL )
 	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( single_file_jobs[ job_index ] != NULL )
+			{
+				single_file_job_free(
+				 &( single_file_jobs[ job_index ] ),
+				 NULL );
+			}
+		}
 		memory_free(
-		 target_path );
+		 single_file_jobs );
 	}
 	return( -1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Verifies a (single) file entry sub file entries
  * Returns 1 if successful, 0 if not or -1 on error
  */
@@ -4338,6 +6926,129 @@ int verification_handle_additional_hash_values_fprint(
 	return( result );
 }
 
+/* Print the regions that did not match the chunk hash map to a stream
+ * Returns 1 if there are region mismatches, 0 if not or -1 on error
+ */
+int verification_handle_region_mismatches_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function             = "verification_handle_region_mismatches_fprint";
+	uint64_t first_region_index       = 0;
+	uint64_t last_sector              = 0;
+	uint64_t number_of_mismatches     = 0;
+	uint64_t number_of_regions        = 0;
+	uint64_t number_of_sectors        = 0;
+	uint64_t region_index             = 0;
+	uint64_t start_sector             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_handle->chunk_hash_map == NULL )
+	 || ( verification_handle->region_mismatches == NULL ) )
+	{
+		return( 0 );
+	}
+	number_of_regions = verification_handle->chunk_hash_map->number_of_regions;
+
+	for( region_index = 0;
+	     region_index < number_of_regions;
+	     region_index++ )
+	{
+		if( verification_handle->region_mismatches[ region_index ] != 0 )
+		{
+			number_of_mismatches++;
+		}
+	}
+	if( number_of_mismatches == 0 )
+	{
+		return( 0 );
+	}
+	fprintf(
+	 stream,
+	 "Region digest hash mismatches:\n" );
+	fprintf(
+	 stream,
+	 "\ttotal number: %" PRIu64 "\n",
+	 number_of_mismatches );
+
+	region_index = 0;
+
+	while( region_index < number_of_regions )
+	{
+		if( verification_handle->region_mismatches[ region_index ] == 0 )
+		{
+			region_index++;
+
+			continue;
+		}
+		/* Consecutive regions are printed as a single range
+		 */
+		first_region_index = region_index;
+
+		while( ( region_index < number_of_regions )
+		    && ( verification_handle->region_mismatches[ region_index ] != 0 ) )
+		{
+			region_index++;
+		}
+		start_sector = ( first_region_index * verification_handle->chunk_hash_map->region_size )
+		             / verification_handle->bytes_per_sector;
+		last_sector  = region_index * verification_handle->chunk_hash_map->region_size;
+
+		if( last_sector > verification_handle->chunk_hash_map->media_size )
+		{
+			last_sector = verification_handle->chunk_hash_map->media_size;
+		}
+		last_sector /= verification_handle->bytes_per_sector;
+
+		number_of_sectors = last_sector - start_sector;
+
+		fprintf(
+		 stream,
+		 "\tat sector(s): %" PRIu64 " - %" PRIu64 " (number: %" PRIu64 ")\n",
+		 start_sector,
+		 last_sector - 1,
+		 number_of_sectors );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
 /* Print the checksum errors to a stream
  * Returns 1 if successful or -1 on error
  */
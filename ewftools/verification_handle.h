@@ -25,15 +25,20 @@
 #include <common.h>
 #include <types.h>
 
+#include "chunk_hash_map.h"
 #include "digest_hash.h"
+#include "digest_hash_threads.h"
 #include "ewftools_libcdata.h"
 #include "ewftools_libcerror.h"
 #include "ewftools_libcthreads.h"
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
+#include "input_handle_pool.h"
 #include "log_handle.h"
 #include "process_status.h"
+#include "single_file_job.h"
 #include "storage_media_buffer.h"
+#include "storage_media_buffer_ring.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -46,6 +51,7 @@ enum VERIFICATION_HANDLE_INPUT_FORMATS
 };
 
 typedef struct verification_handle verification_handle_t;
+typedef struct verification_range verification_range_t;
 
 struct verification_handle
 {
@@ -129,6 +135,14 @@ struct verification_handle
 	 */
 	system_character_t *stored_sha256_hash_string;
 
+	/* The chunk hash map
+	 */
+	chunk_hash_map_t *chunk_hash_map;
+
+	/* Values to indicate which regions of the chunk hash map did not match
+	 */
+	uint8_t *region_mismatches;
+
 	/* Value to indicate if the chunk data instead of the buffered read and write functions should be used
 	 */
 	uint8_t use_chunk_data_functions;
@@ -151,14 +165,30 @@ struct verification_handle
 	 */
 	libcthreads_thread_pool_t *output_thread_pool;
 
-	/* The output list
+	/* The output ring
 	 */
-	libcdata_list_t *output_list;
+	storage_media_buffer_ring_t *output_ring;
 
 	/* The storage media buffer queue
 	 */
 	libcthreads_queue_t *storage_media_buffer_queue;
 
+	/* The digest hash threads
+	 */
+	digest_hash_threads_t *digest_hash_threads;
+
+	/* The process status mutex
+	 */
+	libcthreads_mutex_t *process_status_mutex;
+
+	/* The single file thread pool
+	 */
+	libcthreads_thread_pool_t *single_file_thread_pool;
+
+	/* The pool of input handle clones used by the single file thread pool
+	 */
+	input_handle_pool_t *input_handle_pool;
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* The libewf input handle
@@ -194,6 +224,40 @@ struct verification_handle
 	int abort;
 };
 
+/* A range of the media that is verified by a single thread
+ */
+struct verification_range
+{
+	/* The verification handle
+	 */
+	verification_handle_t *verification_handle;
+
+	/* The libewf input handle, a clone of the input handle
+	 * of the verification handle when a separate thread is used
+	 */
+	libewf_handle_t *input_handle;
+
+	/* The range offset
+	 */
+	off64_t range_offset;
+
+	/* The range size
+	 */
+	size64_t range_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* The verification error
+	 */
+	libcerror_error_t *verify_error;
+};
+
 int verification_handle_initialize(
      verification_handle_t **verification_handle,
      uint8_t calculate_md5,
@@ -252,7 +316,7 @@ int verification_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      verification_handle_t *verification_handle );
 
-int verification_handle_empty_output_list(
+int verification_handle_empty_output_ring(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
 
@@ -264,12 +328,43 @@ int verification_handle_verify_input(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int verification_handle_verify_range(
+     verification_handle_t *verification_handle,
+     libewf_handle_t *input_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int verification_handle_verify_range_thread_function(
+     verification_range_t *verification_range );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int verification_handle_read_chunk_hash_map(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verification_handle_verify_chunks(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int verification_handle_verify_single_files(
      verification_handle_t *verification_handle,
      uint8_t print_status_information,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int verification_handle_get_file_entry_path(
+     libewf_file_entry_t *file_entry,
+     system_character_t **path,
+     size_t *path_size,
+     libcerror_error_t **error );
+
 int verification_handle_verify_file_entry(
      verification_handle_t *verification_handle,
      libewf_file_entry_t *file_entry,
@@ -278,6 +373,38 @@ int verification_handle_verify_file_entry(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int verification_handle_verify_file_entry_data(
+     verification_handle_t *verification_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *file_entry_path,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int verification_handle_verify_single_file_job_data(
+     verification_handle_t *verification_handle,
+     single_file_job_t *single_file_job,
+     libewf_handle_t *input_handle,
+     libcerror_error_t **error );
+
+int verification_handle_report_single_file_job(
+     verification_handle_t *verification_handle,
+     single_file_job_t *single_file_job,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int verification_handle_verify_single_file_job_callback(
+     single_file_job_t *single_file_job,
+     verification_handle_t *verification_handle );
+
+int verification_handle_verify_single_file_jobs(
+     verification_handle_t *verification_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int verification_handle_verify_sub_file_entries(
      verification_handle_t *verification_handle,
      libewf_file_entry_t *file_entry,
@@ -341,6 +468,11 @@ int verification_handle_additional_hash_values_fprint(
      FILE *stream,
      libcerror_error_t **error );
 
+int verification_handle_region_mismatches_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
 int verification_handle_checksum_errors_fprint(
      verification_handle_t *verification_handle,
      FILE *stream,
@@ -1769,6 +1769,132 @@ int libewf_chunk_data_get_write_size(
 	return( 1 );
 }
 
+/* Prepares packed chunk data read by one handle to be written by another handle without repacking
+ * This sets the alignment padding required by the pack flags
+ * Returns 1 if successful, 0 if the chunk data needs to be repacked or -1 on error
+ */
+int libewf_chunk_data_prepare_packed_write(
+     libewf_chunk_data_t *chunk_data,
+     libewf_io_handle_t *source_io_handle,
+     libewf_io_handle_t *destination_io_handle,
+     uint8_t pack_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_prepare_packed_write";
+	size_t padding_size   = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_PACKED ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data->range_flags & ( LIBEWF_RANGE_FLAG_USES_PATTERN_FILL | LIBEWF_RANGE_FLAG_IS_CORRUPTED ) ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data->chunk_io_flags & LIBEWF_CHUNK_IO_FLAG_CHECKSUM_SET ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	{
+		if( source_io_handle->compression_method != destination_io_handle->compression_method )
+		{
+			return( 0 );
+		}
+		if( ( destination_io_handle->compression_level == LIBEWF_COMPRESSION_NONE )
+		 && ( ( pack_flags & LIBEWF_PACK_FLAG_FORCE_COMPRESSION ) == 0 )
+		 && ( ( destination_io_handle->compression_flags & LIBEWF_COMPRESS_FLAG_USE_EMPTY_BLOCK_COMPRESSION ) == 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		if( ( pack_flags & LIBEWF_PACK_FLAG_FORCE_COMPRESSION ) != 0 )
+		{
+			return( 0 );
+		}
+		if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_HAS_CHECKSUM ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( chunk_data->data_size > chunk_data->allocated_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pack_flags & LIBEWF_PACK_FLAG_ADD_ALIGNMENT_PADDING ) != 0 )
+	{
+		padding_size = chunk_data->data_size % 16;
+
+		if( padding_size != 0 )
+		{
+			padding_size = 16 - padding_size;
+		}
+		if( ( chunk_data->data_size + padding_size ) > chunk_data->allocated_data_size )
+		{
+			return( 0 );
+		}
+		if( memory_set(
+		     &( ( chunk_data->data )[ chunk_data->data_size ] ),
+		     0,
+		     padding_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear alignment padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	chunk_data->padding_size = padding_size;
+
+	return( 1 );
+}
+
 /* Retrieves the (stored) checksum
  * Returns 1 if successful, 0 if no checksum or -1 on error
  */
@@ -1967,6 +2093,86 @@ ssize_t libewf_chunk_data_read_from_file_io_pool(
 	return( read_count );
 }
 
+/* Reads chunk data from a buffer containing the packed (stored) chunk data
+ * This is used to split the data of a single read of multiple adjacent chunks
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_chunk_data_read_from_buffer(
+         libewf_chunk_data_t *chunk_data,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t chunk_data_flags,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_read_from_buffer";
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk data - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > chunk_data->allocated_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     chunk_data->data,
+	     buffer,
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer to chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data->data_size = buffer_size;
+
+	chunk_data->range_flags = ( chunk_data_flags | LIBEWF_RANGE_FLAG_IS_PACKED )
+	                        & ~( LIBEWF_RANGE_FLAG_IS_TAINTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED );
+
+	return( (ssize_t) buffer_size );
+}
+
 /* Reads chunk data
  * Callback function for the chunks list
  * Returns 1 if successful or -1 on error
@@ -149,6 +149,13 @@ int libewf_chunk_data_get_write_size(
      uint32_t *write_size,
      libcerror_error_t **error );
 
+int libewf_chunk_data_prepare_packed_write(
+     libewf_chunk_data_t *chunk_data,
+     libewf_io_handle_t *source_io_handle,
+     libewf_io_handle_t *destination_io_handle,
+     uint8_t pack_flags,
+     libcerror_error_t **error );
+
 int libewf_chunk_data_get_checksum(
      libewf_chunk_data_t *chunk_data,
      uint16_t compression_method,
@@ -164,6 +171,13 @@ ssize_t libewf_chunk_data_read_from_file_io_pool(
          uint32_t chunk_data_flags,
          libcerror_error_t **error );
 
+ssize_t libewf_chunk_data_read_from_buffer(
+         libewf_chunk_data_t *chunk_data,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t chunk_data_flags,
+         libcerror_error_t **error );
+
 int libewf_chunk_data_read_element_data(
      libewf_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
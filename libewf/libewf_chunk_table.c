@@ -24,13 +24,16 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libewf_checksum.h"
 #include "libewf_chunk_data.h"
 #include "libewf_chunk_group.h"
 #include "libewf_chunk_table.h"
 #include "libewf_definitions.h"
 #include "libewf_io_handle.h"
+#include "libewf_io_queue.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
 #include "libewf_libfcache.h"
 #include "libewf_libfdata.h"
 #include "libewf_segment_file.h"
@@ -1045,6 +1048,1178 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the chunk data of a batch of consecutive chunks starting at a specific offset
+ * The offset must be aligned with the start of a chunk
+ * The chunk data is read in storage order, sorted by file IO pool entry and
+ * offset within the segment file, instead of media order and then unpacked
+ * Chunks that are stored adjacent to each other are read with a single read
+ * If an IO queue is provided the reads are issued through the IO queue,
+ * which allows multiple reads to be outstanding at the same time
+ * The batch stops at the first chunk that is missing or sparse, such chunks
+ * need to be retrieved with libewf_chunk_table_get_chunk_data_by_offset
+ * Adds a checksum error if the data is corrupted
+ * The caller takes over management of the chunk data
+ * Returns the number of chunks read or -1 on error
+ */
+int libewf_chunk_table_read_chunks_data_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t chunk_index,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libfcache_cache_t *chunk_groups_cache,
+     libewf_io_queue_t *io_queue,
+     off64_t offset,
+     libewf_chunk_data_t **chunks_data,
+     int number_of_chunks,
+     libcerror_error_t **error )
+{
+	off64_t chunk_data_offsets[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	size64_t chunk_data_sizes[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	uint32_t chunk_data_flags[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	size_t read_data_offsets[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	int file_io_pool_entries[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	int read_order[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+
+	libewf_chunk_group_t *chunk_group   = NULL;
+	libewf_segment_file_t *segment_file = NULL;
+	uint8_t *read_data                  = NULL;
+	static char *function               = "libewf_chunk_table_read_chunks_data_by_offset";
+	off64_t chunk_group_data_offset     = 0;
+	off64_t chunk_offset                = 0;
+	off64_t element_data_offset         = 0;
+	off64_t segment_file_data_offset    = 0;
+	size64_t read_data_size             = 0;
+	size64_t run_size                   = 0;
+	ssize_t read_count                  = 0;
+	uint64_t number_of_sectors          = 0;
+	uint64_t start_sector               = 0;
+	uint32_t segment_number             = 0;
+	int batch_index                     = 0;
+	int chunk_groups_list_index         = 0;
+	int chunks_list_index               = 0;
+	int next_batch_index                = 0;
+	int number_of_batched_chunks        = 0;
+	int order_index                     = 0;
+	int result                          = 0;
+	int run_length                      = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid media values - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( offset % media_values->chunk_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunks <= 0 )
+	 || ( number_of_chunks > LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the storage location of the chunks in the batch
+	 */
+	for( batch_index = 0;
+	     batch_index < number_of_chunks;
+	     batch_index++ )
+	{
+		chunks_data[ batch_index ] = NULL;
+
+		chunk_offset = offset + ( (off64_t) batch_index * media_values->chunk_size );
+
+		if( (size64_t) chunk_offset >= media_values->media_size )
+		{
+			break;
+		}
+		result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+			  chunk_table,
+			  file_io_pool,
+			  segment_table,
+			  chunk_groups_cache,
+			  chunk_offset,
+			  &segment_number,
+			  &segment_file_data_offset,
+			  &segment_file,
+			  &chunk_groups_list_index,
+			  &chunk_group_data_offset,
+			  &chunk_group,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file chunk group at 0x%08" PRIx64 ".",
+			 function,
+			 chunk_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libfdata_list_get_element_at_offset(
+			  chunk_group->chunks_list,
+			  chunk_group_data_offset,
+			  &chunks_list_index,
+			  &element_data_offset,
+			  &( file_io_pool_entries[ batch_index ] ),
+			  &( chunk_data_offsets[ batch_index ] ),
+			  &( chunk_data_sizes[ batch_index ] ),
+			  &( chunk_data_flags[ batch_index ] ),
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu64 " from chunk group: %d in segment file: %" PRIu32 " at 0x%08" PRIx64 ".",
+			 function,
+			 chunk_index + batch_index,
+			 chunk_groups_list_index,
+			 segment_number,
+			 segment_file_data_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( element_data_offset != 0 )
+		 || ( ( chunk_data_flags[ batch_index ] & LIBEWF_RANGE_FLAG_IS_SPARSE ) != 0 ) )
+		{
+			break;
+		}
+		/* Insert the chunk in the read order sorted by file IO pool entry and offset
+		 */
+		for( order_index = number_of_batched_chunks;
+		     order_index > 0;
+		     order_index-- )
+		{
+			if( ( file_io_pool_entries[ read_order[ order_index - 1 ] ] < file_io_pool_entries[ batch_index ] )
+			 || ( ( file_io_pool_entries[ read_order[ order_index - 1 ] ] == file_io_pool_entries[ batch_index ] )
+			  &&  ( chunk_data_offsets[ read_order[ order_index - 1 ] ] <= chunk_data_offsets[ batch_index ] ) ) )
+			{
+				break;
+			}
+			read_order[ order_index ] = read_order[ order_index - 1 ];
+		}
+		read_order[ order_index ] = batch_index;
+
+		number_of_batched_chunks++;
+	}
+	/* Determine where the data of every chunk is stored in the read data,
+	 * the read data contains the chunks in storage order
+	 */
+	read_data_size = 0;
+
+	for( order_index = 0;
+	     order_index < number_of_batched_chunks;
+	     order_index++ )
+	{
+		batch_index = read_order[ order_index ];
+
+		if( chunk_data_sizes[ batch_index ] > ( (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - read_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %" PRIu64 " data size value out of bounds.",
+			 function,
+			 chunk_index + batch_index );
+
+			goto on_error;
+		}
+		read_data_offsets[ batch_index ] = (size_t) read_data_size;
+
+		read_data_size += chunk_data_sizes[ batch_index ];
+	}
+	if( read_data_size > 0 )
+	{
+		read_data = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * (size_t) read_data_size );
+
+		if( read_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Read the chunks in storage order, chunks that are stored adjacent to
+	 * each other are read with a single read. When an IO queue is provided
+	 * the reads are queued and issued together, so that they can be serviced
+	 * concurrently
+	 */
+	order_index = 0;
+
+	while( order_index < number_of_batched_chunks )
+	{
+		batch_index = read_order[ order_index ];
+		run_size    = chunk_data_sizes[ batch_index ];
+		run_length  = 1;
+
+		while( ( order_index + run_length ) < number_of_batched_chunks )
+		{
+			next_batch_index = read_order[ order_index + run_length ];
+
+			if( ( file_io_pool_entries[ next_batch_index ] != file_io_pool_entries[ batch_index ] )
+			 || ( chunk_data_offsets[ next_batch_index ] != (off64_t) ( chunk_data_offsets[ batch_index ] + run_size ) )
+			 || ( ( run_size + chunk_data_sizes[ next_batch_index ] ) > (size64_t) LIBEWF_MAXIMUM_COALESCED_READ_SIZE ) )
+			{
+				break;
+			}
+			run_size   += chunk_data_sizes[ next_batch_index ];
+			run_length += 1;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading %d adjacent chunks at offset: 0x%08" PRIx64 " with size: %" PRIu64 " in file IO pool entry: %d.\n",
+			 function,
+			 run_length,
+			 chunk_data_offsets[ batch_index ],
+			 run_size,
+			 file_io_pool_entries[ batch_index ] );
+		}
+#endif
+		if( io_queue != NULL )
+		{
+			if( libewf_io_queue_append_read(
+			     io_queue,
+			     file_io_pool_entries[ batch_index ],
+			     chunk_data_offsets[ batch_index ],
+			     &( read_data[ read_data_offsets[ batch_index ] ] ),
+			     (size_t) run_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to queue read of chunks: %" PRIu64 " - %" PRIu64 ".",
+				 function,
+				 chunk_index + batch_index,
+				 chunk_index + read_order[ order_index + run_length - 1 ] );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libbfio_pool_seek_offset(
+			     file_io_pool,
+			     file_io_pool_entries[ batch_index ],
+			     chunk_data_offsets[ batch_index ],
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIi64 " in file IO pool entry: %d.",
+				 function,
+				 chunk_data_offsets[ batch_index ],
+				 file_io_pool_entries[ batch_index ] );
+
+				goto on_error;
+			}
+			read_count = libbfio_pool_read_buffer(
+			              file_io_pool,
+			              file_io_pool_entries[ batch_index ],
+			              &( read_data[ read_data_offsets[ batch_index ] ] ),
+			              (size_t) run_size,
+			              error );
+
+			if( read_count != (ssize_t) run_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of chunks: %" PRIu64 " - %" PRIu64 ".",
+				 function,
+				 chunk_index + batch_index,
+				 chunk_index + read_order[ order_index + run_length - 1 ] );
+
+				goto on_error;
+			}
+		}
+		order_index += run_length;
+	}
+	if( io_queue != NULL )
+	{
+		if( libewf_io_queue_read(
+		     io_queue,
+		     file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data of chunks: %" PRIu64 " - %" PRIu64 ".",
+			 function,
+			 chunk_index,
+			 chunk_index + number_of_batched_chunks - 1 );
+
+			goto on_error;
+		}
+	}
+	/* Split the read data into the chunks
+	 */
+	for( batch_index = 0;
+	     batch_index < number_of_batched_chunks;
+	     batch_index++ )
+	{
+		if( libewf_chunk_data_initialize(
+		     &( chunks_data[ batch_index ] ),
+		     io_handle->chunk_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index + batch_index );
+
+			goto on_error;
+		}
+		read_count = libewf_chunk_data_read_from_buffer(
+		              chunks_data[ batch_index ],
+		              &( read_data[ read_data_offsets[ batch_index ] ] ),
+		              (size_t) chunk_data_sizes[ batch_index ],
+		              chunk_data_flags[ batch_index ],
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu64 " data from read data.",
+			 function,
+			 chunk_index + batch_index );
+
+			goto on_error;
+		}
+	}
+	if( read_data != NULL )
+	{
+		memory_free(
+		 read_data );
+
+		read_data = NULL;
+	}
+	/* Unpack the chunks in media order
+	 */
+	for( batch_index = 0;
+	     batch_index < number_of_batched_chunks;
+	     batch_index++ )
+	{
+		if( libewf_chunk_data_unpack(
+		     chunks_data[ batch_index ],
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unpack chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index + batch_index );
+
+			goto on_error;
+		}
+		if( ( chunks_data[ batch_index ]->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+		{
+			chunk_offset = offset + ( (off64_t) batch_index * media_values->chunk_size );
+
+			start_sector      = chunk_offset / media_values->bytes_per_sector;
+			number_of_sectors = media_values->sectors_per_chunk;
+
+			if( ( start_sector + number_of_sectors ) > (uint64_t) media_values->number_of_sectors )
+			{
+				number_of_sectors = (uint64_t) media_values->number_of_sectors - start_sector;
+			}
+			if( libcdata_range_list_insert_range(
+			     chunk_table->checksum_errors,
+			     start_sector,
+			     number_of_sectors,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert checksum error in range list.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( number_of_batched_chunks );
+
+on_error:
+	if( io_queue != NULL )
+	{
+		libewf_io_queue_empty(
+		 io_queue,
+		 NULL );
+	}
+	if( read_data != NULL )
+	{
+		memory_free(
+		 read_data );
+	}
+	for( batch_index = 0;
+	     batch_index < number_of_chunks;
+	     batch_index++ )
+	{
+		if( chunks_data[ batch_index ] != NULL )
+		{
+			libewf_chunk_data_free(
+			 &( chunks_data[ batch_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves the fill pattern of a chunk at a specific offset
+ * A chunk is considered filled with a pattern if it is stored using pattern fill
+ * compression or if it is compressed with a high enough ratio and its unpacked
+ * data consists of a repeating 64-bit pattern
+ * Other chunks are not read
+ * Adds a checksum error if the unpacked data is corrupted
+ * Returns 1 if successful, 0 if the chunk is not filled with a pattern or -1 on error
+ */
+int libewf_chunk_table_get_chunk_fill_pattern_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t chunk_index,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libfcache_cache_t *chunk_groups_cache,
+     libfcache_cache_t *chunks_cache,
+     off64_t offset,
+     uint64_t *fill_pattern,
+     libcerror_error_t **error )
+{
+	uint8_t pattern_data[ 8 ];
+
+	libewf_chunk_data_t *chunk_data     = NULL;
+	libewf_chunk_group_t *chunk_group   = NULL;
+	libewf_segment_file_t *segment_file = NULL;
+	static char *function               = "libewf_chunk_table_get_chunk_fill_pattern_by_offset";
+	off64_t chunk_data_offset           = 0;
+	off64_t chunk_group_data_offset     = 0;
+	off64_t element_data_offset         = 0;
+	off64_t segment_file_data_offset    = 0;
+	size64_t chunk_data_size            = 0;
+	ssize_t read_count                  = 0;
+	uint64_t number_of_sectors          = 0;
+	uint64_t start_sector               = 0;
+	uint32_t chunk_data_flags           = 0;
+	uint32_t segment_number             = 0;
+	int chunk_groups_list_index         = 0;
+	int chunks_list_index               = 0;
+	int file_io_pool_entry              = 0;
+	int result                          = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( fill_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fill pattern.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+		  chunk_table,
+		  file_io_pool,
+		  segment_table,
+		  chunk_groups_cache,
+		  offset,
+		  &segment_number,
+		  &segment_file_data_offset,
+		  &segment_file,
+		  &chunk_groups_list_index,
+		  &chunk_group_data_offset,
+		  &chunk_group,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment file chunk group at 0x%08" PRIx64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk group: %d.",
+		 function,
+		 chunk_groups_list_index );
+
+		return( -1 );
+	}
+	result = libfdata_list_get_element_at_offset(
+		  chunk_group->chunks_list,
+		  chunk_group_data_offset,
+		  &chunks_list_index,
+		  &element_data_offset,
+		  &file_io_pool_entry,
+		  &chunk_data_offset,
+		  &chunk_data_size,
+		  &chunk_data_flags,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " from chunk group: %d in segment file: %" PRIu32 " at 0x%08" PRIx64 ".",
+		 function,
+		 chunk_index,
+		 chunk_groups_list_index,
+		 segment_number,
+		 segment_file_data_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data_flags & ( LIBEWF_RANGE_FLAG_IS_SPARSE | LIBEWF_RANGE_FLAG_IS_TAINTED ) ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data_flags & LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) != 0 )
+	{
+		/* The pattern is stored in the table entry
+		 */
+		if( chunk_data_size < 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %" PRIu64 " data size value out of bounds.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( libbfio_pool_seek_offset(
+		     file_io_pool,
+		     file_io_pool_entry,
+		     chunk_data_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in file IO pool entry: %d.",
+			 function,
+			 chunk_data_offset,
+			 file_io_pool_entry );
+
+			return( -1 );
+		}
+		read_count = libbfio_pool_read_buffer(
+		              file_io_pool,
+		              file_io_pool_entry,
+		              pattern_data,
+		              8,
+		              error );
+
+		if( read_count != (ssize_t) 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu64 " pattern data.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 pattern_data,
+		 *fill_pattern );
+
+		return( 1 );
+	}
+	/* Only unpack chunks that compress well enough to potentially contain
+	 * a fill pattern, such as chunks stored using empty-block compression
+	 */
+	if( chunk_data_size > (size64_t) ( media_values->chunk_size / LIBEWF_MINIMUM_FILL_PATTERN_COMPRESSION_RATIO ) )
+	{
+		return( 0 );
+	}
+	result = libfdata_list_get_element_value_at_offset(
+		  chunk_group->chunks_list,
+		  (intptr_t *) file_io_pool,
+		  (libfdata_cache_t *) chunks_cache,
+		  chunk_group_data_offset,
+		  &chunks_list_index,
+		  &element_data_offset,
+		  (intptr_t **) &chunk_data,
+		  0,
+		  error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " data from chunk group: %d in segment file: %" PRIu32 " at 0x%08" PRIx64 ".",
+		 function,
+		 chunk_index,
+		 chunk_groups_list_index,
+		 segment_number,
+		 segment_file_data_offset );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libewf_chunk_data_unpack(
+	     chunk_data,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unpack chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		/* Add checksum error
+		 */
+		start_sector      = offset / media_values->bytes_per_sector;
+		number_of_sectors = media_values->sectors_per_chunk;
+
+		if( ( start_sector + number_of_sectors ) > (uint64_t) media_values->number_of_sectors )
+		{
+			number_of_sectors = (uint64_t) media_values->number_of_sectors - start_sector;
+		}
+		if( libewf_chunk_table_append_checksum_error(
+		     chunk_table,
+		     start_sector,
+		     number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checksum error.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	result = libewf_chunk_data_check_for_64_bit_pattern_fill(
+	          chunk_data->data,
+	          chunk_data->data_size,
+	          fill_pattern,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if chunk: %" PRIu64 " data contains a fill pattern.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the packed (stored) chunk data of a chunk at a specific offset
+ * The chunk data is read from the segment file without using the chunks cache
+ * and is not decompressed. The checksum of uncompressed chunk data is verified
+ * and the header of deflate compressed chunk data is validated
+ * Returns 1 if successful, 0 if the chunk cannot be provided as packed data or -1 on error
+ */
+int libewf_chunk_table_get_packed_chunk_data_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t chunk_index,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libfcache_cache_t *chunk_groups_cache,
+     off64_t offset,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *safe_chunk_data = NULL;
+	libewf_chunk_group_t *chunk_group    = NULL;
+	libewf_segment_file_t *segment_file  = NULL;
+	static char *function                = "libewf_chunk_table_get_packed_chunk_data_by_offset";
+	off64_t chunk_data_offset            = 0;
+	off64_t chunk_group_data_offset      = 0;
+	off64_t element_data_offset          = 0;
+	off64_t segment_file_data_offset     = 0;
+	size64_t chunk_data_size             = 0;
+	ssize_t read_count                   = 0;
+	uint32_t calculated_checksum         = 0;
+	uint32_t chunk_data_flags            = 0;
+	uint32_t segment_number              = 0;
+	uint32_t stored_checksum             = 0;
+	uint16_t compression_header          = 0;
+	int chunk_groups_list_index          = 0;
+	int chunks_list_index                = 0;
+	int file_io_pool_entry               = 0;
+	int result                           = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+		  chunk_table,
+		  file_io_pool,
+		  segment_table,
+		  chunk_groups_cache,
+		  offset,
+		  &segment_number,
+		  &segment_file_data_offset,
+		  &segment_file,
+		  &chunk_groups_list_index,
+		  &chunk_group_data_offset,
+		  &chunk_group,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment file chunk group at 0x%08" PRIx64 ".",
+		 function,
+		 offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk group: %d.",
+		 function,
+		 chunk_groups_list_index );
+
+		goto on_error;
+	}
+	result = libfdata_list_get_element_at_offset(
+		  chunk_group->chunks_list,
+		  chunk_group_data_offset,
+		  &chunks_list_index,
+		  &element_data_offset,
+		  &file_io_pool_entry,
+		  &chunk_data_offset,
+		  &chunk_data_size,
+		  &chunk_data_flags,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " from chunk group: %d in segment file: %" PRIu32 " at 0x%08" PRIx64 ".",
+		 function,
+		 chunk_index,
+		 chunk_groups_list_index,
+		 segment_number,
+		 segment_file_data_offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* Sparse, tainted and corrupted chunks are handled by the regular read
+	 * and the fill pattern of pattern fill chunks is stored in the table entry
+	 */
+	if( ( chunk_data_flags & ( LIBEWF_RANGE_FLAG_IS_SPARSE | LIBEWF_RANGE_FLAG_IS_TAINTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED | LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( chunk_data_size < 4 )
+	 || ( chunk_data_size > (size64_t) media_values->chunk_size + 4 ) )
+	{
+		return( 0 );
+	}
+	if( libewf_chunk_data_initialize(
+	     &safe_chunk_data,
+	     media_values->chunk_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libewf_chunk_data_read_from_file_io_pool(
+	              safe_chunk_data,
+	              file_io_pool,
+	              file_io_pool_entry,
+	              chunk_data_offset,
+	              chunk_data_size,
+	              chunk_data_flags,
+	              error );
+
+	if( read_count != (ssize_t) chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	if( ( chunk_data_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	{
+		/* The deflate checksum is calculated over the uncompressed data
+		 * hence only the zlib header can be validated without decompressing
+		 */
+		if( io_handle->compression_method != LIBEWF_COMPRESSION_METHOD_DEFLATE )
+		{
+			result = 0;
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 safe_chunk_data->data,
+			 compression_header );
+
+			if( ( ( compression_header & 0x0f00 ) != 0x0800 )
+			 || ( ( compression_header % 31 ) != 0 ) )
+			{
+				result = 0;
+			}
+		}
+	}
+	else if( ( chunk_data_flags & LIBEWF_RANGE_FLAG_HAS_CHECKSUM ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( ( safe_chunk_data->data )[ safe_chunk_data->data_size - 4 ] ),
+		 stored_checksum );
+
+		if( libewf_checksum_calculate_adler32(
+		     &calculated_checksum,
+		     safe_chunk_data->data,
+		     safe_chunk_data->data_size - 4,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		if( stored_checksum != calculated_checksum )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: chunk: %" PRIu64 " checksum mismatch ( stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 " ).\n",
+				 function,
+				 chunk_index,
+				 stored_checksum,
+				 calculated_checksum );
+			}
+#endif
+			result = 0;
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+	if( result == 0 )
+	{
+		/* Let the regular read handle the chunk, so that checksum errors are tracked
+		 */
+		if( libewf_chunk_data_free(
+		     &safe_chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	*chunk_data = safe_chunk_data;
+
+	return( 1 );
+
+on_error:
+	if( safe_chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &safe_chunk_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Sets the chunk data of a chunk at a specific offset
  * Adds a checksum error if the data is corrupted
  * Returns 1 if successful or -1 on error
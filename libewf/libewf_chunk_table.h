@@ -27,6 +27,7 @@
 
 #include "libewf_chunk_group.h"
 #include "libewf_io_handle.h"
+#include "libewf_io_queue.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libfcache.h"
@@ -132,6 +133,45 @@ int libewf_chunk_table_get_chunk_data_by_offset(
      off64_t *chunk_data_offset,
      libcerror_error_t **error );
 
+int libewf_chunk_table_read_chunks_data_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t chunk_index,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libfcache_cache_t *chunk_groups_cache,
+     libewf_io_queue_t *io_queue,
+     off64_t offset,
+     libewf_chunk_data_t **chunks_data,
+     int number_of_chunks,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_get_chunk_fill_pattern_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t chunk_index,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libfcache_cache_t *chunk_groups_cache,
+     libfcache_cache_t *chunks_cache,
+     off64_t offset,
+     uint64_t *fill_pattern,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_get_packed_chunk_data_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     uint64_t chunk_index,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     libfcache_cache_t *chunk_groups_cache,
+     off64_t offset,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
 int libewf_chunk_table_set_chunk_data_by_offset(
      libewf_chunk_table_t *chunk_table,
      uint64_t chunk_index,
@@ -92,6 +92,13 @@ ssize_t libewf_data_chunk_read_buffer(
          size_t buffer_size,
          libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+ssize_t libewf_data_chunk_read_buffer_from_copy(
+         libewf_data_chunk_t *data_chunk,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 ssize_t libewf_data_chunk_write_buffer(
          libewf_data_chunk_t *data_chunk,
@@ -99,6 +106,11 @@ ssize_t libewf_data_chunk_write_buffer(
          size_t buffer_size,
          libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_data_chunk_is_corrupted(
+     libewf_data_chunk_t *data_chunk,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
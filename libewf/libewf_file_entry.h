@@ -182,6 +182,38 @@ int libewf_file_entry_get_utf16_short_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libewf_internal_file_entry_get_utf8_path(
+     libewf_internal_file_entry_t *internal_file_entry,
+     uint8_t **utf8_path,
+     size_t *utf8_path_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_file_entry_get_utf8_path_size(
+     libewf_file_entry_t *file_entry,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_file_entry_get_utf8_path(
+     libewf_file_entry_t *file_entry,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_file_entry_get_utf16_path_size(
+     libewf_file_entry_t *file_entry,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_file_entry_get_utf16_path(
+     libewf_file_entry_t *file_entry,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_file_entry_get_size(
      libewf_file_entry_t *file_entry,
@@ -44,6 +44,7 @@
 #include "libewf_header_sections.h"
 #include "libewf_header_values.h"
 #include "libewf_io_handle.h"
+#include "libewf_io_queue.h"
 #include "libewf_lef_file_entry.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcdata.h"
@@ -63,6 +64,7 @@
 #include "libewf_segment_file.h"
 #include "libewf_session_section.h"
 #include "libewf_sha1_hash_section.h"
+#include "libewf_shared_metadata.h"
 #include "libewf_single_file_tree.h"
 #include "libewf_single_files.h"
 #include "libewf_types.h"
@@ -341,6 +343,19 @@ int libewf_handle_free(
 			result = -1;
 		}
 #endif
+		if( libewf_internal_handle_release_shared_metadata(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release shared metadata.",
+			 function );
+
+			result = -1;
+		}
 		if( libewf_segment_table_free(
 		     &( internal_handle->segment_table ),
 		     error ) != 1 )
@@ -429,6 +444,9 @@ int libewf_handle_free(
 }
 
 /* Clones the handle including elements
+ * If the source handle is open, the clone shares the immutable metadata, such as
+ * the media values, segment files list, header and hash values, with the source
+ * handle instead of copying it, the clone has its own file IO pool and caches
  * Returns 1 if successful or -1 on error
  */
 int libewf_handle_clone(
@@ -438,7 +456,9 @@ int libewf_handle_clone(
 {
 	libewf_internal_handle_t *internal_destination_handle = NULL;
 	libewf_internal_handle_t *internal_source_handle      = NULL;
+	libewf_shared_metadata_t *shared_metadata             = NULL;
 	static char *function                                 = "libewf_handle_clone";
+	int result                                            = 1;
 
 	if( destination_handle == NULL )
 	{
@@ -481,7 +501,7 @@ int libewf_handle_clone(
 
 		return( -1 );
 	}
-	if( ( internal_source_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	if( ( internal_source_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -534,67 +554,152 @@ int libewf_handle_clone(
 
 		goto on_error;
 	}
-	if( libewf_media_values_clone(
-	     &( internal_destination_handle->media_values ),
-	     internal_source_handle->media_values,
-	     error ) != 1 )
+	if( internal_source_handle->file_io_pool != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination media values.",
-		 function );
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_source_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
 
-		goto on_error;
-	}
-	if( libcdata_array_clone(
-	     &( internal_destination_handle->sessions ),
-	     internal_source_handle->sessions,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination sessions array.",
-		 function );
+			goto on_error;
+		}
+#endif
+		result = libewf_internal_handle_share_metadata(
+		          internal_source_handle,
+		          error );
 
-		goto on_error;
-	}
-	if( libcdata_array_clone(
-	     &( internal_destination_handle->tracks ),
-	     internal_source_handle->tracks,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination tracks array.",
-		 function );
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to share source handle metadata.",
+			 function );
+		}
+		else
+		{
+			shared_metadata = internal_source_handle->shared_metadata;
 
-		goto on_error;
+			result = libewf_shared_metadata_grab_reference(
+			          shared_metadata,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab reference to shared metadata.",
+				 function );
+
+				shared_metadata = NULL;
+			}
+		}
+		internal_destination_handle->header_values_parsed = internal_source_handle->header_values_parsed;
+		internal_destination_handle->hash_values_parsed   = internal_source_handle->hash_values_parsed;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_source_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		internal_destination_handle->shared_metadata = shared_metadata;
+		internal_destination_handle->media_values    = shared_metadata->media_values;
+		internal_destination_handle->sessions        = shared_metadata->sessions;
+		internal_destination_handle->tracks          = shared_metadata->tracks;
+		internal_destination_handle->acquiry_errors  = shared_metadata->acquiry_errors;
+		internal_destination_handle->hash_sections   = shared_metadata->hash_sections;
+		internal_destination_handle->header_values   = shared_metadata->header_values;
+		internal_destination_handle->hash_values     = shared_metadata->hash_values;
+		internal_destination_handle->single_files    = shared_metadata->single_files;
 	}
-	if( libcdata_range_list_clone(
-	     &( internal_destination_handle->acquiry_errors ),
-	     internal_source_handle->acquiry_errors,
-	     NULL,
-	     NULL,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination acquiry errors range list.",
-		 function );
+		if( libewf_media_values_clone(
+		     &( internal_destination_handle->media_values ),
+		     internal_source_handle->media_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination media values.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libcdata_array_clone(
+		     &( internal_destination_handle->sessions ),
+		     internal_source_handle->sessions,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
+		     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination sessions array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_clone(
+		     &( internal_destination_handle->tracks ),
+		     internal_source_handle->tracks,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
+		     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination tracks array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_range_list_clone(
+		     &( internal_destination_handle->acquiry_errors ),
+		     internal_source_handle->acquiry_errors,
+		     NULL,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination acquiry errors range list.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( internal_source_handle->file_io_pool != NULL )
 	{
@@ -648,10 +753,23 @@ int libewf_handle_clone(
 			goto on_error;
 		}
 	}
-	if( libewf_segment_table_clone(
-	     &( internal_destination_handle->segment_table ),
-	     internal_source_handle->segment_table,
-	     error ) != 1 )
+	if( shared_metadata != NULL )
+	{
+		result = libewf_segment_table_clone_shared(
+		          &( internal_destination_handle->segment_table ),
+		          internal_source_handle->segment_table,
+		          internal_destination_handle->io_handle,
+		          shared_metadata->segment_files_list,
+		          error );
+	}
+	else
+	{
+		result = libewf_segment_table_clone(
+		          &( internal_destination_handle->segment_table ),
+		          internal_source_handle->segment_table,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -713,59 +831,77 @@ int libewf_handle_clone(
 			goto on_error;
 		}
 	}
-	if( internal_source_handle->hash_sections != NULL )
+	if( shared_metadata == NULL )
 	{
-		if( libewf_hash_sections_clone(
-		     &( internal_destination_handle->hash_sections ),
-		     internal_source_handle->hash_sections,
-		     error ) != 1 )
+		if( internal_source_handle->hash_sections != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create destination hash sections.",
-			 function );
+			if( libewf_hash_sections_clone(
+			     &( internal_destination_handle->hash_sections ),
+			     internal_source_handle->hash_sections,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create destination hash sections.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-	}
-	if( internal_source_handle->header_values != NULL )
-	{
-		if( libfvalue_table_clone(
-		     &( internal_destination_handle->header_values ),
-		     internal_source_handle->header_values,
-		     error ) != 1 )
+		if( internal_source_handle->header_values != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create destination header values.",
-			 function );
+			if( libfvalue_table_clone(
+			     &( internal_destination_handle->header_values ),
+			     internal_source_handle->header_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create destination header values.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			internal_destination_handle->header_values_parsed = internal_source_handle->header_values_parsed;
 		}
-		internal_destination_handle->header_values_parsed = internal_source_handle->header_values_parsed;
-	}
-	if( internal_source_handle->hash_values != NULL )
-	{
-		if( libfvalue_table_clone(
-		     &( internal_destination_handle->hash_values ),
-		     internal_source_handle->hash_values,
-		     error ) != 1 )
+		if( internal_source_handle->hash_values != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create destination hash values.",
-			 function );
+			if( libfvalue_table_clone(
+			     &( internal_destination_handle->hash_values ),
+			     internal_source_handle->hash_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create destination hash values.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			internal_destination_handle->hash_values_parsed = internal_source_handle->hash_values_parsed;
 		}
-		internal_destination_handle->hash_values_parsed = internal_source_handle->hash_values_parsed;
 	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_destination_handle->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	internal_destination_handle->maximum_number_of_open_handles = internal_source_handle->maximum_number_of_open_handles;
 	internal_destination_handle->date_format                    = internal_source_handle->date_format;
 
@@ -776,6 +912,26 @@ int libewf_handle_clone(
 on_error:
 	if( internal_destination_handle != NULL )
 	{
+		if( internal_destination_handle->shared_metadata != NULL )
+		{
+			internal_destination_handle->media_values   = NULL;
+			internal_destination_handle->sessions       = NULL;
+			internal_destination_handle->tracks         = NULL;
+			internal_destination_handle->acquiry_errors = NULL;
+			internal_destination_handle->hash_sections  = NULL;
+			internal_destination_handle->header_values  = NULL;
+			internal_destination_handle->hash_values    = NULL;
+
+			libewf_shared_metadata_release_reference(
+			 &( internal_destination_handle->shared_metadata ),
+			 NULL );
+		}
+		else if( shared_metadata != NULL )
+		{
+			libewf_shared_metadata_release_reference(
+			 &shared_metadata,
+			 NULL );
+		}
 		if( internal_destination_handle->hash_values != NULL )
 		{
 			libfvalue_table_free(
@@ -875,17 +1031,18 @@ on_error:
 	return( -1 );
 }
 
-/* Signals the handle to abort its current activity
+/* Moves the metadata of an open handle into shared metadata
+ * The handle keeps referencing the metadata but no longer manages it
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_signal_abort(
-     libewf_handle_t *handle,
+int libewf_internal_handle_share_metadata(
+     libewf_internal_handle_t *internal_handle,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_signal_abort";
+	libewf_shared_metadata_t *shared_metadata = NULL;
+	static char *function                     = "libewf_internal_handle_share_metadata";
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -896,32 +1053,281 @@ int libewf_handle_signal_abort(
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
-
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 "%s: invalid handle - missing segment table.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->io_handle->abort = 1;
-
-	return( 1 );
-}
-
-/* Opens a set of EWF file(s)
- * For reading files should contain all filenames that make up an EWF image
- * For writing files should contain the base of the filename, extentions like .e01 will be automatically added
- * Returns 1 if successful or -1 on error
- */
-int libewf_handle_open(
-     libewf_handle_t *handle,
-     char * const filenames[],
+	if( internal_handle->shared_metadata != NULL )
+	{
+		return( 1 );
+	}
+	/* The hash values are parsed on demand, parse them before sharing
+	 * so that the shared metadata is not changed afterwards
+	 */
+	if( ( internal_handle->hash_values_parsed == 0 )
+	 && ( internal_handle->hash_sections != NULL ) )
+	{
+		if( libewf_internal_handle_parse_hash_values(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse hash values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_handle->hash_values_parsed = 1;
+
+	/* The media order file nodes are created on demand, create them before sharing
+	 * so that the shared single files are not changed afterwards
+	 */
+	if( internal_handle->single_files != NULL )
+	{
+		if( libewf_single_files_create_media_order_file_nodes(
+		     internal_handle->single_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create media order file nodes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libewf_shared_metadata_initialize(
+	     &shared_metadata,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create shared metadata.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_clone(
+	     &( shared_metadata->segment_files_list ),
+	     internal_handle->segment_table->segment_files_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create shared segment files list.",
+		 function );
+
+		goto on_error;
+	}
+	shared_metadata->media_values   = internal_handle->media_values;
+	shared_metadata->sessions       = internal_handle->sessions;
+	shared_metadata->tracks         = internal_handle->tracks;
+	shared_metadata->acquiry_errors = internal_handle->acquiry_errors;
+	shared_metadata->hash_sections  = internal_handle->hash_sections;
+	shared_metadata->header_values  = internal_handle->header_values;
+	shared_metadata->hash_values    = internal_handle->hash_values;
+	shared_metadata->single_files   = internal_handle->single_files;
+
+	internal_handle->shared_metadata = shared_metadata;
+
+	return( 1 );
+
+on_error:
+	if( shared_metadata != NULL )
+	{
+		libewf_shared_metadata_free(
+		 &shared_metadata,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases the shared metadata of a handle
+ * The handle is provided with new empty metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_release_shared_metadata(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_release_shared_metadata";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->shared_metadata == NULL )
+	{
+		return( 1 );
+	}
+	if( libewf_segment_table_unshare(
+	     internal_handle->segment_table,
+	     internal_handle->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unshare segment table.",
+		 function );
+
+		result = -1;
+	}
+	internal_handle->media_values   = NULL;
+	internal_handle->sessions       = NULL;
+	internal_handle->tracks         = NULL;
+	internal_handle->acquiry_errors = NULL;
+	internal_handle->hash_sections  = NULL;
+	internal_handle->header_values  = NULL;
+	internal_handle->hash_values    = NULL;
+	internal_handle->single_files   = NULL;
+
+	if( libewf_shared_metadata_release_reference(
+	     &( internal_handle->shared_metadata ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release reference to shared metadata.",
+		 function );
+
+		result = -1;
+	}
+	if( libewf_media_values_initialize(
+	     &( internal_handle->media_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->sessions ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sessions array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->tracks ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create tracks array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_initialize(
+	     &( internal_handle->acquiry_errors ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create acquiry errors range list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->header_values_parsed = 0;
+	internal_handle->hash_values_parsed   = 0;
+
+	return( result );
+}
+
+/* Signals the handle to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_signal_abort(
+     libewf_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_signal_abort";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->io_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens a set of EWF file(s)
+ * For reading files should contain all filenames that make up an EWF image
+ * For writing files should contain the base of the filename, extentions like .e01 will be automatically added
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_open(
+     libewf_handle_t *handle,
+     char * const filenames[],
      int number_of_filenames,
      int access_flags,
      libcerror_error_t **error )
@@ -4026,6 +4432,22 @@ int libewf_handle_close(
 			result = -1;
 		}
 	}
+	if( internal_handle->io_queue != NULL )
+	{
+		if( libewf_io_queue_free(
+		     &( internal_handle->io_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO queue.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( internal_handle->file_io_pool_created_in_library != 0 )
 	{
 		if( libbfio_pool_close_all(
@@ -4058,6 +4480,19 @@ int libewf_handle_close(
 	}
 	internal_handle->file_io_pool = NULL;
 
+	if( libewf_internal_handle_release_shared_metadata(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release shared metadata.",
+		 function );
+
+		result = -1;
+	}
 	if( libewf_io_handle_clear(
 	     internal_handle->io_handle,
 	     error ) != 1 )
@@ -4343,12 +4778,17 @@ ssize_t libewf_internal_handle_read_buffer_from_file_io_pool(
          size_t buffer_size,
          libcerror_error_t **error )
 {
+	libewf_chunk_data_t *batched_chunks_data[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+
 	libewf_chunk_data_t *chunk_data = NULL;
+	libewf_io_queue_t *io_queue     = NULL;
 	static char *function           = "libewf_internal_handle_read_buffer_from_file_io_pool";
 	off64_t chunk_data_offset       = 0;
 	uint64_t chunk_index            = 0;
 	size_t buffer_offset            = 0;
 	size_t read_size                = 0;
+	int batch_index                 = 0;
+	int number_of_batched_chunks    = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -4450,31 +4890,111 @@ ssize_t libewf_internal_handle_read_buffer_from_file_io_pool(
 	}
 	chunk_index = internal_handle->current_offset / internal_handle->media_values->chunk_size;
 
-	while( buffer_size > 0 )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The IO queue is only used when concurrent reads were enabled and reads
+	 * using clones of the file IO pool, hence it is only used when the file IO pool
+	 * was created inside the library and the handle is not used for writing
+	 */
+	if( ( internal_handle->maximum_number_of_concurrent_reads > 0 )
+	 && ( internal_handle->write_io_handle == NULL )
+	 && ( file_io_pool == internal_handle->file_io_pool )
+	 && ( internal_handle->file_io_pool_created_in_library != 0 )
+	 && ( buffer_size >= ( 2 * (size_t) internal_handle->media_values->chunk_size ) ) )
 	{
-		if( libewf_chunk_table_get_chunk_data_by_offset(
-		     internal_handle->chunk_table,
-		     chunk_index,
-		     internal_handle->io_handle,
-		     file_io_pool,
-		     internal_handle->media_values,
-		     internal_handle->segment_table,
-		     internal_handle->chunk_groups_cache,
-		     internal_handle->chunks_cache,
-		     internal_handle->current_offset,
-		     &chunk_data,
-		     &chunk_data_offset,
-		     error ) != 1 )
+		if( internal_handle->io_queue == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to read chunk: %" PRIu64 " data.",
-			 function,
-			 chunk_index );
+			if( libewf_io_queue_initialize(
+			     &( internal_handle->io_queue ),
+			     internal_handle->maximum_number_of_concurrent_reads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create IO queue.",
+				 function );
 
-			return( -1 );
+				goto on_error;
+			}
+		}
+		io_queue = internal_handle->io_queue;
+	}
+#endif
+	while( buffer_size > 0 )
+	{
+		/* When the read spans multiple complete chunks read them in a single batch
+		 * The batched chunk data is stored in the chunks cache after it has been copied
+		 */
+		if( ( batch_index >= number_of_batched_chunks )
+		 && ( internal_handle->write_io_handle == NULL )
+		 && ( ( internal_handle->current_offset % internal_handle->media_values->chunk_size ) == 0 )
+		 && ( buffer_size >= ( 2 * (size_t) internal_handle->media_values->chunk_size ) ) )
+		{
+			number_of_batched_chunks = (int) ( buffer_size / internal_handle->media_values->chunk_size );
+
+			if( number_of_batched_chunks > LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS )
+			{
+				number_of_batched_chunks = LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS;
+			}
+			number_of_batched_chunks = libewf_chunk_table_read_chunks_data_by_offset(
+			                            internal_handle->chunk_table,
+			                            chunk_index,
+			                            internal_handle->io_handle,
+			                            file_io_pool,
+			                            internal_handle->media_values,
+			                            internal_handle->segment_table,
+			                            internal_handle->chunk_groups_cache,
+			                            io_queue,
+			                            internal_handle->current_offset,
+			                            batched_chunks_data,
+			                            number_of_batched_chunks,
+			                            error );
+
+			if( number_of_batched_chunks == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read batch of chunks data starting with chunk: %" PRIu64 ".",
+				 function,
+				 chunk_index );
+
+				number_of_batched_chunks = 0;
+
+				goto on_error;
+			}
+			batch_index = 0;
+		}
+		if( batch_index < number_of_batched_chunks )
+		{
+			chunk_data        = batched_chunks_data[ batch_index ];
+			chunk_data_offset = 0;
+		}
+		else if( libewf_chunk_table_get_chunk_data_by_offset(
+		          internal_handle->chunk_table,
+		          chunk_index,
+		          internal_handle->io_handle,
+		          file_io_pool,
+		          internal_handle->media_values,
+		          internal_handle->segment_table,
+		          internal_handle->chunk_groups_cache,
+		          internal_handle->chunks_cache,
+		          internal_handle->current_offset,
+		          &chunk_data,
+		          &chunk_data_offset,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
 		}
 		if( chunk_data == NULL )
 		{
@@ -4486,7 +5006,7 @@ ssize_t libewf_internal_handle_read_buffer_from_file_io_pool(
 			 function,
 			 chunk_index );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( (off64_t) chunk_data_offset > (off64_t) chunk_data->data_size )
 		{
@@ -4498,7 +5018,7 @@ ssize_t libewf_internal_handle_read_buffer_from_file_io_pool(
 			 function,
 			 chunk_index );
 
-			return( -1 );
+			goto on_error;
 		}
 		read_size = (size_t) ( chunk_data->data_size - chunk_data_offset );
 
@@ -4523,7 +5043,36 @@ ssize_t libewf_internal_handle_read_buffer_from_file_io_pool(
 			 function,
 			 chunk_index );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( batch_index < number_of_batched_chunks )
+		{
+			if( libewf_chunk_table_set_chunk_data_by_offset(
+			     internal_handle->chunk_table,
+			     chunk_index,
+			     file_io_pool,
+			     internal_handle->segment_table,
+			     internal_handle->chunk_groups_cache,
+			     internal_handle->chunks_cache,
+			     internal_handle->current_offset,
+			     batched_chunks_data[ batch_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to cache chunk: %" PRIu64 " data.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			/* The chunks cache takes over management of the chunk data
+			 */
+			batched_chunks_data[ batch_index ] = NULL;
+
+			batch_index++;
 		}
 		buffer_offset    += read_size;
 		buffer_size      -= read_size;
@@ -4542,9 +5091,40 @@ ssize_t libewf_internal_handle_read_buffer_from_file_io_pool(
 		chunk_data        = NULL;
 		chunk_data_offset = 0;
 	}
+	while( batch_index < number_of_batched_chunks )
+	{
+		if( libewf_chunk_data_free(
+		     &( batched_chunks_data[ batch_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free batched chunk data: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+		batch_index++;
+	}
 	internal_handle->io_handle->abort = 0;
 
 	return( (ssize_t) buffer_offset );
+
+on_error:
+	while( batch_index < number_of_batched_chunks )
+	{
+		if( batched_chunks_data[ batch_index ] != NULL )
+		{
+			libewf_chunk_data_free(
+			 &( batched_chunks_data[ batch_index ] ),
+			 NULL );
+		}
+		batch_index++;
+	}
+	return( -1 );
 }
 
 /* Reads (media) data at the current offset into a buffer
@@ -4739,7 +5319,721 @@ ssize_t libewf_handle_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( read_count );
+}
+
+/* Reads (media) data of multiple ranges into their corresponding buffers
+ * The ranges are read in order of their offset. Data of a range that overlaps
+ * with the previously read ranges is copied from the buffer of the range it
+ * overlaps with and the remainder of a chunk shared with a previous range is
+ * retrieved from the chunks cache, so that the data of a chunk that is shared
+ * by multiple ranges is only read and unpacked once
+ * The read count of each range is stored in read_counts, where -1 indicates
+ * that the range could not be read
+ * The current offset of the handle is not changed
+ * Returns 1 if all ranges were read, 0 if one or more ranges could not be read or -1 on error
+ */
+int libewf_handle_read_ranges(
+     libewf_handle_t *handle,
+     const off64_t *range_offsets,
+     const size_t *range_sizes,
+     void * const *buffers,
+     ssize_t *read_counts,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *range_error            = NULL;
+	libewf_internal_handle_t *internal_handle = NULL;
+	uint8_t *overlap_data                     = NULL;
+	int *range_indexes                        = NULL;
+	static char *function                     = "libewf_handle_read_ranges";
+	off64_t current_offset                    = 0;
+	off64_t previous_range_end_offset         = 0;
+	size_t overlap_size                       = 0;
+	ssize_t read_count                        = 0;
+	ssize_t remainder_read_count              = 0;
+	int gap                                   = 0;
+	int previous_range_index                  = -1;
+	int range_index                           = 0;
+	int result                                = 1;
+	int sort_index                            = 0;
+	int value_index                           = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_ranges < 0 )
+	 || ( (size_t) number_of_ranges > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	range_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * number_of_ranges );
+
+	if( range_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range indexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the range indexes by offset using a shell sort
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		range_indexes[ range_index ] = range_index;
+	}
+	for( gap = number_of_ranges / 2;
+	     gap > 0;
+	     gap /= 2 )
+	{
+		for( sort_index = gap;
+		     sort_index < number_of_ranges;
+		     sort_index++ )
+		{
+			range_index = range_indexes[ sort_index ];
+
+			for( value_index = sort_index;
+			     value_index >= gap;
+			     value_index -= gap )
+			{
+				if( range_offsets[ range_indexes[ value_index - gap ] ] <= range_offsets[ range_index ] )
+				{
+					break;
+				}
+				range_indexes[ value_index ] = range_indexes[ value_index - gap ];
+			}
+			range_indexes[ value_index ] = range_index;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 range_indexes );
+
+		return( -1 );
+	}
+#endif
+	current_offset = internal_handle->current_offset;
+
+	for( sort_index = 0;
+	     sort_index < number_of_ranges;
+	     sort_index++ )
+	{
+		range_index = range_indexes[ sort_index ];
+		read_count  = 0;
+
+		/* Copy the data that overlaps with the previously read range
+		 * with the largest end offset instead of reading it again
+		 */
+		if( ( previous_range_index != -1 )
+		 && ( range_offsets[ range_index ] < previous_range_end_offset ) )
+		{
+			overlap_size = (size_t) ( previous_range_end_offset - range_offsets[ range_index ] );
+
+			if( overlap_size > range_sizes[ range_index ] )
+			{
+				overlap_size = range_sizes[ range_index ];
+			}
+			overlap_data = &( ( (uint8_t *) buffers[ previous_range_index ] )[ range_offsets[ range_index ] - range_offsets[ previous_range_index ] ] );
+
+			if( ( overlap_size > 0 )
+			 && ( (uint8_t *) buffers[ range_index ] != overlap_data ) )
+			{
+				if( memory_copy(
+				     buffers[ range_index ],
+				     overlap_data,
+				     overlap_size ) == NULL )
+				{
+					libcerror_error_set(
+					 &range_error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy overlapping data of range: %d.",
+					 function,
+					 range_index );
+
+					read_count = -1;
+				}
+			}
+			if( read_count != -1 )
+			{
+				read_count = (ssize_t) overlap_size;
+			}
+		}
+		if( ( read_count != -1 )
+		 && ( (size_t) read_count < range_sizes[ range_index ] ) )
+		{
+			if( libewf_internal_handle_seek_offset(
+			     internal_handle,
+			     range_offsets[ range_index ] + read_count,
+			     SEEK_SET,
+			     &range_error ) == -1 )
+			{
+				libcerror_error_set(
+				 &range_error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek range: %d offset.",
+				 function,
+				 range_index );
+
+				read_count = -1;
+			}
+			else
+			{
+				remainder_read_count = libewf_internal_handle_read_buffer_from_file_io_pool(
+				                        internal_handle,
+				                        internal_handle->file_io_pool,
+				                        &( ( (uint8_t *) buffers[ range_index ] )[ read_count ] ),
+				                        range_sizes[ range_index ] - (size_t) read_count,
+				                        &range_error );
+
+				if( remainder_read_count == -1 )
+				{
+					libcerror_error_set(
+					 &range_error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read range: %d.",
+					 function,
+					 range_index );
+
+					read_count = -1;
+				}
+				else
+				{
+					read_count += remainder_read_count;
+				}
+			}
+		}
+		if( ( read_count > 0 )
+		 && ( ( range_offsets[ range_index ] + read_count ) > previous_range_end_offset ) )
+		{
+			previous_range_index      = range_index;
+			previous_range_end_offset = range_offsets[ range_index ] + read_count;
+		}
+		if( read_count == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 range_error );
+			}
+#endif
+			libcerror_error_free(
+			 &range_error );
+
+			result = 0;
+		}
+		read_counts[ range_index ] = read_count;
+	}
+	internal_handle->current_offset = current_offset;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 range_indexes );
+
+		return( -1 );
+	}
+#endif
+	memory_free(
+	 range_indexes );
+
+	return( result );
+}
+
+/* Retrieves the fill pattern of a specific chunk
+ * Returns 1 if successful, 0 if the chunk is not filled with a pattern or -1 on error
+ */
+int libewf_internal_handle_get_chunk_fill_pattern(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     uint64_t *fill_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_get_chunk_fill_pattern";
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index >= internal_handle->media_values->number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libewf_chunk_table_get_chunk_fill_pattern_by_offset(
+	          internal_handle->chunk_table,
+	          chunk_index,
+	          internal_handle->io_handle,
+	          internal_handle->file_io_pool,
+	          internal_handle->media_values,
+	          internal_handle->segment_table,
+	          internal_handle->chunk_groups_cache,
+	          internal_handle->chunks_cache,
+	          (off64_t) ( chunk_index * internal_handle->media_values->chunk_size ),
+	          fill_pattern,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " fill pattern.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the fill pattern of a specific chunk
+ * The fill pattern is a 64-bit value of which the bytes are repeated in
+ * little-endian order e.g. 0 for a chunk that only contains 0-byte values
+ * Only chunks stored using pattern fill or with a high compression ratio
+ * are checked, other chunks are not read
+ * Returns 1 if successful, 0 if the chunk is not filled with a pattern or -1 on error
+ */
+int libewf_handle_get_chunk_fill_pattern(
+     libewf_handle_t *handle,
+     uint64_t chunk_index,
+     uint64_t *fill_pattern,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_chunk_fill_pattern";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_internal_handle_get_chunk_fill_pattern(
+	          internal_handle,
+	          chunk_index,
+	          fill_pattern,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " fill pattern.",
+		 function,
+		 chunk_index );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next (media) data region at or after a specific offset
+ * A data region consists of consecutive chunks that are not known to be filled
+ * with 0-byte values, chunks that are, are considered a hole (comparable to
+ * SEEK_DATA and SEEK_HOLE) and do not need to be read
+ * Returns 1 if successful, 0 if no data region was found or -1 on error
+ */
+int libewf_handle_get_next_data_region(
+     libewf_handle_t *handle,
+     off64_t offset,
+     off64_t *region_offset,
+     size64_t *region_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_next_data_region";
+	size64_t chunk_size                       = 0;
+	uint64_t chunk_index                      = 0;
+	uint64_t fill_pattern                     = 0;
+	uint64_t first_chunk_index                = 0;
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= internal_handle->media_values->media_size )
+	{
+		return( 0 );
+	}
+	chunk_size  = internal_handle->media_values->chunk_size;
+	chunk_index = (uint64_t) offset / chunk_size;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Skip the chunks that are filled with 0-byte values
+	 */
+	while( chunk_index < internal_handle->media_values->number_of_chunks )
+	{
+		result = libewf_internal_handle_get_chunk_fill_pattern(
+		          internal_handle,
+		          chunk_index,
+		          &fill_pattern,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu64 " fill pattern.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( ( result == 0 )
+		 || ( fill_pattern != 0 ) )
+		{
+			break;
+		}
+		chunk_index++;
+	}
+	first_chunk_index = chunk_index;
+
+	/* Determine the end of the data region
+	 */
+	while( chunk_index < internal_handle->media_values->number_of_chunks )
+	{
+		result = libewf_internal_handle_get_chunk_fill_pattern(
+		          internal_handle,
+		          chunk_index,
+		          &fill_pattern,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu64 " fill pattern.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( ( result != 0 )
+		 && ( fill_pattern == 0 ) )
+		{
+			break;
+		}
+		chunk_index++;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( first_chunk_index >= internal_handle->media_values->number_of_chunks )
+	{
+		return( 0 );
+	}
+	*region_offset = (off64_t) ( first_chunk_index * chunk_size );
+
+	if( *region_offset < offset )
+	{
+		*region_offset = offset;
+	}
+	if( ( chunk_index * chunk_size ) < internal_handle->media_values->media_size )
+	{
+		*region_size = ( chunk_index * chunk_size ) - (size64_t) *region_offset;
+	}
+	else
+	{
+		*region_size = internal_handle->media_values->media_size - (size64_t) *region_offset;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* Writes (media) data at the current offset from a buffer using a Basic File IO (bfio) pool
@@ -5458,7 +6752,267 @@ int libewf_handle_get_data_chunk(
 		 "%s: unable to create data chunk.",
 		 function );
 
-		goto on_error;
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads a (media) data chunk at the current offset
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read, 0 when no longer data can be read or -1 on error
+ */
+ssize_t libewf_internal_handle_read_data_chunk_from_file_io_pool(
+         libewf_internal_handle_t *internal_handle,
+         libbfio_pool_t *file_io_pool,
+         libewf_internal_data_chunk_t *internal_data_chunk,
+         libcerror_error_t **error )
+{
+	libewf_chunk_data_t *chunk_data = NULL;
+	static char *function           = "libewf_internal_handle_read_data_chunk_from_file_io_pool";
+	off64_t chunk_data_offset       = 0;
+	ssize_t read_count              = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - chunk data set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_handle->current_offset >= internal_handle->media_values->media_size )
+	{
+		return( 0 );
+	}
+/* TODO remove need to calculate */
+	internal_handle->current_chunk_index = internal_handle->current_offset
+	                                     / internal_handle->media_values->chunk_size;
+
+	internal_handle->current_offset = (off64_t) internal_handle->current_chunk_index
+	                                * (off64_t) internal_handle->media_values->chunk_size;
+
+	if( libewf_chunk_table_get_chunk_data_by_offset(
+	     internal_handle->chunk_table,
+	     internal_handle->current_chunk_index,
+	     internal_handle->io_handle,
+	     file_io_pool,
+	     internal_handle->media_values,
+	     internal_handle->segment_table,
+	     internal_handle->chunk_groups_cache,
+	     internal_handle->chunks_cache,
+	     internal_handle->current_offset,
+	     &chunk_data,
+	     &chunk_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu64 " data.",
+		 function,
+		 internal_handle->current_chunk_index );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk: %" PRIu64 " data.",
+		 function,
+		 internal_handle->current_chunk_index );
+
+		return( -1 );
+	}
+	read_count = (ssize_t) chunk_data->data_size;
+
+	if( libewf_internal_data_chunk_set_chunk_data(
+	     internal_data_chunk,
+	     internal_handle->current_chunk_index,
+	     chunk_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk: %" PRIu64 " data in data chunk.",
+		 function,
+		 internal_handle->current_chunk_index );
+
+		return( -1 );
+	}
+	internal_data_chunk->data_size = (size_t) read_count;
+
+	internal_handle->current_offset += read_count;
+
+	internal_handle->current_chunk_index++;
+
+	return( read_count );
+}
+
+/* Reads a (media) data chunk at the current offset
+ * Returns the number of bytes read, 0 when no longer data can be read or -1 on error
+ */
+ssize_t libewf_handle_read_data_chunk(
+         libewf_handle_t *handle,
+         libewf_data_chunk_t *data_chunk,
+         libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_read_data_chunk";
+	ssize_t read_count                        = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libewf_internal_handle_read_data_chunk_from_file_io_pool(
+	              internal_handle,
+	              internal_handle->file_io_pool,
+	              (libewf_internal_data_chunk_t *) data_chunk,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data chunk.",
+		 function );
+
+		read_count = -1;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -5475,31 +7029,26 @@ int libewf_handle_get_data_chunk(
 		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( read_count );
 }
 
-/* Reads a (media) data chunk at the current offset
+/* Reads a (media) data chunk at the current offset as packed (stored) chunk data
+ * Chunks that cannot be provided as packed data, such as sparse chunks or chunks
+ * with a checksum mismatch, are read as unpacked chunk data instead
  * This function is not multi-thread safe acquire write lock before call
  * Returns the number of bytes read, 0 when no longer data can be read or -1 on error
  */
-ssize_t libewf_internal_handle_read_data_chunk_from_file_io_pool(
+ssize_t libewf_internal_handle_read_packed_data_chunk_from_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
          libewf_internal_data_chunk_t *internal_data_chunk,
          libcerror_error_t **error )
 {
 	libewf_chunk_data_t *chunk_data = NULL;
-	static char *function           = "libewf_internal_handle_read_data_chunk_from_file_io_pool";
-	off64_t chunk_data_offset       = 0;
+	static char *function           = "libewf_internal_handle_read_packed_data_chunk_from_file_io_pool";
+	size64_t remaining_media_size   = 0;
 	ssize_t read_count              = 0;
+	int result                      = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -5512,28 +7061,6 @@ ssize_t libewf_internal_handle_read_data_chunk_from_file_io_pool(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_handle->chunk_data != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - chunk data set.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_handle->current_offset < 0 )
 	{
 		libcerror_error_set(
@@ -5582,51 +7109,60 @@ ssize_t libewf_internal_handle_read_data_chunk_from_file_io_pool(
 	{
 		return( 0 );
 	}
-/* TODO remove need to calculate */
-	internal_handle->current_chunk_index = internal_handle->current_offset
-	                                     / internal_handle->media_values->chunk_size;
+	/* Chunks of a handle opened for writing can have been modified in memory
+	 */
+	if( internal_handle->write_io_handle == NULL )
+	{
+		internal_handle->current_chunk_index = internal_handle->current_offset
+		                                     / internal_handle->media_values->chunk_size;
+
+		internal_handle->current_offset = (off64_t) internal_handle->current_chunk_index
+		                                * (off64_t) internal_handle->media_values->chunk_size;
+
+		result = libewf_chunk_table_get_packed_chunk_data_by_offset(
+		          internal_handle->chunk_table,
+		          internal_handle->current_chunk_index,
+		          internal_handle->io_handle,
+		          file_io_pool,
+		          internal_handle->media_values,
+		          internal_handle->segment_table,
+		          internal_handle->chunk_groups_cache,
+		          internal_handle->current_offset,
+		          &chunk_data,
+		          error );
 
-	internal_handle->current_offset = (off64_t) internal_handle->current_chunk_index
-	                                * (off64_t) internal_handle->media_values->chunk_size;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu64 " packed data.",
+			 function,
+			 internal_handle->current_chunk_index );
 
-	if( libewf_chunk_table_get_chunk_data_by_offset(
-	     internal_handle->chunk_table,
-	     internal_handle->current_chunk_index,
-	     internal_handle->io_handle,
-	     file_io_pool,
-	     internal_handle->media_values,
-	     internal_handle->segment_table,
-	     internal_handle->chunk_groups_cache,
-	     internal_handle->chunks_cache,
-	     internal_handle->current_offset,
-	     &chunk_data,
-	     &chunk_data_offset,
-	     error ) != 1 )
+			goto on_error;
+		}
+	}
+	if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve chunk: %" PRIu64 " data.",
-		 function,
-		 internal_handle->current_chunk_index );
+		return( libewf_internal_handle_read_data_chunk_from_file_io_pool(
+		         internal_handle,
+		         file_io_pool,
+		         internal_data_chunk,
+		         error ) );
+	}
+	remaining_media_size = internal_handle->media_values->media_size
+	                     - (size64_t) internal_handle->current_offset;
 
-		return( -1 );
+	if( remaining_media_size > (size64_t) internal_handle->media_values->chunk_size )
+	{
+		read_count = (ssize_t) internal_handle->media_values->chunk_size;
 	}
-	if( chunk_data == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing chunk: %" PRIu64 " data.",
-		 function,
-		 internal_handle->current_chunk_index );
-
-		return( -1 );
+		read_count = (ssize_t) remaining_media_size;
 	}
-	read_count = (ssize_t) chunk_data->data_size;
-
 	if( libewf_internal_data_chunk_set_chunk_data(
 	     internal_data_chunk,
 	     internal_handle->current_chunk_index,
@@ -5641,25 +7177,52 @@ ssize_t libewf_internal_handle_read_data_chunk_from_file_io_pool(
 		 function,
 		 internal_handle->current_chunk_index );
 
-		return( -1 );
+		goto on_error;
+	}
+	internal_data_chunk->data_size = (size_t) read_count;
+
+	if( libewf_chunk_data_free(
+	     &chunk_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk data.",
+		 function );
+
+		goto on_error;
 	}
 	internal_handle->current_offset += read_count;
 
 	internal_handle->current_chunk_index++;
 
 	return( read_count );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Reads a (media) data chunk at the current offset
+/* Reads a (media) data chunk at the current offset as packed (stored) chunk data
+ * The data chunk can be written to another handle with libewf_handle_write_data_chunk
+ * without decompressing and recompressing the chunk data if the chunk size and
+ * compression method of both handles match
  * Returns the number of bytes read, 0 when no longer data can be read or -1 on error
  */
-ssize_t libewf_handle_read_data_chunk(
+ssize_t libewf_handle_read_packed_data_chunk(
          libewf_handle_t *handle,
          libewf_data_chunk_t *data_chunk,
          libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_read_data_chunk";
+	static char *function                     = "libewf_handle_read_packed_data_chunk";
 	ssize_t read_count                        = 0;
 
 	if( handle == NULL )
@@ -5701,7 +7264,7 @@ ssize_t libewf_handle_read_data_chunk(
 		return( -1 );
 	}
 #endif
-	read_count = libewf_internal_handle_read_data_chunk_from_file_io_pool(
+	read_count = libewf_internal_handle_read_packed_data_chunk_from_file_io_pool(
 	              internal_handle,
 	              internal_handle->file_io_pool,
 	              (libewf_internal_data_chunk_t *) data_chunk,
@@ -5713,7 +7276,7 @@ ssize_t libewf_handle_read_data_chunk(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data chunk.",
+		 "%s: unable to read packed data chunk.",
 		 function );
 
 		read_count = -1;
@@ -5750,6 +7313,7 @@ ssize_t libewf_internal_handle_write_data_chunk_to_file_io_pool(
 	size_t data_size      = 0;
 	ssize_t write_count   = 0;
 	int chunk_exists      = 0;
+	int result            = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -5910,6 +7474,92 @@ ssize_t libewf_internal_handle_write_data_chunk_to_file_io_pool(
 
 		return( -1 );
 	}
+	/* A data chunk of another handle contains chunk data packed for that handle
+	 */
+	if( ( internal_data_chunk->io_handle != NULL )
+	 && ( internal_data_chunk->io_handle != internal_handle->io_handle ) )
+	{
+		if( internal_data_chunk->chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid data chunk - missing chunk data.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_data_chunk->chunk_data->chunk_size != internal_handle->media_values->chunk_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data chunk - chunk size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		result = libewf_chunk_data_prepare_packed_write(
+		          internal_data_chunk->chunk_data,
+		          internal_data_chunk->io_handle,
+		          internal_handle->io_handle,
+		          internal_handle->write_io_handle->pack_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to prepare chunk: %" PRIu64 " packed data for write.",
+			 function,
+			 internal_handle->current_chunk_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( ( internal_data_chunk->chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_PACKED ) != 0 )
+			{
+				if( libewf_chunk_data_unpack(
+				     internal_data_chunk->chunk_data,
+				     internal_data_chunk->io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to unpack chunk: %" PRIu64 " data.",
+					 function,
+					 internal_handle->current_chunk_index );
+
+					return( -1 );
+				}
+			}
+			if( libewf_chunk_data_pack(
+			     internal_data_chunk->chunk_data,
+			     internal_handle->io_handle,
+			     internal_handle->write_io_handle->compressed_zero_byte_empty_block,
+			     internal_handle->write_io_handle->compressed_zero_byte_empty_block_size,
+			     internal_handle->write_io_handle->pack_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to pack chunk: %" PRIu64 " data.",
+				 function,
+				 internal_handle->current_chunk_index );
+
+				return( -1 );
+			}
+		}
+	}
 	write_count = libewf_write_io_handle_write_new_chunk(
 	               internal_handle->write_io_handle,
 	               internal_handle->io_handle,
@@ -6834,19 +8484,79 @@ int libewf_handle_get_offset(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( offset == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
-		 function );
-
-		return( -1 );
-	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_handle->current_offset;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of (concurrent) open file handles
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_maximum_number_of_open_handles(
+     libewf_handle_t *handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_maximum_number_of_open_handles";
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6854,16 +8564,35 @@ int libewf_handle_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*offset = internal_handle->current_offset;
+	if( internal_handle->file_io_pool != NULL )
+	{
+		result = libbfio_pool_set_maximum_number_of_open_handles(
+		          internal_handle->file_io_pool,
+		          maximum_number_of_open_handles,
+		          error );
 
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles in file IO pool.",
+			 function );
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6871,25 +8600,26 @@ int libewf_handle_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Sets the maximum number of (concurrent) open file handles
+/* Sets the maximum number of concurrent reads
+ * 0 disables the concurrent reads
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_maximum_number_of_open_handles(
+int libewf_handle_set_maximum_number_of_concurrent_reads(
      libewf_handle_t *handle,
-     int maximum_number_of_open_handles,
+     int maximum_number_of_concurrent_reads,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_maximum_number_of_open_handles";
+	static char *function                     = "libewf_handle_set_maximum_number_of_concurrent_reads";
 	int result                                = 1;
 
 	if( handle == NULL )
@@ -6905,6 +8635,18 @@ int libewf_handle_set_maximum_number_of_open_handles(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+	if( ( maximum_number_of_concurrent_reads < 0 )
+	 || ( maximum_number_of_concurrent_reads > LIBEWF_MAXIMUM_NUMBER_OF_CONCURRENT_READS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of concurrent reads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -6920,11 +8662,13 @@ int libewf_handle_set_maximum_number_of_open_handles(
 		return( -1 );
 	}
 #endif
-	if( internal_handle->file_io_pool != NULL )
+	/* The IO queue is created on demand with the new maximum number of concurrent reads
+	 */
+	if( ( internal_handle->io_queue != NULL )
+	 && ( maximum_number_of_concurrent_reads != internal_handle->maximum_number_of_concurrent_reads ) )
 	{
-		result = libbfio_pool_set_maximum_number_of_open_handles(
-		          internal_handle->file_io_pool,
-		          maximum_number_of_open_handles,
+		result = libewf_io_queue_free(
+		          &( internal_handle->io_queue ),
 		          error );
 
 		if( result != 1 )
@@ -6932,14 +8676,14 @@ int libewf_handle_set_maximum_number_of_open_handles(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set maximum number of open handles in file IO pool.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO queue.",
 			 function );
 		}
 	}
 	if( result == 1 )
 	{
-		internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+		internal_handle->maximum_number_of_concurrent_reads = maximum_number_of_concurrent_reads;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -8762,6 +10506,226 @@ int libewf_handle_get_root_file_entry(
 	return( result );
 }
 
+/* Retrieves the number of file entries in media order
+ * Only file entries of type file are included, sorted by their data offset
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_number_of_file_entries_in_media_order(
+     libewf_handle_t *handle,
+     int *number_of_file_entries,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_number_of_file_entries_in_media_order";
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing single files.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The media order file nodes are created on demand hence the write lock
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_single_files_get_number_of_media_order_file_nodes(
+	     internal_handle->single_files,
+	     number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of media order file nodes.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific file entry in media order
+ * Only file entries of type file are included, sorted by their data offset
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_file_entry_in_media_order(
+     libewf_handle_t *handle,
+     int file_entry_index,
+     libewf_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *file_node           = NULL;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_file_entry_in_media_order";
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The media order file nodes are created on demand hence the write lock
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_single_files_get_media_order_file_node_by_index(
+	     internal_handle->single_files,
+	     file_entry_index,
+	     &file_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media order file node: %d.",
+		 function,
+		 file_entry_index );
+
+		result = -1;
+	}
+	else if( libewf_file_entry_initialize(
+	          file_entry,
+	          handle,
+	          internal_handle->single_files,
+	          file_node,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( result == 1 )
+		{
+			libewf_file_entry_free(
+			 file_entry,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the (single) file entry for the specific UTF-8 encoded path
  * The path separator is the \ character
  * This function is not multi-thread safe acquire write lock before call
@@ -39,9 +39,11 @@
 #include "libewf_libfdata.h"
 #include "libewf_libfvalue.h"
 #include "libewf_io_handle.h"
+#include "libewf_io_queue.h"
 #include "libewf_media_values.h"
 #include "libewf_read_io_handle.h"
 #include "libewf_segment_table.h"
+#include "libewf_shared_metadata.h"
 #include "libewf_single_files.h"
 #include "libewf_types.h"
 #include "libewf_write_io_handle.h"
@@ -118,6 +120,15 @@ struct libewf_internal_handle
 	 */
 	libfcache_cache_t *chunks_cache;
 
+	/* The IO queue used to read batches of chunks
+	 */
+	libewf_io_queue_t *io_queue;
+
+	/* The maximum number of concurrent reads used by the IO queue
+	 * 0 if batches of chunks are not read concurrently
+	 */
+	int maximum_number_of_concurrent_reads;
+
 	/* The current chunk data
 	 */
 	libewf_chunk_data_t *chunk_data;
@@ -150,6 +161,10 @@ struct libewf_internal_handle
 	 */
 	libewf_single_files_t *single_files;
 
+	/* The metadata shared with cloned handles
+	 */
+	libewf_shared_metadata_t *shared_metadata;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -173,6 +188,14 @@ int libewf_handle_clone(
      libewf_handle_t *source_handle,
      libcerror_error_t **error );
 
+int libewf_internal_handle_share_metadata(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_release_shared_metadata(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_signal_abort(
      libewf_handle_t *handle,
@@ -252,6 +275,37 @@ ssize_t libewf_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_read_ranges(
+     libewf_handle_t *handle,
+     const off64_t *range_offsets,
+     const size_t *range_sizes,
+     void * const *buffers,
+     ssize_t *read_counts,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_get_chunk_fill_pattern(
+     libewf_internal_handle_t *internal_handle,
+     uint64_t chunk_index,
+     uint64_t *fill_pattern,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_chunk_fill_pattern(
+     libewf_handle_t *handle,
+     uint64_t chunk_index,
+     uint64_t *fill_pattern,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_next_data_region(
+     libewf_handle_t *handle,
+     off64_t offset,
+     off64_t *region_offset,
+     size64_t *region_size,
+     libcerror_error_t **error );
+
 ssize_t libewf_internal_handle_write_buffer_to_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
@@ -292,6 +346,18 @@ ssize_t libewf_handle_read_data_chunk(
          libewf_data_chunk_t *data_chunk,
          libcerror_error_t **error );
 
+ssize_t libewf_internal_handle_read_packed_data_chunk_from_file_io_pool(
+         libewf_internal_handle_t *internal_handle,
+         libbfio_pool_t *file_io_pool,
+         libewf_internal_data_chunk_t *internal_data_chunk,
+         libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+ssize_t libewf_handle_read_packed_data_chunk(
+         libewf_handle_t *handle,
+         libewf_data_chunk_t *data_chunk,
+         libcerror_error_t **error );
+
 ssize_t libewf_internal_handle_write_data_chunk_to_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
@@ -339,6 +405,12 @@ int libewf_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_set_maximum_number_of_concurrent_reads(
+     libewf_handle_t *handle,
+     int maximum_number_of_concurrent_reads,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_segment_files_corrupted(
      libewf_handle_t *handle,
@@ -464,6 +536,19 @@ int libewf_handle_get_root_file_entry(
      libewf_file_entry_t **root_file_entry,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_number_of_file_entries_in_media_order(
+     libewf_handle_t *handle,
+     int *number_of_file_entries,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_file_entry_in_media_order(
+     libewf_handle_t *handle,
+     int file_entry_index,
+     libewf_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
 int libewf_internal_handle_get_file_entry_by_utf8_path(
      libewf_internal_handle_t *internal_handle,
      const uint8_t *utf8_string,
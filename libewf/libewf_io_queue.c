@@ -0,0 +1,984 @@
+/*
+ * Input/Output (IO) queue functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_definitions.h"
+#include "libewf_io_queue.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libcthreads.h"
+
+/* Creates an IO queue
+ * Make sure the value io_queue is referencing, is set to NULL
+ * The reads are issued concurrently when the number of concurrent reads is
+ * larger than 1 and multi-threading is supported, otherwise they are issued
+ * one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_initialize(
+     libewf_io_queue_t **io_queue,
+     int number_of_concurrent_reads,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_initialize";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_concurrent_reads <= 0 )
+	 || ( number_of_concurrent_reads > LIBEWF_MAXIMUM_NUMBER_OF_CONCURRENT_READS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of concurrent reads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*io_queue = memory_allocate_structure(
+	             libewf_io_queue_t );
+
+	if( *io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_queue,
+	     0,
+	     sizeof( libewf_io_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO queue.",
+		 function );
+
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+
+		return( -1 );
+	}
+	( *io_queue )->number_of_concurrent_reads = number_of_concurrent_reads;
+
+	return( 1 );
+
+on_error:
+	if( *io_queue != NULL )
+	{
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO queue
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_free(
+     libewf_io_queue_t **io_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_free";
+	int result            = 1;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libewf_io_queue_stop_read_threads(
+		     *io_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop read threads.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *io_queue )->requests != NULL )
+		{
+			memory_free(
+			 ( *io_queue )->requests );
+		}
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+	}
+	return( result );
+}
+
+/* Empties an IO queue
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_empty(
+     libewf_io_queue_t *io_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_empty";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	io_queue->number_of_requests = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of requests
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_get_number_of_requests(
+     libewf_io_queue_t *io_queue,
+     int *number_of_requests,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_get_number_of_requests";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requests.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_requests = io_queue->number_of_requests;
+
+	return( 1 );
+}
+
+/* Appends a read to the IO queue
+ * When the reads are issued concurrently the read is split into requests
+ * of LIBEWF_CONCURRENT_READ_SIZE so that a large read results in multiple
+ * outstanding reads
+ * The buffer must remain available until the queue has been read
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_append_read(
+     libewf_io_queue_t *io_queue,
+     int file_io_pool_entry,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libewf_io_queue_request_t *request  = NULL;
+	libewf_io_queue_request_t *requests = NULL;
+	static char *function               = "libewf_io_queue_append_read";
+	size_t maximum_request_size         = 0;
+	size_t request_size                 = 0;
+	int number_of_allocated_requests    = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file IO pool entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue->number_of_concurrent_reads > 1 )
+	{
+		maximum_request_size = LIBEWF_CONCURRENT_READ_SIZE;
+	}
+	else
+	{
+		maximum_request_size = size;
+	}
+	while( size > 0 )
+	{
+		if( io_queue->number_of_requests >= io_queue->number_of_allocated_requests )
+		{
+			if( io_queue->number_of_allocated_requests == 0 )
+			{
+				number_of_allocated_requests = 16;
+			}
+			else if( io_queue->number_of_allocated_requests < ( INT_MAX / 2 ) )
+			{
+				number_of_allocated_requests = io_queue->number_of_allocated_requests * 2;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid IO queue - number of allocated requests value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			requests = (libewf_io_queue_request_t *) memory_reallocate(
+			                                          io_queue->requests,
+			                                          sizeof( libewf_io_queue_request_t ) * number_of_allocated_requests );
+
+			if( requests == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize requests.",
+				 function );
+
+				return( -1 );
+			}
+			io_queue->requests                     = requests;
+			io_queue->number_of_allocated_requests = number_of_allocated_requests;
+		}
+		request_size = size;
+
+		if( request_size > maximum_request_size )
+		{
+			request_size = maximum_request_size;
+		}
+		request = &( io_queue->requests[ io_queue->number_of_requests ] );
+
+		request->io_queue           = io_queue;
+		request->file_io_pool_entry = file_io_pool_entry;
+		request->offset             = offset;
+		request->buffer             = buffer;
+		request->size               = request_size;
+		request->result             = 0;
+
+		io_queue->number_of_requests += 1;
+
+		offset += (off64_t) request_size;
+		buffer += request_size;
+		size   -= request_size;
+	}
+	return( 1 );
+}
+
+/* Reads the data of a request
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_read_request(
+     libewf_io_queue_request_t *request,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_read_request";
+	ssize_t read_count    = 0;
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_seek_offset(
+	     file_io_pool,
+	     request->file_io_pool_entry,
+	     request->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file IO pool entry: %d.",
+		 function,
+		 request->offset,
+		 request->offset,
+		 request->file_io_pool_entry );
+
+		return( -1 );
+	}
+	read_count = libbfio_pool_read_buffer(
+	              file_io_pool,
+	              request->file_io_pool_entry,
+	              request->buffer,
+	              request->size,
+	              error );
+
+	if( read_count != (ssize_t) request->size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read: %" PRIzd " bytes at offset: %" PRIi64 " (0x%08" PRIx64 ") in file IO pool entry: %d.",
+		 function,
+		 request->size,
+		 request->offset,
+		 request->offset,
+		 request->file_io_pool_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of all the requests in the IO queue and empties the queue
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_read(
+     libewf_io_queue_t *io_queue,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_read";
+	int request_index     = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( ( io_queue->number_of_concurrent_reads > 1 )
+	 && ( io_queue->number_of_requests > 1 ) )
+	{
+		if( libewf_io_queue_read_concurrently(
+		     io_queue,
+		     file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read requests concurrently.",
+			 function );
+
+			goto on_error;
+		}
+		io_queue->number_of_requests = 0;
+
+		return( 1 );
+	}
+#endif
+	for( request_index = 0;
+	     request_index < io_queue->number_of_requests;
+	     request_index++ )
+	{
+		if( libewf_io_queue_read_request(
+		     &( io_queue->requests[ request_index ] ),
+		     file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read request: %d.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+	}
+	io_queue->number_of_requests = 0;
+
+	return( 1 );
+
+on_error:
+	io_queue->number_of_requests = 0;
+
+	return( -1 );
+}
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Starts the read threads
+ * Every read thread uses a clone of the file IO pool, so that reads
+ * in different threads do not share the file offset
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_start_read_threads(
+     libewf_io_queue_t *io_queue,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_start_read_threads";
+	int pool_index        = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue->read_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO queue - read thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_initialize(
+	     &( io_queue->file_io_pools_queue ),
+	     io_queue->number_of_concurrent_reads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pools queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( pool_index = 0;
+	     pool_index < io_queue->number_of_concurrent_reads;
+	     pool_index++ )
+	{
+		if( libbfio_pool_clone(
+		     &( io_queue->file_io_pools[ pool_index ] ),
+		     file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO pool: %d.",
+			 function,
+			 pool_index );
+
+			goto on_error;
+		}
+		io_queue->number_of_file_io_pools += 1;
+
+		if( libcthreads_queue_push(
+		     io_queue->file_io_pools_queue,
+		     (intptr_t *) io_queue->file_io_pools[ pool_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push file IO pool: %d onto queue.",
+			 function,
+			 pool_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_queue_initialize(
+	     &( io_queue->completed_requests_queue ),
+	     LIBEWF_MAXIMUM_NUMBER_OF_QUEUED_READS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create completed requests queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( io_queue->read_thread_pool ),
+	     NULL,
+	     io_queue->number_of_concurrent_reads,
+	     LIBEWF_MAXIMUM_NUMBER_OF_QUEUED_READS,
+	     (int (*)(intptr_t *, void *)) &libewf_io_queue_read_request_callback,
+	     (void *) io_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libewf_io_queue_stop_read_threads(
+	 io_queue,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Stops the read threads
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_stop_read_threads(
+     libewf_io_queue_t *io_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_io_queue_stop_read_threads";
+	int pool_index        = 0;
+	int result            = 1;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue->read_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( io_queue->read_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join read thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_queue->completed_requests_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( io_queue->completed_requests_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed requests queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_queue->file_io_pools_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( io_queue->file_io_pools_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pools queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( pool_index = 0;
+	     pool_index < io_queue->number_of_file_io_pools;
+	     pool_index++ )
+	{
+		if( libbfio_pool_close_all(
+		     io_queue->file_io_pools[ pool_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO pool: %d.",
+			 function,
+			 pool_index );
+
+			result = -1;
+		}
+		if( libbfio_pool_free(
+		     &( io_queue->file_io_pools[ pool_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pool: %d.",
+			 function,
+			 pool_index );
+
+			result = -1;
+		}
+	}
+	io_queue->number_of_file_io_pools = 0;
+
+	return( result );
+}
+
+/* Callback function to read a request in a read thread
+ * The outcome is stored in the request, which is pushed onto the completed requests queue
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_read_request_callback(
+     libewf_io_queue_request_t *request,
+     libewf_io_queue_t *io_queue )
+{
+	libbfio_pool_t *file_io_pool = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "libewf_io_queue_read_request_callback";
+	int result                   = 1;
+
+	if( request == NULL )
+	{
+		return( -1 );
+	}
+	if( io_queue == NULL )
+	{
+		return( -1 );
+	}
+	request->result = -1;
+
+	if( libcthreads_queue_pop(
+	     io_queue->file_io_pools_queue,
+	     (intptr_t **) &file_io_pool,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop file IO pool from queue.",
+		 function );
+
+		result = -1;
+	}
+	if( file_io_pool != NULL )
+	{
+		request->result = libewf_io_queue_read_request(
+		                   request,
+		                   file_io_pool,
+		                   &error );
+
+		if( libcthreads_queue_push(
+		     io_queue->file_io_pools_queue,
+		     (intptr_t *) file_io_pool,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push file IO pool onto queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_queue_push(
+	     io_queue->completed_requests_queue,
+	     (intptr_t *) request,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push request onto completed requests queue.",
+		 function );
+
+		result = -1;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Reads the data of all the requests in the IO queue concurrently
+ * The requests are read by the read threads in rounds of at most
+ * LIBEWF_MAXIMUM_NUMBER_OF_QUEUED_READS requests
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_io_queue_read_concurrently(
+     libewf_io_queue_t *io_queue,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	libewf_io_queue_request_t *request = NULL;
+	static char *function              = "libewf_io_queue_read_concurrently";
+	int number_of_pushed_requests      = 0;
+	int number_of_failed_requests      = 0;
+	int request_index                  = 0;
+	int result                         = 1;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_queue->read_thread_pool == NULL )
+	{
+		if( libewf_io_queue_start_read_threads(
+		     io_queue,
+		     file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start read threads.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( request_index < io_queue->number_of_requests )
+	{
+		number_of_pushed_requests = 0;
+
+		while( ( request_index < io_queue->number_of_requests )
+		    && ( number_of_pushed_requests < LIBEWF_MAXIMUM_NUMBER_OF_QUEUED_READS ) )
+		{
+			if( libcthreads_thread_pool_push(
+			     io_queue->read_thread_pool,
+			     (intptr_t *) &( io_queue->requests[ request_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push request: %d onto read thread pool.",
+				 function,
+				 request_index );
+
+				result = -1;
+
+				break;
+			}
+			number_of_pushed_requests++;
+			request_index++;
+		}
+		/* Wait for all the pushed requests to complete, also after an error
+		 * since the requests refer to buffers of the caller
+		 */
+		while( number_of_pushed_requests > 0 )
+		{
+			request = NULL;
+
+			if( libcthreads_queue_pop(
+			     io_queue->completed_requests_queue,
+			     (intptr_t **) &request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to pop request from completed requests queue.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( request == NULL )
+			 || ( request->result != 1 ) )
+			{
+				number_of_failed_requests++;
+			}
+			number_of_pushed_requests--;
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( number_of_failed_requests > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read %d of %d requests.",
+		 function,
+		 number_of_failed_requests,
+		 io_queue->number_of_requests );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
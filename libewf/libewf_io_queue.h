@@ -0,0 +1,171 @@
+/*
+ * Input/Output (IO) queue functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_IO_QUEUE_H )
+#define _LIBEWF_IO_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_definitions.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_io_queue libewf_io_queue_t;
+typedef struct libewf_io_queue_request libewf_io_queue_request_t;
+
+struct libewf_io_queue_request
+{
+	/* The IO queue
+	 */
+	libewf_io_queue_t *io_queue;
+
+	/* The file IO pool entry
+	 */
+	int file_io_pool_entry;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The result, 1 if successful or -1 on error
+	 */
+	int result;
+};
+
+struct libewf_io_queue
+{
+	/* The requests
+	 */
+	libewf_io_queue_request_t *requests;
+
+	/* The number of allocated requests
+	 */
+	int number_of_allocated_requests;
+
+	/* The number of requests
+	 */
+	int number_of_requests;
+
+	/* The number of concurrent reads
+	 */
+	int number_of_concurrent_reads;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The file IO pools, one for every read thread
+	 */
+	libbfio_pool_t *file_io_pools[ LIBEWF_MAXIMUM_NUMBER_OF_CONCURRENT_READS ];
+
+	/* The number of file IO pools
+	 */
+	int number_of_file_io_pools;
+
+	/* The queue of file IO pools that are not in use
+	 */
+	libcthreads_queue_t *file_io_pools_queue;
+
+	/* The queue of completed requests
+	 */
+	libcthreads_queue_t *completed_requests_queue;
+
+	/* The read thread pool
+	 */
+	libcthreads_thread_pool_t *read_thread_pool;
+#endif
+};
+
+int libewf_io_queue_initialize(
+     libewf_io_queue_t **io_queue,
+     int number_of_concurrent_reads,
+     libcerror_error_t **error );
+
+int libewf_io_queue_free(
+     libewf_io_queue_t **io_queue,
+     libcerror_error_t **error );
+
+int libewf_io_queue_empty(
+     libewf_io_queue_t *io_queue,
+     libcerror_error_t **error );
+
+int libewf_io_queue_get_number_of_requests(
+     libewf_io_queue_t *io_queue,
+     int *number_of_requests,
+     libcerror_error_t **error );
+
+int libewf_io_queue_append_read(
+     libewf_io_queue_t *io_queue,
+     int file_io_pool_entry,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libewf_io_queue_read_request(
+     libewf_io_queue_request_t *request,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libewf_io_queue_read(
+     libewf_io_queue_t *io_queue,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+int libewf_io_queue_start_read_threads(
+     libewf_io_queue_t *io_queue,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libewf_io_queue_stop_read_threads(
+     libewf_io_queue_t *io_queue,
+     libcerror_error_t **error );
+
+int libewf_io_queue_read_request_callback(
+     libewf_io_queue_request_t *request,
+     libewf_io_queue_t *io_queue );
+
+int libewf_io_queue_read_concurrently(
+     libewf_io_queue_t *io_queue,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_IO_QUEUE_H ) */
+
@@ -33,6 +33,8 @@
 #include "libewf_libfvalue.h"
 #include "libewf_libuna.h"
 #include "libewf_serialized_string.h"
+#include "libewf_single_file_tree_index.h"
+#include "libewf_string_pool.h"
 #include "libewf_lef_file_entry.h"
 
 const uint8_t libewf_lef_extended_attributes_header[ 37 ] = {
@@ -105,85 +107,6 @@ int libewf_lef_file_entry_initialize(
 
 		return( -1 );
 	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->guid ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create GUID string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->name ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create name string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->short_name ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create short name string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->md5_hash ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create MD5 hash string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_initialize(
-	     &( ( *lef_file_entry )->sha1_hash ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create SHA1 hash string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_initialize(
-	     &( ( *lef_file_entry )->extended_attributes ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extended attributes array.",
-		 function );
-
-		goto on_error;
-	}
 	( *lef_file_entry )->data_offset            = -1;
 	( *lef_file_entry )->duplicate_data_offset  = -1;
 	( *lef_file_entry )->permission_group_index = 0;
@@ -193,36 +116,6 @@ int libewf_lef_file_entry_initialize(
 on_error:
 	if( *lef_file_entry != NULL )
 	{
-		if( ( *lef_file_entry )->sha1_hash != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->sha1_hash ),
-			 NULL );
-		}
-		if( ( *lef_file_entry )->md5_hash != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->md5_hash ),
-			 NULL );
-		}
-		if( ( *lef_file_entry )->short_name != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->short_name ),
-			 NULL );
-		}
-		if( ( *lef_file_entry )->name != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->name ),
-			 NULL );
-		}
-		if( ( *lef_file_entry )->guid != NULL )
-		{
-			libewf_serialized_string_free(
-			 &( ( *lef_file_entry )->guid ),
-			 NULL );
-		}
 		memory_free(
 		 *lef_file_entry );
 
@@ -254,98 +147,46 @@ int libewf_lef_file_entry_free(
 	}
 	if( *lef_file_entry != NULL )
 	{
-		if( ( *lef_file_entry )->guid != NULL )
+		if( ( ( ( *lef_file_entry )->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL ) == 0 )
+		 && ( ( *lef_file_entry )->name.data != NULL ) )
 		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->guid ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free GUID string.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( ( *lef_file_entry )->name != NULL )
-		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->name ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free name string.",
-				 function );
-
-				result = -1;
-			}
+			memory_free(
+			 ( *lef_file_entry )->name.data );
 		}
-		if( ( *lef_file_entry )->short_name != NULL )
+		if( ( ( ( *lef_file_entry )->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_SHORT_NAME_IN_STRING_POOL ) == 0 )
+		 && ( ( *lef_file_entry )->short_name.data != NULL ) )
 		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->short_name ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free short name string.",
-				 function );
-
-				result = -1;
-			}
+			memory_free(
+			 ( *lef_file_entry )->short_name.data );
 		}
-		if( ( *lef_file_entry )->md5_hash != NULL )
+		if( ( *lef_file_entry )->extended_attributes != NULL )
 		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->md5_hash ),
+			if( libcdata_array_free(
+			     &( ( *lef_file_entry )->extended_attributes ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_extended_attribute_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free MD5 hash string.",
+				 "%s: unable to free extended attributes array.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( ( *lef_file_entry )->sha1_hash != NULL )
+		if( ( *lef_file_entry )->sub_nodes_index != NULL )
 		{
-			if( libewf_serialized_string_free(
-			     &( ( *lef_file_entry )->sha1_hash ),
+			if( libewf_single_file_tree_index_free(
+			     &( ( *lef_file_entry )->sub_nodes_index ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free SHA1 hash string.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( ( *lef_file_entry )->extended_attributes != NULL )
-		{
-			if( libcdata_array_free(
-			     &( ( *lef_file_entry )->extended_attributes ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_extended_attribute_free,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free extended attributes array.",
+				 "%s: unable to free sub nodes index.",
 				 function );
 
 				result = -1;
@@ -430,82 +271,57 @@ int libewf_lef_file_entry_clone(
 
 		return( -1 );
 	}
-	( *destination_lef_file_entry )->guid                = NULL;
-	( *destination_lef_file_entry )->name                = NULL;
-	( *destination_lef_file_entry )->short_name          = NULL;
-	( *destination_lef_file_entry )->md5_hash            = NULL;
-	( *destination_lef_file_entry )->sha1_hash           = NULL;
-	( *destination_lef_file_entry )->extended_attributes = NULL;
+	( *destination_lef_file_entry )->name.data             = NULL;
+	( *destination_lef_file_entry )->name.data_size        = 0;
+	( *destination_lef_file_entry )->short_name.data       = NULL;
+	( *destination_lef_file_entry )->short_name.data_size  = 0;
+	( *destination_lef_file_entry )->extended_attributes   = NULL;
 
-	if( libewf_serialized_string_clone(
-	     &( ( *destination_lef_file_entry )->guid ),
-	     source_lef_file_entry->guid,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination GUID string.",
-		 function );
+	/* The sub nodes index references the sub nodes of the source tree
+	 * and is recreated for the destination tree by libewf_single_file_tree_create_indexes
+	 */
+	( *destination_lef_file_entry )->sub_nodes_index       = NULL;
 
-		goto on_error;
-	}
-	if( libewf_serialized_string_clone(
-	     &( ( *destination_lef_file_entry )->name ),
-	     source_lef_file_entry->name,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination name string.",
-		 function );
+	/* The destination file entry owns its strings, since it can outlive
+	 * the string pool of the source file entry
+	 */
+	( *destination_lef_file_entry )->value_flags          &= ~( LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL | LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_SHORT_NAME_IN_STRING_POOL );
 
-		goto on_error;
-	}
-	if( libewf_serialized_string_clone(
-	     &( ( *destination_lef_file_entry )->short_name ),
-	     source_lef_file_entry->short_name,
-	     error ) != 1 )
+	if( source_lef_file_entry->name.data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination short name string.",
-		 function );
-
-		goto on_error;
-	}
-	if( libewf_serialized_string_clone(
-	     &( ( *destination_lef_file_entry )->md5_hash ),
-	     source_lef_file_entry->md5_hash,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination MD5 hash string.",
-		 function );
+		if( libewf_serialized_string_read_data(
+		     &( ( *destination_lef_file_entry )->name ),
+		     source_lef_file_entry->name.data,
+		     source_lef_file_entry->name.data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone destination name string.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( libewf_serialized_string_clone(
-	     &( ( *destination_lef_file_entry )->sha1_hash ),
-	     source_lef_file_entry->sha1_hash,
-	     error ) != 1 )
+	if( source_lef_file_entry->short_name.data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone destination SHA1 hash string.",
-		 function );
+		if( libewf_serialized_string_read_data(
+		     &( ( *destination_lef_file_entry )->short_name ),
+		     source_lef_file_entry->short_name.data,
+		     source_lef_file_entry->short_name.data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone destination short name string.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( libcdata_array_clone(
 	     &( ( *destination_lef_file_entry )->extended_attributes ),
@@ -797,141 +613,479 @@ int libewf_lef_file_entry_read_extended_attributes(
 		 "%s: unable to create byte stream.",
 		 function );
 
-		goto on_error;
+		goto on_error;
+	}
+	if( libuna_base16_stream_copy_to_byte_stream(
+	     data,
+	     data_size,
+	     byte_stream,
+	     byte_stream_size,
+	     LIBUNA_BASE16_VARIANT_RFC4648,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy base16 encoded data to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+	 	 "%s: extended attributes data:\n",
+		 function );
+		libcnotify_print_data(
+		 byte_stream,
+		 byte_stream_size,
+		 0 );
+	}
+#endif
+	if( ( byte_stream_size < 37 )
+	 || ( memory_compare(
+	       libewf_lef_extended_attributes_header,
+	       byte_stream,
+	       37 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extended attributes header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extended attributes array is created on demand since most file entries
+	 * do not have extended attributes
+	 */
+	if( lef_file_entry->extended_attributes == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( lef_file_entry->extended_attributes ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extended attributes array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( libewf_lef_extended_attribute_initialize(
+		     &lef_extended_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extended attribute.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libewf_lef_extended_attribute_read_data(
+		              lef_extended_attribute,
+		              &( byte_stream[ byte_stream_offset ] ),
+		              byte_stream_size - byte_stream_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extended attribute.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_offset += read_count;
+
+		if( lef_extended_attribute->is_branch == 0 )
+		{
+			if( libcdata_array_append_entry(
+			     lef_file_entry->extended_attributes,
+			     &entry_index,
+			     (intptr_t *) lef_extended_attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append entry to extended attributes array.",
+				 function );
+
+				goto on_error;
+			}
+			lef_extended_attribute = NULL;
+		}
+		else
+		{
+			if( libewf_lef_extended_attribute_free(
+			     &lef_extended_attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extended attribute.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 byte_stream );
+
+	return( 1 );
+
+on_error:
+	if( lef_extended_attribute != NULL )
+	{
+		libewf_lef_extended_attribute_free(
+		 &lef_extended_attribute,
+		 NULL );
+	}
+	if( byte_stream != NULL )
+	{
+		memory_free(
+		 byte_stream );
+	}
+	return( -1 );
+}
+
+/* Reads a string
+ * The string is stored in the string pool if provided, otherwise it is owned by the file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_lef_file_entry_read_string(
+     libewf_lef_file_entry_t *lef_file_entry,
+     libewf_serialized_string_t *serialized_string,
+     uint8_t string_pool_value_flag,
+     const uint8_t *data,
+     size_t data_size,
+     libewf_string_pool_t *string_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_lef_file_entry_read_string";
+
+	if( lef_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( serialized_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized string.",
+		 function );
+
+		return( -1 );
+	}
+	if( serialized_string->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid serialized string - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_pool == NULL )
+	{
+		if( libewf_serialized_string_read_data(
+		     serialized_string,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read string.",
+			 function );
+
+			return( -1 );
+		}
+		lef_file_entry->value_flags &= ~string_pool_value_flag;
+	}
+	else
+	{
+		if( libewf_string_pool_append_string(
+		     string_pool,
+		     data,
+		     data_size,
+		     &( serialized_string->data ),
+		     &( serialized_string->data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string to string pool.",
+			 function );
+
+			return( -1 );
+		}
+		lef_file_entry->value_flags |= string_pool_value_flag;
+	}
+	return( 1 );
+}
+
+/* Reads a hexadecimal encoded binary value
+ * Returns 1 if successful, 0 if the value is empty, contains only zeros or is of an unsupported size or -1 on error
+ */
+int libewf_lef_file_entry_read_hexadecimal_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_lef_file_entry_read_hexadecimal_data";
+	size_t data_offset    = 0;
+	size_t value_offset   = 0;
+	uint8_t nibble        = 0;
+	uint8_t value_byte    = 0;
+	int zero_values_only  = 1;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_size == 0 )
+	 || ( value_data_size > (size_t) ( SSIZE_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size >= 1 )
+	 && ( data[ data_size - 1 ] == 0 ) )
+	{
+		data_size -= 1;
+	}
+	if( data_size == 0 )
+	{
+		return( 0 );
+	}
+	/* A hexadecimal string of an unsupported size is treated as not set
+	 */
+	if( data_size != ( value_data_size * 2 ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported hexadecimal string size: %" PRIzd ", expected: %" PRIzd ".\n",
+			 function,
+			 data_size,
+			 value_data_size * 2 );
+		}
+#endif
+		return( 0 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( ( data[ data_offset ] >= (uint8_t) '0' )
+		 && ( data[ data_offset ] <= (uint8_t) '9' ) )
+		{
+			nibble = data[ data_offset ] - (uint8_t) '0';
+		}
+		else if( ( data[ data_offset ] >= (uint8_t) 'A' )
+		      && ( data[ data_offset ] <= (uint8_t) 'F' ) )
+		{
+			nibble = data[ data_offset ] - (uint8_t) 'A' + 10;
+		}
+		else if( ( data[ data_offset ] >= (uint8_t) 'a' )
+		      && ( data[ data_offset ] <= (uint8_t) 'f' ) )
+		{
+			nibble = data[ data_offset ] - (uint8_t) 'a' + 10;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		if( nibble != 0 )
+		{
+			zero_values_only = 0;
+		}
+		if( ( data_offset % 2 ) == 0 )
+		{
+			value_byte = nibble << 4;
+		}
+		else
+		{
+			value_data[ value_offset++ ] = value_byte | nibble;
+		}
+	}
+	if( zero_values_only != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the lower case hexadecimal string of a binary value
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_lef_file_entry_get_hexadecimal_string(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_lef_file_entry_get_hexadecimal_string";
+	size_t string_index   = 0;
+	size_t value_offset   = 0;
+	uint8_t nibble        = 0;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
 	}
-	if( libuna_base16_stream_copy_to_byte_stream(
-	     data,
-	     data_size,
-	     byte_stream,
-	     byte_stream_size,
-	     LIBUNA_BASE16_VARIANT_RFC4648,
-	     0,
-	     error ) != 1 )
+	if( value_data_size > (size_t) ( SSIZE_MAX / 2 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to copy base16 encoded data to byte stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( string == NULL )
 	{
-		libcnotify_printf(
-	 	 "%s: extended attributes data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
-		libcnotify_print_data(
-		 byte_stream,
-		 byte_stream_size,
-		 0 );
+
+		return( -1 );
 	}
-#endif
-	if( ( byte_stream_size < 37 )
-	 || ( memory_compare(
-	       libewf_lef_extended_attributes_header,
-	       byte_stream,
-	       37 ) != 0 ) )
+	if( string_size < ( ( value_data_size * 2 ) + 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported extended attributes header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( byte_stream_offset < byte_stream_size )
+	for( value_offset = 0;
+	     value_offset < value_data_size;
+	     value_offset++ )
 	{
-		if( libewf_lef_extended_attribute_initialize(
-		     &lef_extended_attribute,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create extended attribute.",
-			 function );
+		nibble = value_data[ value_offset ] >> 4;
 
-			goto on_error;
+		if( nibble <= 9 )
+		{
+			string[ string_index++ ] = (uint8_t) '0' + nibble;
 		}
-		read_count = libewf_lef_extended_attribute_read_data(
-		              lef_extended_attribute,
-		              &( byte_stream[ byte_stream_offset ] ),
-		              byte_stream_size - byte_stream_offset,
-		              error );
-
-		if( read_count == -1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read extended attribute.",
-			 function );
-
-			goto on_error;
+			string[ string_index++ ] = (uint8_t) 'a' + nibble - 10;
 		}
-		byte_stream_offset += read_count;
+		nibble = value_data[ value_offset ] & 0x0f;
 
-		if( lef_extended_attribute->is_branch == 0 )
+		if( nibble <= 9 )
 		{
-			if( libcdata_array_append_entry(
-			     lef_file_entry->extended_attributes,
-			     &entry_index,
-			     (intptr_t *) lef_extended_attribute,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append entry to extended attributes array.",
-				 function );
-
-				goto on_error;
-			}
-			lef_extended_attribute = NULL;
+			string[ string_index++ ] = (uint8_t) '0' + nibble;
 		}
 		else
 		{
-			if( libewf_lef_extended_attribute_free(
-			     &lef_extended_attribute,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free extended attribute.",
-				 function );
-
-				goto on_error;
-			}
+			string[ string_index++ ] = (uint8_t) 'a' + nibble - 10;
 		}
 	}
-	memory_free(
-	 byte_stream );
+	string[ string_index ] = 0;
 
 	return( 1 );
-
-on_error:
-	if( lef_extended_attribute != NULL )
-	{
-		libewf_lef_extended_attribute_free(
-		 &lef_extended_attribute,
-		 NULL );
-	}
-	if( byte_stream != NULL )
-	{
-		memory_free(
-		 byte_stream );
-	}
-	return( -1 );
 }
 
 /* Reads a file entry short name
@@ -941,6 +1095,7 @@ int libewf_lef_file_entry_read_short_name(
      libewf_lef_file_entry_t *lef_file_entry,
      const uint8_t *data,
      size_t data_size,
+     libewf_string_pool_t *string_pool,
      libcerror_error_t **error )
 {
 	libfvalue_split_utf8_string_t *values = NULL;
@@ -1066,10 +1221,13 @@ int libewf_lef_file_entry_read_short_name(
 	if( ( value_string != NULL )
 	 && ( value_string_size > 0 ) )
 	{
-		if( libewf_serialized_string_read_data(
-		     lef_file_entry->short_name,
+		if( libewf_lef_file_entry_read_string(
+		     lef_file_entry,
+		     &( lef_file_entry->short_name ),
+		     LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_SHORT_NAME_IN_STRING_POOL,
 		     value_string,
 		     value_string_size - 1,
+		     string_pool,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1115,6 +1273,7 @@ int libewf_lef_file_entry_read_data(
      libfvalue_split_utf8_string_t *types,
      const uint8_t *data,
      size_t data_size,
+     libewf_string_pool_t *string_pool,
      libcerror_error_t **error )
 {
 	libfvalue_split_utf8_string_t *values = NULL;
@@ -1127,6 +1286,7 @@ int libewf_lef_file_entry_read_data(
 	int number_of_types                   = 0;
 	int number_of_values                  = 0;
 	int value_index                       = 0;
+	int result                            = 0;
 
 	if( lef_file_entry == NULL )
 	{
@@ -1317,11 +1477,14 @@ int libewf_lef_file_entry_read_data(
 			      && ( type_string[ 1 ] == (uint8_t) 'i' )
 			      && ( type_string[ 2 ] == (uint8_t) 'd' ) )
 			{
-				if( libewf_serialized_string_read_hexadecimal_data(
-				     lef_file_entry->guid,
-				     value_string,
-				     value_string_size - 1,
-				     error ) != 1 )
+				result = libewf_lef_file_entry_read_hexadecimal_data(
+				          value_string,
+				          value_string_size - 1,
+				          lef_file_entry->guid,
+				          16,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -1332,6 +1495,10 @@ int libewf_lef_file_entry_read_data(
 
 					goto on_error;
 				}
+				else if( result != 0 )
+				{
+					lef_file_entry->value_flags |= LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_GUID;
+				}
 			}
 			else if( ( type_string[ 0 ] == (uint8_t) 'o' )
 			      && ( type_string[ 1 ] == (uint8_t) 'p' )
@@ -1440,11 +1607,14 @@ int libewf_lef_file_entry_read_data(
 			      && ( type_string[ 1 ] == (uint8_t) 'h' )
 			      && ( type_string[ 2 ] == (uint8_t) 'a' ) )
 			{
-				if( libewf_serialized_string_read_hexadecimal_data(
-				     lef_file_entry->sha1_hash,
-				     value_string,
-				     value_string_size - 1,
-				     error ) != 1 )
+				result = libewf_lef_file_entry_read_hexadecimal_data(
+				          value_string,
+				          value_string_size - 1,
+				          lef_file_entry->sha1_hash,
+				          20,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -1455,6 +1625,10 @@ int libewf_lef_file_entry_read_data(
 
 					goto on_error;
 				}
+				else if( result != 0 )
+				{
+					lef_file_entry->value_flags |= LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_SHA1_HASH;
+				}
 			}
 			else if( ( type_string[ 0 ] == (uint8_t) 's' )
 			      && ( type_string[ 1 ] == (uint8_t) 'n' )
@@ -1464,6 +1638,7 @@ int libewf_lef_file_entry_read_data(
 				     lef_file_entry,
 				     value_string,
 				     value_string_size,
+				     string_pool,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -1620,11 +1795,14 @@ int libewf_lef_file_entry_read_data(
 			else if( ( type_string[ 0 ] == (uint8_t) 'h' )
 			      && ( type_string[ 1 ] == (uint8_t) 'a' ) )
 			{
-				if( libewf_serialized_string_read_hexadecimal_data(
-				     lef_file_entry->md5_hash,
-				     value_string,
-				     value_string_size - 1,
-				     error ) != 1 )
+				result = libewf_lef_file_entry_read_hexadecimal_data(
+				          value_string,
+				          value_string_size - 1,
+				          lef_file_entry->md5_hash,
+				          16,
+				          error );
+
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -1635,6 +1813,10 @@ int libewf_lef_file_entry_read_data(
 
 					goto on_error;
 				}
+				else if( result != 0 )
+				{
+					lef_file_entry->value_flags |= LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_MD5_HASH;
+				}
 			}
 			else if( ( type_string[ 0 ] == (uint8_t) 'i' )
 			      && ( type_string[ 1 ] == (uint8_t) 'd' ) )
@@ -1811,10 +1993,13 @@ int libewf_lef_file_entry_read_data(
 		{
 			if( type_string[ 0 ] == (uint8_t) 'n' )
 			{
-				if( libewf_serialized_string_read_data(
-				     lef_file_entry->name,
+				if( libewf_lef_file_entry_read_string(
+				     lef_file_entry,
+				     &( lef_file_entry->name ),
+				     LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL,
 				     value_string,
 				     value_string_size - 1,
+				     string_pool,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2187,7 +2372,6 @@ int libewf_lef_file_entry_get_utf8_guid_size(
      libcerror_error_t **error )
 {
 	static char *function = "libewf_lef_file_entry_get_utf8_guid_size";
-	int result            = 0;
 
 	if( lef_file_entry == NULL )
 	{
@@ -2200,22 +2384,27 @@ int libewf_lef_file_entry_get_utf8_guid_size(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf8_string_size(
-	          lef_file_entry->guid,
-	          utf8_string_size,
-	          error );
-
-	if( result == -1 )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve GUID UTF-8 string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
+	/* The GUID is represented as a lower case hexadecimal string
+	 */
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_GUID ) == 0 )
+	{
+		*utf8_string_size = 0;
+	}
+	else
+	{
+		*utf8_string_size = 33;
+	}
 	return( 1 );
 }
 
@@ -2229,6 +2418,9 @@ int libewf_lef_file_entry_get_utf8_guid(
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
+	libewf_serialized_string_t hexadecimal_string;
+	uint8_t hexadecimal_string_data[ 33 ];
+
 	static char *function = "libewf_lef_file_entry_get_utf8_guid";
 	int result            = 0;
 
@@ -2243,8 +2435,32 @@ int libewf_lef_file_entry_get_utf8_guid(
 
 		return( -1 );
 	}
+	hexadecimal_string.data      = NULL;
+	hexadecimal_string.data_size = 0;
+
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_GUID ) != 0 )
+	{
+		if( libewf_lef_file_entry_get_hexadecimal_string(
+		     lef_file_entry->guid,
+		     16,
+		     hexadecimal_string_data,
+		     33,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve GUID hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		hexadecimal_string.data      = hexadecimal_string_data;
+		hexadecimal_string.data_size = 33;
+	}
 	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->guid,
+	          &hexadecimal_string,
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -2273,7 +2489,6 @@ int libewf_lef_file_entry_get_utf16_guid_size(
      libcerror_error_t **error )
 {
 	static char *function = "libewf_lef_file_entry_get_utf16_guid_size";
-	int result            = 0;
 
 	if( lef_file_entry == NULL )
 	{
@@ -2286,22 +2501,27 @@ int libewf_lef_file_entry_get_utf16_guid_size(
 
 		return( -1 );
 	}
-	result = libewf_serialized_string_get_utf16_string_size(
-	          lef_file_entry->guid,
-	          utf16_string_size,
-	          error );
-
-	if( result == -1 )
+	if( utf16_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve GUID UTF-16 string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
 		 function );
 
 		return( -1 );
 	}
+	/* The GUID is represented as a lower case hexadecimal string
+	 */
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_GUID ) == 0 )
+	{
+		*utf16_string_size = 0;
+	}
+	else
+	{
+		*utf16_string_size = 33;
+	}
 	return( 1 );
 }
 
@@ -2315,6 +2535,9 @@ int libewf_lef_file_entry_get_utf16_guid(
      size_t utf16_string_size,
      libcerror_error_t **error )
 {
+	libewf_serialized_string_t hexadecimal_string;
+	uint8_t hexadecimal_string_data[ 33 ];
+
 	static char *function = "libewf_lef_file_entry_get_utf16_guid";
 	int result            = 0;
 
@@ -2329,8 +2552,32 @@ int libewf_lef_file_entry_get_utf16_guid(
 
 		return( -1 );
 	}
+	hexadecimal_string.data      = NULL;
+	hexadecimal_string.data_size = 0;
+
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_GUID ) != 0 )
+	{
+		if( libewf_lef_file_entry_get_hexadecimal_string(
+		     lef_file_entry->guid,
+		     16,
+		     hexadecimal_string_data,
+		     33,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve GUID hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		hexadecimal_string.data      = hexadecimal_string_data;
+		hexadecimal_string.data_size = 33;
+	}
 	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->guid,
+	          &hexadecimal_string,
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -2373,7 +2620,7 @@ int libewf_lef_file_entry_get_utf8_name_size(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf8_string_size(
-	          lef_file_entry->name,
+	          &( lef_file_entry->name ),
 	          utf8_string_size,
 	          error );
 
@@ -2416,7 +2663,7 @@ int libewf_lef_file_entry_get_utf8_name(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->name,
+	          &( lef_file_entry->name ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -2459,7 +2706,7 @@ int libewf_lef_file_entry_get_utf16_name_size(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf16_string_size(
-	          lef_file_entry->name,
+	          &( lef_file_entry->name ),
 	          utf16_string_size,
 	          error );
 
@@ -2502,7 +2749,7 @@ int libewf_lef_file_entry_get_utf16_name(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->name,
+	          &( lef_file_entry->name ),
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -2545,7 +2792,7 @@ int libewf_lef_file_entry_get_utf8_short_name_size(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf8_string_size(
-	          lef_file_entry->short_name,
+	          &( lef_file_entry->short_name ),
 	          utf8_string_size,
 	          error );
 
@@ -2588,7 +2835,7 @@ int libewf_lef_file_entry_get_utf8_short_name(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->short_name,
+	          &( lef_file_entry->short_name ),
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -2631,7 +2878,7 @@ int libewf_lef_file_entry_get_utf16_short_name_size(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf16_string_size(
-	          lef_file_entry->short_name,
+	          &( lef_file_entry->short_name ),
 	          utf16_string_size,
 	          error );
 
@@ -2674,7 +2921,7 @@ int libewf_lef_file_entry_get_utf16_short_name(
 		return( -1 );
 	}
 	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->short_name,
+	          &( lef_file_entry->short_name ),
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -3035,6 +3282,9 @@ int libewf_lef_file_entry_get_utf8_hash_value_md5(
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
+	libewf_serialized_string_t hexadecimal_string;
+	uint8_t hexadecimal_string_data[ 33 ];
+
 	static char *function = "libewf_lef_file_entry_get_utf8_hash_value_md5";
 	int result            = 0;
 
@@ -3049,8 +3299,32 @@ int libewf_lef_file_entry_get_utf8_hash_value_md5(
 
 		return( -1 );
 	}
+	hexadecimal_string.data      = NULL;
+	hexadecimal_string.data_size = 0;
+
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_MD5_HASH ) != 0 )
+	{
+		if( libewf_lef_file_entry_get_hexadecimal_string(
+		     lef_file_entry->md5_hash,
+		     16,
+		     hexadecimal_string_data,
+		     33,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MD5 hash hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		hexadecimal_string.data      = hexadecimal_string_data;
+		hexadecimal_string.data_size = 33;
+	}
 	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->md5_hash,
+	          &hexadecimal_string,
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -3078,6 +3352,9 @@ int libewf_lef_file_entry_get_utf16_hash_value_md5(
      size_t utf16_string_size,
      libcerror_error_t **error )
 {
+	libewf_serialized_string_t hexadecimal_string;
+	uint8_t hexadecimal_string_data[ 33 ];
+
 	static char *function = "libewf_lef_file_entry_get_utf16_hash_value_md5";
 	int result            = 0;
 
@@ -3092,8 +3369,32 @@ int libewf_lef_file_entry_get_utf16_hash_value_md5(
 
 		return( -1 );
 	}
+	hexadecimal_string.data      = NULL;
+	hexadecimal_string.data_size = 0;
+
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_MD5_HASH ) != 0 )
+	{
+		if( libewf_lef_file_entry_get_hexadecimal_string(
+		     lef_file_entry->md5_hash,
+		     16,
+		     hexadecimal_string_data,
+		     33,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MD5 hash hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		hexadecimal_string.data      = hexadecimal_string_data;
+		hexadecimal_string.data_size = 33;
+	}
 	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->md5_hash,
+	          &hexadecimal_string,
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -3121,6 +3422,9 @@ int libewf_lef_file_entry_get_utf8_hash_value_sha1(
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
+	libewf_serialized_string_t hexadecimal_string;
+	uint8_t hexadecimal_string_data[ 41 ];
+
 	static char *function = "libewf_lef_file_entry_get_utf8_hash_value_sha1";
 	int result            = 0;
 
@@ -3135,8 +3439,32 @@ int libewf_lef_file_entry_get_utf8_hash_value_sha1(
 
 		return( -1 );
 	}
+	hexadecimal_string.data      = NULL;
+	hexadecimal_string.data_size = 0;
+
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_SHA1_HASH ) != 0 )
+	{
+		if( libewf_lef_file_entry_get_hexadecimal_string(
+		     lef_file_entry->sha1_hash,
+		     20,
+		     hexadecimal_string_data,
+		     41,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve SHA1 hash hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		hexadecimal_string.data      = hexadecimal_string_data;
+		hexadecimal_string.data_size = 41;
+	}
 	result = libewf_serialized_string_get_utf8_string(
-	          lef_file_entry->sha1_hash,
+	          &hexadecimal_string,
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -3164,6 +3492,9 @@ int libewf_lef_file_entry_get_utf16_hash_value_sha1(
      size_t utf16_string_size,
      libcerror_error_t **error )
 {
+	libewf_serialized_string_t hexadecimal_string;
+	uint8_t hexadecimal_string_data[ 41 ];
+
 	static char *function = "libewf_lef_file_entry_get_utf16_hash_value_sha1";
 	int result            = 0;
 
@@ -3178,8 +3509,32 @@ int libewf_lef_file_entry_get_utf16_hash_value_sha1(
 
 		return( -1 );
 	}
+	hexadecimal_string.data      = NULL;
+	hexadecimal_string.data_size = 0;
+
+	if( ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_SHA1_HASH ) != 0 )
+	{
+		if( libewf_lef_file_entry_get_hexadecimal_string(
+		     lef_file_entry->sha1_hash,
+		     20,
+		     hexadecimal_string_data,
+		     41,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve SHA1 hash hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		hexadecimal_string.data      = hexadecimal_string_data;
+		hexadecimal_string.data_size = 41;
+	}
 	result = libewf_serialized_string_get_utf16_string(
-	          lef_file_entry->sha1_hash,
+	          &hexadecimal_string,
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -3219,6 +3574,23 @@ int libewf_lef_file_entry_get_number_of_extended_attributes(
 
 		return( -1 );
 	}
+	if( lef_file_entry->extended_attributes == NULL )
+	{
+		if( number_of_extended_attributes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of extended attributes.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_extended_attributes = 0;
+
+		return( 1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     lef_file_entry->extended_attributes,
 	     number_of_extended_attributes,
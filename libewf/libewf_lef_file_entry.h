@@ -30,27 +30,33 @@
 #include "libewf_libcerror.h"
 #include "libewf_libfvalue.h"
 #include "libewf_serialized_string.h"
+#include "libewf_single_file_tree_index.h"
+#include "libewf_string_pool.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+enum LIBEWF_LEF_FILE_ENTRY_VALUE_FLAGS
+{
+	LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_GUID			= 0x01,
+	LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_MD5_HASH			= 0x02,
+	LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_HAS_SHA1_HASH			= 0x04,
+	LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL		= 0x10,
+	LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_SHORT_NAME_IN_STRING_POOL	= 0x20
+};
+
 typedef struct libewf_lef_file_entry libewf_lef_file_entry_t;
 
+/* The members are ordered by size to minimize padding, since an image
+ * can contain millions of file entries
+ */
 struct libewf_lef_file_entry
 {
 	/* The identifier
 	 */
 	uint64_t identifier;
 
-	/* The type
-	 */
-	uint8_t type;
-
-	/* The flags
-	 */
-	uint32_t flags;
-
 	/* The data offset
 	 */
 	off64_t data_offset;
@@ -59,18 +65,6 @@ struct libewf_lef_file_entry
 	 */
 	size64_t data_size;
 
-	/* The GUID string
-	 */
-	libewf_serialized_string_t *guid;
-
-	/* The name string
-	 */
-	libewf_serialized_string_t *name;
-
-	/* The short name string
-	 */
-	libewf_serialized_string_t *short_name;
-
 	/* The (file) size
 	 */
 	size64_t size;
@@ -87,22 +81,6 @@ struct libewf_lef_file_entry
 	 */
 	off64_t duplicate_data_offset;
 
-	/* The identifier of the source of the file entry
-	 */
-	int source_identifier;
-
-	/* The identifier of the corresponding subject
-	 */
-	uint32_t subject_identifier;
-
-	/* The permission group index
-	 */
-	int permission_group_index;
-
-	/* The record type
-	 */
-	uint32_t record_type;
-
 	/* The creation date and time
 	 * stored as a POSIX timestamp
 	 */
@@ -128,17 +106,63 @@ struct libewf_lef_file_entry
 	 */
 	int64_t deletion_time;
 
-	/* The MD5 digest hash string
+	/* The name string
+	 * the data is owned by the string pool if LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL is set
 	 */
-	libewf_serialized_string_t *md5_hash;
+	libewf_serialized_string_t name;
 
-	/* The SHA1 digest hash string
+	/* The short name string
+	 * the data is owned by the string pool if LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_SHORT_NAME_IN_STRING_POOL is set
 	 */
-	libewf_serialized_string_t *sha1_hash;
+	libewf_serialized_string_t short_name;
 
 	/* The extended attributes array
 	 */
 	libcdata_array_t *extended_attributes;
+
+	/* The index of the sub nodes by name, set for directories with many sub nodes
+	 */
+	libewf_single_file_tree_index_t *sub_nodes_index;
+
+	/* The flags
+	 */
+	uint32_t flags;
+
+	/* The identifier of the corresponding subject
+	 */
+	uint32_t subject_identifier;
+
+	/* The record type
+	 */
+	uint32_t record_type;
+
+	/* The identifier of the source of the file entry
+	 */
+	int source_identifier;
+
+	/* The permission group index
+	 */
+	int permission_group_index;
+
+	/* The GUID
+	 */
+	uint8_t guid[ 16 ];
+
+	/* The MD5 digest hash
+	 */
+	uint8_t md5_hash[ 16 ];
+
+	/* The SHA1 digest hash
+	 */
+	uint8_t sha1_hash[ 20 ];
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The value flags
+	 */
+	uint8_t value_flags;
 };
 
 int libewf_lef_file_entry_initialize(
@@ -166,10 +190,34 @@ int libewf_lef_file_entry_read_extended_attributes(
      size_t data_size,
      libcerror_error_t **error );
 
+int libewf_lef_file_entry_read_string(
+     libewf_lef_file_entry_t *lef_file_entry,
+     libewf_serialized_string_t *serialized_string,
+     uint8_t string_pool_value_flag,
+     const uint8_t *data,
+     size_t data_size,
+     libewf_string_pool_t *string_pool,
+     libcerror_error_t **error );
+
+int libewf_lef_file_entry_read_hexadecimal_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libewf_lef_file_entry_get_hexadecimal_string(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
 int libewf_lef_file_entry_read_short_name(
      libewf_lef_file_entry_t *lef_file_entry,
      const uint8_t *data,
      size_t data_size,
+     libewf_string_pool_t *string_pool,
      libcerror_error_t **error );
 
 int libewf_lef_file_entry_read_data(
@@ -177,6 +225,7 @@ int libewf_lef_file_entry_read_data(
      libfvalue_split_utf8_string_t *types,
      const uint8_t *data,
      size_t data_size,
+     libewf_string_pool_t *string_pool,
      libcerror_error_t **error );
 
 int libewf_lef_file_entry_get_identifier(
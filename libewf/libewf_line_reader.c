@@ -0,0 +1,639 @@
+/*
+ * Line reader functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_libuna.h"
+#include "libewf_line_reader.h"
+
+/* The initial allocated line string size
+ */
+#define LIBEWF_LINE_READER_INITIAL_LINE_STRING_SIZE	256
+
+/* Creates a line reader
+ * The line reader references the data, which must remain available while the line reader is used
+ * Make sure the value line_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_line_reader_initialize(
+     libewf_line_reader_t **line_reader,
+     const uint8_t *data,
+     size_t data_size,
+     int encoding,
+     libcerror_error_t **error )
+{
+	static char *function   = "libewf_line_reader_initialize";
+	size_t data_offset      = 0;
+	uint16_t utf16_value    = 0;
+	int number_of_lines     = 1;
+
+	if( line_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *line_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid line reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( encoding != LIBEWF_LINE_READER_ENCODING_UTF8 )
+	 && ( encoding != LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported encoding.",
+		 function );
+
+		return( -1 );
+	}
+	if( encoding == LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN )
+	{
+		if( ( data_size % 2 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: missing UTF-16 stream value.",
+			 function );
+
+			return( -1 );
+		}
+		/* Ignore the byte order mark
+		 */
+		if( ( data_size >= 2 )
+		 && ( data[ 0 ] == 0xff )
+		 && ( data[ 1 ] == 0xfe ) )
+		{
+			data      += 2;
+			data_size -= 2;
+		}
+		/* Determine the number of lines up to the first end-of-string character
+		 */
+		while( data_offset < data_size )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ data_offset ] ),
+			 utf16_value );
+
+			if( utf16_value == 0 )
+			{
+				break;
+			}
+			if( utf16_value == (uint16_t) '\n' )
+			{
+				if( number_of_lines == INT_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid number of lines value exceeds maximum.",
+					 function );
+
+					return( -1 );
+				}
+				number_of_lines++;
+			}
+			data_offset += 2;
+		}
+	}
+	else
+	{
+		while( data_offset < data_size )
+		{
+			if( data[ data_offset ] == 0 )
+			{
+				break;
+			}
+			if( data[ data_offset ] == (uint8_t) '\n' )
+			{
+				if( number_of_lines == INT_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid number of lines value exceeds maximum.",
+					 function );
+
+					return( -1 );
+				}
+				number_of_lines++;
+			}
+			data_offset += 1;
+		}
+	}
+	*line_reader = memory_allocate_structure(
+	                libewf_line_reader_t );
+
+	if( *line_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *line_reader,
+	     0,
+	     sizeof( libewf_line_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear line reader.",
+		 function );
+
+		memory_free(
+		 *line_reader );
+
+		*line_reader = NULL;
+
+		return( -1 );
+	}
+	( *line_reader )->line_string = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * LIBEWF_LINE_READER_INITIAL_LINE_STRING_SIZE );
+
+	if( ( *line_reader )->line_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line string.",
+		 function );
+
+		goto on_error;
+	}
+	( *line_reader )->line_string_allocated_size = LIBEWF_LINE_READER_INITIAL_LINE_STRING_SIZE;
+	( *line_reader )->data                       = data;
+	( *line_reader )->data_size                  = data_offset;
+	( *line_reader )->encoding                   = encoding;
+	( *line_reader )->number_of_lines            = number_of_lines;
+	( *line_reader )->line_index                 = -1;
+
+	return( 1 );
+
+on_error:
+	if( *line_reader != NULL )
+	{
+		memory_free(
+		 *line_reader );
+
+		*line_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a line reader
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_line_reader_free(
+     libewf_line_reader_t **line_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_line_reader_free";
+
+	if( line_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *line_reader != NULL )
+	{
+		/* The data is referenced and not freed
+		 */
+		if( ( *line_reader )->line_string != NULL )
+		{
+			memory_free(
+			 ( *line_reader )->line_string );
+		}
+		memory_free(
+		 *line_reader );
+
+		*line_reader = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of lines
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_line_reader_get_number_of_lines(
+     libewf_line_reader_t *line_reader,
+     int *number_of_lines,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_line_reader_get_number_of_lines";
+
+	if( line_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lines == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of lines.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_lines = line_reader->number_of_lines;
+
+	return( 1 );
+}
+
+/* Reads the next line into the line string
+ * The line is converted into UTF-8 and a trailing carriage return is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_line_reader_read_next_line(
+     libewf_line_reader_t *line_reader,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	const uint8_t *line_data                     = NULL;
+	void *reallocation                           = NULL;
+	static char *function                        = "libewf_line_reader_read_next_line";
+	size_t line_data_size                        = 0;
+	size_t line_string_size                      = 0;
+	size_t required_size                         = 0;
+
+	if( line_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_reader->line_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid line reader - missing line string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( line_reader->line_index + 1 ) >= line_reader->number_of_lines )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: no more lines.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_reader->encoding == LIBEWF_LINE_READER_ENCODING_UTF8 )
+	{
+		/* The UTF-8 line data is copied as-is
+		 */
+		line_data = &( line_reader->data[ line_reader->data_offset ] );
+
+		while( line_reader->data_offset < line_reader->data_size )
+		{
+			if( line_reader->data[ line_reader->data_offset ] == (uint8_t) '\n' )
+			{
+				break;
+			}
+			line_reader->data_offset += 1;
+			line_data_size           += 1;
+		}
+		if( line_reader->data_offset < line_reader->data_size )
+		{
+			line_reader->data_offset += 1;
+		}
+		required_size = line_data_size + 1;
+
+		if( required_size > line_reader->line_string_allocated_size )
+		{
+			if( required_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid line string size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                line_reader->line_string,
+			                sizeof( uint8_t ) * required_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize line string.",
+				 function );
+
+				goto on_error;
+			}
+			line_reader->line_string                = (uint8_t *) reallocation;
+			line_reader->line_string_allocated_size = required_size;
+		}
+		if( line_data_size > 0 )
+		{
+			if( memory_copy(
+			     line_reader->line_string,
+			     line_data,
+			     line_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy line string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		line_string_size = line_data_size;
+	}
+	else
+	{
+		while( line_reader->data_offset < line_reader->data_size )
+		{
+			if( libuna_unicode_character_copy_from_utf16_stream(
+			     &unicode_character,
+			     line_reader->data,
+			     line_reader->data_size,
+			     &( line_reader->data_offset ),
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-16 stream.",
+				 function );
+
+				goto on_error;
+			}
+			if( unicode_character == (libuna_unicode_character_t) '\n' )
+			{
+				break;
+			}
+			/* A Unicode character requires at most 4 bytes in UTF-8
+			 * and 1 byte is reserved for the end-of-string character
+			 */
+			required_size = line_string_size + 5;
+
+			if( required_size > line_reader->line_string_allocated_size )
+			{
+				required_size = line_reader->line_string_allocated_size * 2;
+
+				if( required_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid line string size value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				reallocation = memory_reallocate(
+				                line_reader->line_string,
+				                sizeof( uint8_t ) * required_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize line string.",
+					 function );
+
+					goto on_error;
+				}
+				line_reader->line_string                = (uint8_t *) reallocation;
+				line_reader->line_string_allocated_size = required_size;
+			}
+			if( libuna_unicode_character_copy_to_utf8(
+			     unicode_character,
+			     line_reader->line_string,
+			     line_reader->line_string_allocated_size - 1,
+			     &line_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy Unicode character to UTF-8 string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* Remove trailing carriage return
+	 */
+	if( ( line_string_size > 0 )
+	 && ( line_reader->line_string[ line_string_size - 1 ] == (uint8_t) '\r' ) )
+	{
+		line_string_size -= 1;
+	}
+	line_reader->line_string[ line_string_size ] = 0;
+
+	line_reader->line_string_size = line_string_size + 1;
+	line_reader->line_index      += 1;
+
+	return( 1 );
+
+on_error:
+	/* Invalidate the line string so that a subsequent read restarts
+	 */
+	line_reader->data_offset      = 0;
+	line_reader->line_index       = -1;
+	line_reader->line_string_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a specific line
+ * Lines are read sequentially, retrieving the current or a following line does not
+ * require to read the preceding lines again, retrieving a preceding line does
+ * The line string is owned by the line reader and valid until the next line is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_line_reader_get_line_by_index(
+     libewf_line_reader_t *line_reader,
+     int line_index,
+     uint8_t **line_string,
+     size_t *line_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_line_reader_get_line_by_index";
+
+	if( line_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( line_index < 0 )
+	 || ( line_index >= line_reader->number_of_lines ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line string.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_index < line_reader->line_index )
+	{
+		line_reader->data_offset = 0;
+		line_reader->line_index  = -1;
+	}
+	while( line_reader->line_index < line_index )
+	{
+		if( libewf_line_reader_read_next_line(
+		     line_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read line: %d.",
+			 function,
+			 line_index );
+
+			return( -1 );
+		}
+	}
+	*line_string      = line_reader->line_string;
+	*line_string_size = line_reader->line_string_size;
+
+	return( 1 );
+}
+
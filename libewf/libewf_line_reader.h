@@ -0,0 +1,115 @@
+/*
+ * Line reader functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_LINE_READER_H )
+#define _LIBEWF_LINE_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The line reader encodings
+ */
+enum LIBEWF_LINE_READER_ENCODINGS
+{
+	LIBEWF_LINE_READER_ENCODING_UTF8			= 1,
+	LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN		= 2
+};
+
+typedef struct libewf_line_reader libewf_line_reader_t;
+
+struct libewf_line_reader
+{
+	/* The data, which is referenced and not copied
+	 */
+	const uint8_t *data;
+
+	/* The data size, up to the first end-of-string character
+	 */
+	size_t data_size;
+
+	/* The data offset of the next line
+	 */
+	size_t data_offset;
+
+	/* The encoding
+	 */
+	int encoding;
+
+	/* The number of lines
+	 */
+	int number_of_lines;
+
+	/* The index of the line in the line string or -1 if not set
+	 */
+	int line_index;
+
+	/* The UTF-8 encoded line string
+	 */
+	uint8_t *line_string;
+
+	/* The line string size, including the end-of-string character
+	 */
+	size_t line_string_size;
+
+	/* The allocated line string size
+	 */
+	size_t line_string_allocated_size;
+};
+
+int libewf_line_reader_initialize(
+     libewf_line_reader_t **line_reader,
+     const uint8_t *data,
+     size_t data_size,
+     int encoding,
+     libcerror_error_t **error );
+
+int libewf_line_reader_free(
+     libewf_line_reader_t **line_reader,
+     libcerror_error_t **error );
+
+int libewf_line_reader_get_number_of_lines(
+     libewf_line_reader_t *line_reader,
+     int *number_of_lines,
+     libcerror_error_t **error );
+
+int libewf_line_reader_read_next_line(
+     libewf_line_reader_t *line_reader,
+     libcerror_error_t **error );
+
+int libewf_line_reader_get_line_by_index(
+     libewf_line_reader_t *line_reader,
+     int line_index,
+     uint8_t **line_string,
+     size_t *line_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_LINE_READER_H ) */
+
@@ -218,18 +218,21 @@ int libewf_segment_table_free(
 
 			result = -1;
 		}
-		if( libfdata_list_free(
-		     &( ( *segment_table )->segment_files_list ),
-		     error ) != 1 )
+		if( ( *segment_table )->segment_files_list_is_shared == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free segment files list.",
-			 function );
-
-			result = -1;
+			if( libfdata_list_free(
+			     &( ( *segment_table )->segment_files_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free segment files list.",
+				 function );
+
+				result = -1;
+			}
 		}
 		memory_free(
 		 *segment_table );
@@ -266,18 +269,21 @@ int libewf_segment_table_clear(
 
 		segment_table->basename = NULL;
 	}
-	if( libfdata_list_empty(
-	     segment_table->segment_files_list,
-	     error ) != 1 )
+	if( segment_table->segment_files_list_is_shared == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty segment files list.",
-		 function );
+		if( libfdata_list_empty(
+		     segment_table->segment_files_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty segment files list.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 	if( libfcache_cache_empty(
 	     segment_table->segment_files_cache,
@@ -431,6 +437,8 @@ int libewf_segment_table_clone(
 		goto on_error;
 	}
 	( *destination_segment_table )->maximum_segment_size = source_segment_table->maximum_segment_size;
+	( *destination_segment_table )->number_of_segments   = source_segment_table->number_of_segments;
+	( *destination_segment_table )->flags                = source_segment_table->flags;
 
 	return( 1 );
 
@@ -456,6 +464,215 @@ on_error:
 	return( -1 );
 }
 
+/* Clones the segment table using a shared segment files list
+ * The segment files list is not managed by the destination segment table
+ * and must remain available until the destination segment table is freed
+ * or unshared, the segment files cache is not shared
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_table_clone_shared(
+     libewf_segment_table_t **destination_segment_table,
+     libewf_segment_table_t *source_segment_table,
+     libewf_io_handle_t *io_handle,
+     libfdata_list_t *segment_files_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_segment_table_clone_shared";
+
+	if( destination_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_segment_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination segment table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_files_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment files list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_segment_table_initialize(
+	     destination_segment_table,
+	     io_handle,
+	     source_segment_table->maximum_segment_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination segment table.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_segment_table->basename != NULL )
+	{
+		( *destination_segment_table )->basename = system_string_allocate(
+		                                            source_segment_table->basename_size );
+
+		if( ( *destination_segment_table )->basename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination basename.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_segment_table )->basename,
+		     source_segment_table->basename,
+		     sizeof( system_character_t ) * source_segment_table->basename_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination basename.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_segment_table )->basename_size = source_segment_table->basename_size;
+	}
+	if( libfdata_list_free(
+	     &( ( *destination_segment_table )->segment_files_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination segment files list.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_segment_table )->segment_files_list           = segment_files_list;
+	( *destination_segment_table )->segment_files_list_is_shared = 1;
+	( *destination_segment_table )->number_of_segments           = source_segment_table->number_of_segments;
+	( *destination_segment_table )->flags                        = source_segment_table->flags;
+
+	return( 1 );
+
+on_error:
+	if( *destination_segment_table != NULL )
+	{
+		libewf_segment_table_free(
+		 destination_segment_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Unshares the segment table
+ * Replaces a shared segment files list by an empty segment files list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_segment_table_unshare(
+     libewf_segment_table_t *segment_table,
+     libewf_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	libfdata_list_t *segment_files_list = NULL;
+	static char *function               = "libewf_segment_table_unshare";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_table->segment_files_list_is_shared == 0 )
+	{
+		return( 1 );
+	}
+	if( libfdata_list_initialize(
+	     &segment_files_list,
+	     (intptr_t *) io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_io_handle_clone,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libewf_segment_file_read_element_data,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment files list.",
+		 function );
+
+		return( -1 );
+	}
+	/* The cached segment files were read using the shared segment files list
+	 */
+	if( libfcache_cache_empty(
+	     segment_table->segment_files_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty segment files cache.",
+		 function );
+
+		libfdata_list_free(
+		 &segment_files_list,
+		 NULL );
+
+		return( -1 );
+	}
+	segment_table->segment_files_list           = segment_files_list;
+	segment_table->segment_files_list_is_shared = 0;
+	segment_table->number_of_segments           = 0;
+	segment_table->flags                        = 0;
+
+	return( 1 );
+}
+
 /* Empties the segment table
  * Returns 1 if successful or -1 on error
  */
@@ -484,18 +701,21 @@ int libewf_segment_table_empty(
 
 		segment_table->basename = NULL;
 	}
-	if( libfdata_list_empty(
-	     segment_table->segment_files_list,
-	     error ) != 1 )
+	if( segment_table->segment_files_list_is_shared == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty segment files list.",
-		 function );
+		if( libfdata_list_empty(
+		     segment_table->segment_files_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty segment files list.",
+			 function );
 
-		result = -1;
+			result = -1;
+		}
 	}
 	if( libfcache_cache_empty(
 	     segment_table->segment_files_cache,
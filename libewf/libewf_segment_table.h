@@ -64,6 +64,10 @@ struct libewf_segment_table
 	 */
 	libfcache_cache_t *segment_files_cache;
 
+	/* Value to indicate the segment files list is shared with other segment tables
+	 */
+	uint8_t segment_files_list_is_shared;
+
 	/* Flags
 	 */
 	uint8_t flags;
@@ -88,6 +92,18 @@ int libewf_segment_table_clone(
      libewf_segment_table_t *source_segment_table,
      libcerror_error_t **error );
 
+int libewf_segment_table_clone_shared(
+     libewf_segment_table_t **destination_segment_table,
+     libewf_segment_table_t *source_segment_table,
+     libewf_io_handle_t *io_handle,
+     libfdata_list_t *segment_files_list,
+     libcerror_error_t **error );
+
+int libewf_segment_table_unshare(
+     libewf_segment_table_t *segment_table,
+     libewf_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libewf_segment_table_empty(
      libewf_segment_table_t *segment_table,
      libcerror_error_t **error );
@@ -20,13 +20,16 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
+#include "libewf_definitions.h"
 #include "libewf_lef_file_entry.h"
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
 #include "libewf_libuna.h"
 #include "libewf_single_file_tree.h"
+#include "libewf_single_file_tree_index.h"
 
 /* Retrieves the file entry sub node for the specific UTF-8 formatted name
  * Returns 1 if successful, 0 in no such value or -1 on error
@@ -40,6 +43,7 @@ int libewf_single_file_tree_get_sub_node_by_utf8_name(
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *safe_sub_node              = NULL;
+	libewf_lef_file_entry_t *lef_file_entry          = NULL;
 	libewf_lef_file_entry_t *safe_sub_lef_file_entry = NULL;
 	static char *function                            = "libewf_single_file_tree_get_sub_node_by_utf8_name";
 	int compare_result                               = LIBUNA_COMPARE_GREATER;
@@ -83,6 +87,62 @@ int libewf_single_file_tree_get_sub_node_by_utf8_name(
 	*sub_node           = NULL;
 	*sub_lef_file_entry = NULL;
 
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lef_file_entry != NULL )
+	 && ( lef_file_entry->sub_nodes_index != NULL ) )
+	{
+		result = libewf_single_file_tree_index_get_sub_node_by_utf8_name(
+		          lef_file_entry->sub_nodes_index,
+		          utf8_string,
+		          utf8_string_length,
+		          &safe_sub_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node from index.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_tree_node_get_value(
+			     safe_sub_node,
+			     (intptr_t **) &safe_sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub node.",
+				 function );
+
+				return( -1 );
+			}
+			*sub_node           = safe_sub_node;
+			*sub_lef_file_entry = safe_sub_lef_file_entry;
+		}
+		return( result );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     node,
 	     &number_of_sub_nodes,
@@ -144,7 +204,7 @@ int libewf_single_file_tree_get_sub_node_by_utf8_name(
 			return( -1 );
 		}
 		compare_result = libewf_serialized_string_compare_with_utf8_string(
-		                  safe_sub_lef_file_entry->name,
+		                  &( safe_sub_lef_file_entry->name ),
 		                  utf8_string,
 		                  utf8_string_length,
 		                  error );
@@ -200,6 +260,7 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *safe_sub_node              = NULL;
+	libewf_lef_file_entry_t *lef_file_entry          = NULL;
 	libewf_lef_file_entry_t *safe_sub_lef_file_entry = NULL;
 	static char *function                            = "libewf_single_file_tree_get_sub_node_by_utf16_name";
 	int compare_result                               = LIBUNA_COMPARE_GREATER;
@@ -243,6 +304,62 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
 	*sub_node           = NULL;
 	*sub_lef_file_entry = NULL;
 
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lef_file_entry != NULL )
+	 && ( lef_file_entry->sub_nodes_index != NULL ) )
+	{
+		result = libewf_single_file_tree_index_get_sub_node_by_utf16_name(
+		          lef_file_entry->sub_nodes_index,
+		          utf16_string,
+		          utf16_string_length,
+		          &safe_sub_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node from index.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_tree_node_get_value(
+			     safe_sub_node,
+			     (intptr_t **) &safe_sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub node.",
+				 function );
+
+				return( -1 );
+			}
+			*sub_node           = safe_sub_node;
+			*sub_lef_file_entry = safe_sub_lef_file_entry;
+		}
+		return( result );
+	}
 	if( libcdata_tree_node_get_number_of_sub_nodes(
 	     node,
 	     &number_of_sub_nodes,
@@ -304,7 +421,7 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
 			return( -1 );
 		}
 		compare_result = libewf_serialized_string_compare_with_utf16_string(
-		                  safe_sub_lef_file_entry->name,
+		                  &( safe_sub_lef_file_entry->name ),
 		                  utf16_string,
 		                  utf16_string_length,
 		                  error );
@@ -348,3 +465,759 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
 	return( result );
 }
 
+/* Creates the index of the sub nodes of a single file tree node
+ * The index is only created when the node has a large number of sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_create_index(
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_single_file_tree_create_index";
+	int number_of_sub_nodes                 = 0;
+	int result                              = 0;
+
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lef_file_entry == NULL )
+	 || ( lef_file_entry->sub_nodes_index != NULL ) )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes < LIBEWF_SINGLE_FILE_TREE_INDEX_MINIMUM_NUMBER_OF_SUB_NODES )
+	{
+		return( 1 );
+	}
+	/* If the index cannot be created the sub nodes are scanned linearly
+	 */
+	result = libewf_single_file_tree_index_initialize(
+	          &( lef_file_entry->sub_nodes_index ),
+	          node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub nodes index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates the indexes of the sub nodes of a single file tree node and all its sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_create_indexes(
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node = NULL;
+	static char *function          = "libewf_single_file_tree_create_indexes";
+	int number_of_sub_nodes        = 0;
+	int sub_node_index             = 0;
+
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libewf_single_file_tree_create_indexes(
+		     sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create indexes of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	if( libewf_single_file_tree_create_index(
+	     node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of a single file tree node
+ * The path is relative to the root node and starts with the \ separator
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_get_utf8_path_size(
+     libcdata_tree_node_t *node,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *parent_node       = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_single_file_tree_get_utf8_path_size";
+	size_t safe_utf8_string_size            = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	while( node != NULL )
+	{
+		if( libcdata_tree_node_get_parent_node(
+		     node,
+		     &parent_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node.",
+			 function );
+
+			return( -1 );
+		}
+		/* The name of the root node is not part of the path
+		 */
+		if( parent_node == NULL )
+		{
+			break;
+		}
+		if( libcdata_tree_node_get_value(
+		     node,
+		     (intptr_t **) &lef_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from node.",
+			 function );
+
+			return( -1 );
+		}
+		if( lef_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file entry values.",
+			 function );
+
+			return( -1 );
+		}
+		/* Add the separator
+		 */
+		safe_utf8_string_size += 1;
+
+		if( lef_file_entry->name.data_size > 1 )
+		{
+			safe_utf8_string_size += lef_file_entry->name.data_size - 1;
+		}
+		node = parent_node;
+	}
+	/* The path of the root node consists of a single separator
+	 */
+	if( safe_utf8_string_size == 0 )
+	{
+		safe_utf8_string_size = 1;
+	}
+	*utf8_string_size = safe_utf8_string_size + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a single file tree node
+ * The path is relative to the root node and starts with the \ separator
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_get_utf8_path(
+     libcdata_tree_node_t *node,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *parent_node       = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_single_file_tree_get_utf8_path";
+	size_t name_length                      = 0;
+	size_t path_size                        = 0;
+	size_t utf8_string_index                = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_file_tree_get_utf8_path_size(
+	     node,
+	     &path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The path is filled in from the end since the tree is walked towards the root node
+	 */
+	utf8_string_index = path_size - 1;
+
+	utf8_string[ utf8_string_index ] = 0;
+
+	while( node != NULL )
+	{
+		if( libcdata_tree_node_get_parent_node(
+		     node,
+		     &parent_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_node == NULL )
+		{
+			break;
+		}
+		if( libcdata_tree_node_get_value(
+		     node,
+		     (intptr_t **) &lef_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from node.",
+			 function );
+
+			return( -1 );
+		}
+		if( lef_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file entry values.",
+			 function );
+
+			return( -1 );
+		}
+		name_length = 0;
+
+		if( lef_file_entry->name.data_size > 1 )
+		{
+			name_length = lef_file_entry->name.data_size - 1;
+		}
+		if( ( name_length + 1 ) > utf8_string_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string_index -= name_length;
+
+		if( name_length > 0 )
+		{
+			if( memory_copy(
+			     &( utf8_string[ utf8_string_index ] ),
+			     lef_file_entry->name.data,
+			     name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name to UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		utf8_string_index -= 1;
+
+		utf8_string[ utf8_string_index ] = (uint8_t) LIBEWF_SEPARATOR;
+
+		node = parent_node;
+	}
+	if( path_size == 2 )
+	{
+		utf8_string[ 0 ] = (uint8_t) LIBEWF_SEPARATOR;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of file nodes of a single file tree node and all its sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_get_number_of_file_nodes(
+     libcdata_tree_node_t *node,
+     int *number_of_file_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node          = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_single_file_tree_get_number_of_file_nodes";
+	int number_of_sub_nodes                 = 0;
+	int sub_node_index                      = 0;
+
+	if( number_of_file_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lef_file_entry != NULL )
+	 && ( lef_file_entry->type == LIBEWF_FILE_ENTRY_TYPE_FILE ) )
+	{
+		if( *number_of_file_nodes == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of file nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_file_nodes += 1;
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libewf_single_file_tree_get_number_of_file_nodes(
+		     sub_node,
+		     number_of_file_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of file nodes of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the file nodes of a single file tree node and all its sub nodes
+ * The file nodes are stored in tree order starting at file node index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_get_file_nodes(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **file_nodes,
+     int number_of_file_nodes,
+     int *file_node_index,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node          = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	static char *function                   = "libewf_single_file_tree_get_file_nodes";
+	int number_of_sub_nodes                 = 0;
+	int sub_node_index                      = 0;
+
+	if( file_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lef_file_entry != NULL )
+	 && ( lef_file_entry->type == LIBEWF_FILE_ENTRY_TYPE_FILE ) )
+	{
+		if( ( *file_node_index < 0 )
+		 || ( *file_node_index >= number_of_file_nodes ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file node index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		file_nodes[ *file_node_index ] = node;
+
+		*file_node_index += 1;
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_sub_node_by_index(
+	     node,
+	     0,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libewf_single_file_tree_get_file_nodes(
+		     sub_node,
+		     file_nodes,
+		     number_of_file_nodes,
+		     file_node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file nodes of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two references to file nodes by the data offset of their file entry
+ * Callback function for qsort, file nodes with the same data offset are ordered by identifier
+ * Returns -1 if the first is less than the second, 0 if equal or 1 if greater
+ */
+int libewf_single_file_tree_compare_file_nodes_by_data_offset(
+     const void *first_file_node,
+     const void *second_file_node )
+{
+	libewf_lef_file_entry_t *first_lef_file_entry  = NULL;
+	libewf_lef_file_entry_t *second_lef_file_entry = NULL;
+
+	if( libcdata_tree_node_get_value(
+	     *( (libcdata_tree_node_t * const *) first_file_node ),
+	     (intptr_t **) &first_lef_file_entry,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libcdata_tree_node_get_value(
+	     *( (libcdata_tree_node_t * const *) second_file_node ),
+	     (intptr_t **) &second_lef_file_entry,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( first_lef_file_entry == NULL )
+	 || ( second_lef_file_entry == NULL ) )
+	{
+		return( 0 );
+	}
+	if( first_lef_file_entry->data_offset < second_lef_file_entry->data_offset )
+	{
+		return( -1 );
+	}
+	else if( first_lef_file_entry->data_offset > second_lef_file_entry->data_offset )
+	{
+		return( 1 );
+	}
+	if( first_lef_file_entry->identifier < second_lef_file_entry->identifier )
+	{
+		return( -1 );
+	}
+	else if( first_lef_file_entry->identifier > second_lef_file_entry->identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
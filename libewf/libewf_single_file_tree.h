@@ -49,6 +49,41 @@ int libewf_single_file_tree_get_sub_node_by_utf16_name(
      libewf_lef_file_entry_t **sub_lef_file_entry,
      libcerror_error_t **error );
 
+int libewf_single_file_tree_create_index(
+     libcdata_tree_node_t *single_file_tree_node,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_create_indexes(
+     libcdata_tree_node_t *single_file_tree_node,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_get_utf8_path_size(
+     libcdata_tree_node_t *single_file_tree_node,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_get_utf8_path(
+     libcdata_tree_node_t *single_file_tree_node,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_get_number_of_file_nodes(
+     libcdata_tree_node_t *single_file_tree_node,
+     int *number_of_file_nodes,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_get_file_nodes(
+     libcdata_tree_node_t *single_file_tree_node,
+     libcdata_tree_node_t **file_nodes,
+     int number_of_file_nodes,
+     int *file_node_index,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_compare_file_nodes_by_data_offset(
+     const void *first_file_node,
+     const void *second_file_node );
+
 #if defined( __cplusplus )
 }
 #endif
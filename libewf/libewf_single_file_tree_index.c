@@ -0,0 +1,754 @@
+/*
+ * Single file tree index functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_lef_file_entry.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_libuna.h"
+#include "libewf_serialized_string.h"
+#include "libewf_single_file_tree_index.h"
+
+/* The FNV-1a 32-bit offset basis and prime
+ */
+#define LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_OFFSET_BASIS		0x811c9dc5UL
+#define LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_PRIME		0x01000193UL
+
+/* Updates a name hash with an Unicode character
+ */
+#define libewf_single_file_tree_index_hash_update( name_hash, unicode_character ) \
+	name_hash ^= (uint32_t) ( ( unicode_character ) & 0xff ); \
+	name_hash *= LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_PRIME; \
+	name_hash ^= (uint32_t) ( ( ( unicode_character ) >> 8 ) & 0xff ); \
+	name_hash *= LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_PRIME; \
+	name_hash ^= (uint32_t) ( ( ( unicode_character ) >> 16 ) & 0xff ); \
+	name_hash *= LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_PRIME
+
+/* Creates a single file tree index of the sub nodes of a single file tree node
+ * The index references the sub nodes and must be freed before the sub nodes are
+ * Make sure the value single_file_tree_index is referencing, is set to NULL
+ * Returns 1 if successful, 0 if the name of a sub node cannot be indexed or -1 on error
+ */
+int libewf_single_file_tree_index_initialize(
+     libewf_single_file_tree_index_t **single_file_tree_index,
+     libcdata_tree_node_t *single_file_tree_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node              = NULL;
+	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
+	libewf_single_file_tree_index_entry_t *entry = NULL;
+	const uint8_t *name_data                    = NULL;
+	static char *function                       = "libewf_single_file_tree_index_initialize";
+	size_t name_data_size                       = 0;
+	uint32_t bucket_index                       = 0;
+	int bucket_iterator                         = 0;
+	int number_of_buckets                       = 0;
+	int number_of_sub_nodes                     = 0;
+	int result                                  = 1;
+	int sub_node_index                          = 0;
+
+	if( single_file_tree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file tree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *single_file_tree_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid single file tree index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     single_file_tree_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_single_file_tree_index_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of sub nodes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a power of 2 number of buckets of at least the number of sub nodes
+	 */
+	number_of_buckets = 1;
+
+	while( number_of_buckets < number_of_sub_nodes )
+	{
+		number_of_buckets <<= 1;
+	}
+	*single_file_tree_index = memory_allocate_structure(
+	                           libewf_single_file_tree_index_t );
+
+	if( *single_file_tree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create single file tree index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *single_file_tree_index,
+	     0,
+	     sizeof( libewf_single_file_tree_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear single file tree index.",
+		 function );
+
+		memory_free(
+		 *single_file_tree_index );
+
+		*single_file_tree_index = NULL;
+
+		return( -1 );
+	}
+	( *single_file_tree_index )->buckets = (int *) memory_allocate(
+	                                                sizeof( int ) * number_of_buckets );
+
+	if( ( *single_file_tree_index )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *single_file_tree_index )->number_of_buckets = number_of_buckets;
+
+	for( bucket_iterator = 0;
+	     bucket_iterator < number_of_buckets;
+	     bucket_iterator++ )
+	{
+		( *single_file_tree_index )->buckets[ bucket_iterator ] = -1;
+	}
+	if( number_of_sub_nodes > 0 )
+	{
+		( *single_file_tree_index )->entries = (libewf_single_file_tree_index_entry_t *) memory_allocate(
+		                                                                                  sizeof( libewf_single_file_tree_index_entry_t ) * number_of_sub_nodes );
+
+		if( ( *single_file_tree_index )->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_tree_node_get_sub_node_by_index(
+		     single_file_tree_node,
+		     0,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first sub node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *single_file_tree_index )->number_of_entries = number_of_sub_nodes;
+
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libcdata_tree_node_get_value(
+		     sub_node,
+		     (intptr_t **) &sub_lef_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		if( sub_lef_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub file entry: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		entry = &( ( *single_file_tree_index )->entries[ sub_node_index ] );
+
+		entry->sub_node         = sub_node;
+		entry->name_hash        = LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_OFFSET_BASIS;
+		entry->next_entry_index = -1;
+
+		if( sub_lef_file_entry->name.data != NULL )
+		{
+			name_data      = sub_lef_file_entry->name.data;
+			name_data_size = sub_lef_file_entry->name.data_size;
+
+			/* Ignore the UTF-8 byte order mark like the UTF-8 stream comparison does
+			 */
+			if( ( name_data_size >= 3 )
+			 && ( name_data[ 0 ] == 0xef )
+			 && ( name_data[ 1 ] == 0xbb )
+			 && ( name_data[ 2 ] == 0xbf ) )
+			{
+				name_data      += 3;
+				name_data_size -= 3;
+			}
+			if( libewf_single_file_tree_index_get_utf8_name_hash(
+			     name_data,
+			     name_data_size,
+			     &( entry->name_hash ),
+			     error ) != 1 )
+			{
+				/* The name cannot be indexed, the caller falls back to a linear scan
+				 */
+				libcerror_error_free(
+				 error );
+
+				result = 0;
+
+				goto on_error;
+			}
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node from sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+	}
+	/* Add the entries in reverse order so that the entries of a bucket are
+	 * in sub node order and the first matching sub node is found first
+	 */
+	for( sub_node_index = number_of_sub_nodes - 1;
+	     sub_node_index >= 0;
+	     sub_node_index-- )
+	{
+		entry = &( ( *single_file_tree_index )->entries[ sub_node_index ] );
+
+		bucket_index = entry->name_hash & (uint32_t) ( number_of_buckets - 1 );
+
+		entry->next_entry_index = ( *single_file_tree_index )->buckets[ bucket_index ];
+
+		( *single_file_tree_index )->buckets[ bucket_index ] = sub_node_index;
+	}
+	return( 1 );
+
+on_error:
+	if( *single_file_tree_index != NULL )
+	{
+		if( ( *single_file_tree_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *single_file_tree_index )->entries );
+		}
+		if( ( *single_file_tree_index )->buckets != NULL )
+		{
+			memory_free(
+			 ( *single_file_tree_index )->buckets );
+		}
+		memory_free(
+		 *single_file_tree_index );
+
+		*single_file_tree_index = NULL;
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	return( -1 );
+}
+
+/* Frees a single file tree index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_index_free(
+     libewf_single_file_tree_index_t **single_file_tree_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_single_file_tree_index_free";
+
+	if( single_file_tree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file tree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *single_file_tree_index != NULL )
+	{
+		/* The sub nodes are referenced and not freed
+		 */
+		if( ( *single_file_tree_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *single_file_tree_index )->entries );
+		}
+		if( ( *single_file_tree_index )->buckets != NULL )
+		{
+			memory_free(
+			 ( *single_file_tree_index )->buckets );
+		}
+		memory_free(
+		 *single_file_tree_index );
+
+		*single_file_tree_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the hash of an UTF-8 formatted name
+ * The hash is calculated over the Unicode characters so that UTF-8 and UTF-16
+ * formatted names result in the same hash
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_index_get_utf8_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libewf_single_file_tree_index_get_utf8_name_hash";
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_name_hash                      = LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_OFFSET_BASIS;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     (libuna_utf8_character_t *) utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		libewf_single_file_tree_index_hash_update(
+		 safe_name_hash,
+		 unicode_character );
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the hash of an UTF-16 formatted name
+ * The hash is calculated over the Unicode characters so that UTF-8 and UTF-16
+ * formatted names result in the same hash
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_file_tree_index_get_utf16_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libewf_single_file_tree_index_get_utf16_name_hash";
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_name_hash                      = LIBEWF_SINGLE_FILE_TREE_INDEX_HASH_OFFSET_BASIS;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     (libuna_utf16_character_t *) utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		libewf_single_file_tree_index_hash_update(
+		 safe_name_hash,
+		 unicode_character );
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the sub node for the specific UTF-8 formatted name
+ * Returns 1 if successful, 0 if no such sub node or -1 on error
+ */
+int libewf_single_file_tree_index_get_sub_node_by_utf8_name(
+     libewf_single_file_tree_index_t *single_file_tree_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcdata_tree_node_t **single_file_tree_sub_node,
+     libcerror_error_t **error )
+{
+	libewf_lef_file_entry_t *sub_lef_file_entry  = NULL;
+	libewf_single_file_tree_index_entry_t *entry = NULL;
+	static char *function                        = "libewf_single_file_tree_index_get_sub_node_by_utf8_name";
+	uint32_t name_hash                           = 0;
+	int compare_result                           = 0;
+	int entry_index                              = 0;
+
+	if( single_file_tree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file tree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_file_tree_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file tree sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_file_tree_index_get_utf8_name_hash(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = single_file_tree_index->buckets[ name_hash & (uint32_t) ( single_file_tree_index->number_of_buckets - 1 ) ];
+
+	while( entry_index != -1 )
+	{
+		entry = &( single_file_tree_index->entries[ entry_index ] );
+
+		if( entry->name_hash == name_hash )
+		{
+			if( libcdata_tree_node_get_value(
+			     entry->sub_node,
+			     (intptr_t **) &sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub node: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			compare_result = libewf_serialized_string_compare_with_utf8_string(
+			                  &( sub_lef_file_entry->name ),
+			                  utf8_string,
+			                  utf8_string_length,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare name with UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( compare_result == LIBUNA_COMPARE_EQUAL )
+			{
+				*single_file_tree_sub_node = entry->sub_node;
+
+				return( 1 );
+			}
+		}
+		entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the sub node for the specific UTF-16 formatted name
+ * Returns 1 if successful, 0 if no such sub node or -1 on error
+ */
+int libewf_single_file_tree_index_get_sub_node_by_utf16_name(
+     libewf_single_file_tree_index_t *single_file_tree_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcdata_tree_node_t **single_file_tree_sub_node,
+     libcerror_error_t **error )
+{
+	libewf_lef_file_entry_t *sub_lef_file_entry  = NULL;
+	libewf_single_file_tree_index_entry_t *entry = NULL;
+	static char *function                        = "libewf_single_file_tree_index_get_sub_node_by_utf16_name";
+	uint32_t name_hash                           = 0;
+	int compare_result                           = 0;
+	int entry_index                              = 0;
+
+	if( single_file_tree_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file tree index.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_file_tree_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single file tree sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_file_tree_index_get_utf16_name_hash(
+	     utf16_string,
+	     utf16_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = single_file_tree_index->buckets[ name_hash & (uint32_t) ( single_file_tree_index->number_of_buckets - 1 ) ];
+
+	while( entry_index != -1 )
+	{
+		entry = &( single_file_tree_index->entries[ entry_index ] );
+
+		if( entry->name_hash == name_hash )
+		{
+			if( libcdata_tree_node_get_value(
+			     entry->sub_node,
+			     (intptr_t **) &sub_lef_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from sub node: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			compare_result = libewf_serialized_string_compare_with_utf16_string(
+			                  &( sub_lef_file_entry->name ),
+			                  utf16_string,
+			                  utf16_string_length,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare name with UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( compare_result == LIBUNA_COMPARE_EQUAL )
+			{
+				*single_file_tree_sub_node = entry->sub_node;
+
+				return( 1 );
+			}
+		}
+		entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Single file tree index functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_SINGLE_FILE_TREE_INDEX_H )
+#define _LIBEWF_SINGLE_FILE_TREE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of sub nodes for which an index is created
+ * for less sub nodes a linear scan is sufficient
+ */
+#define LIBEWF_SINGLE_FILE_TREE_INDEX_MINIMUM_NUMBER_OF_SUB_NODES	16
+
+typedef struct libewf_single_file_tree_index_entry libewf_single_file_tree_index_entry_t;
+
+struct libewf_single_file_tree_index_entry
+{
+	/* The sub node
+	 */
+	libcdata_tree_node_t *sub_node;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The index of the next entry in the same bucket or -1 if not set
+	 */
+	int next_entry_index;
+};
+
+typedef struct libewf_single_file_tree_index libewf_single_file_tree_index_t;
+
+struct libewf_single_file_tree_index
+{
+	/* The buckets, contains the index of the first entry per bucket or -1 if not set
+	 */
+	int *buckets;
+
+	/* The number of buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The entries
+	 */
+	libewf_single_file_tree_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libewf_single_file_tree_index_initialize(
+     libewf_single_file_tree_index_t **single_file_tree_index,
+     libcdata_tree_node_t *single_file_tree_node,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_free(
+     libewf_single_file_tree_index_t **single_file_tree_index,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_get_utf8_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_get_utf16_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_get_sub_node_by_utf8_name(
+     libewf_single_file_tree_index_t *single_file_tree_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcdata_tree_node_t **single_file_tree_sub_node,
+     libcerror_error_t **error );
+
+int libewf_single_file_tree_index_get_sub_node_by_utf16_name(
+     libewf_single_file_tree_index_t *single_file_tree_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcdata_tree_node_t **single_file_tree_sub_node,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_SINGLE_FILE_TREE_INDEX_H ) */
+
@@ -34,7 +34,10 @@
 #include "libewf_libcnotify.h"
 #include "libewf_libfvalue.h"
 #include "libewf_libuna.h"
+#include "libewf_line_reader.h"
 #include "libewf_permission_group.h"
+#include "libewf_single_file_tree.h"
+#include "libewf_string_pool.h"
 #include "libewf_single_files.h"
 
 /* Creates single files
@@ -130,11 +133,31 @@ int libewf_single_files_initialize(
 
 		goto on_error;
 	}
+	if( libewf_string_pool_initialize(
+	     &( ( *single_files )->string_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string pool.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *single_files != NULL )
 	{
+		if( ( *single_files )->sources != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *single_files )->sources ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libewf_lef_source_free,
+			 NULL );
+		}
 		if( ( *single_files )->permission_groups != NULL )
 		{
 			libcdata_array_free(
@@ -224,6 +247,30 @@ int libewf_single_files_free(
 				result = -1;
 			}
 		}
+		if( ( *single_files )->media_order_file_nodes != NULL )
+		{
+			memory_free(
+			 ( *single_files )->media_order_file_nodes );
+		}
+		/* The string pool is freed after the file entry tree
+		 * since the file entries reference strings in the pool
+		 */
+		if( ( *single_files )->string_pool != NULL )
+		{
+			if( libewf_string_pool_free(
+			     &( ( *single_files )->string_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free string pool.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *single_files );
 
@@ -284,9 +331,13 @@ int libewf_single_files_clone(
 
 		goto on_error;
 	}
-	( *destination_single_files )->permission_groups         = NULL;
-	( *destination_single_files )->sources                   = NULL;
-	( *destination_single_files )->file_entry_tree_root_node = NULL;
+	( *destination_single_files )->permission_groups                = NULL;
+	( *destination_single_files )->sources                          = NULL;
+	( *destination_single_files )->file_entry_tree_root_node        = NULL;
+	( *destination_single_files )->string_pool                      = NULL;
+	( *destination_single_files )->media_order_file_nodes           = NULL;
+	( *destination_single_files )->number_of_media_order_file_nodes = 0;
+	( *destination_single_files )->media_order_file_nodes_created   = 0;
 
 	if( libcdata_array_clone(
 	     &( ( *destination_single_files )->permission_groups ),
@@ -320,6 +371,21 @@ int libewf_single_files_clone(
 
 		goto on_error;
 	}
+	/* The cloned file entries own their strings
+	 */
+	if( libewf_string_pool_initialize(
+	     &( ( *destination_single_files )->string_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination string pool.",
+		 function );
+
+		goto on_error;
+	}
 	if( libcdata_tree_node_clone(
 	     &( ( *destination_single_files )->file_entry_tree_root_node ),
 	     source_single_files->file_entry_tree_root_node,
@@ -336,6 +402,22 @@ int libewf_single_files_clone(
 
 		goto on_error;
 	}
+	if( ( *destination_single_files )->file_entry_tree_root_node != NULL )
+	{
+		if( libewf_single_file_tree_create_indexes(
+		     ( *destination_single_files )->file_entry_tree_root_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination file entry tree indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -349,10 +431,11 @@ on_error:
 }
 
 /* Parses a line
+ * The line string is owned by the line reader and valid until the next line is parsed
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_line(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int line_index,
      uint8_t **line_string,
      size_t *line_string_size,
@@ -384,8 +467,10 @@ int libewf_single_files_parse_line(
 
 		return( -1 );
 	}
-	if( libfvalue_split_utf8_string_get_segment_by_index(
-	     lines,
+	/* The line reader removes the trailing carriage return
+	 */
+	if( libewf_line_reader_get_line_by_index(
+	     line_reader,
 	     line_index,
 	     &safe_line_string,
 	     &safe_line_string_size,
@@ -413,17 +498,6 @@ int libewf_single_files_parse_line(
 
 		return( -1 );
 	}
-	/* Remove trailing carriage return
-	 */
-	if( safe_line_string_size >= 2 )
-	{
-		if( safe_line_string[ safe_line_string_size - 2 ] == (uint8_t) '\r' )
-		{
-			safe_line_string[ safe_line_string_size - 2 ] = 0;
-
-			safe_line_string_size -= 1;
-		}
-	}
 	*line_string      = safe_line_string;
 	*line_string_size = safe_line_string_size;
 
@@ -434,7 +508,7 @@ int libewf_single_files_parse_line(
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_category_number_of_entries(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      int *number_of_entries,
      libcerror_error_t **error )
@@ -474,7 +548,7 @@ int libewf_single_files_parse_category_number_of_entries(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -639,7 +713,7 @@ on_error:
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_category_types(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libfvalue_split_utf8_string_t **types,
      libcerror_error_t **error )
@@ -663,7 +737,7 @@ int libewf_single_files_parse_category_types(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -706,7 +780,7 @@ int libewf_single_files_parse_category_types(
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_number_of_entries(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      int *number_of_entries,
      libcerror_error_t **error )
@@ -746,7 +820,7 @@ int libewf_single_files_parse_number_of_entries(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1013,7 +1087,7 @@ int libewf_single_files_parse_format(
  */
 int libewf_single_files_parse_rec_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      size64_t *media_size,
      libcerror_error_t **error )
@@ -1048,7 +1122,7 @@ int libewf_single_files_parse_rec_category(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1081,7 +1155,7 @@ int libewf_single_files_parse_rec_category(
 		return( -1 );
 	}
 	if( libewf_single_files_parse_record_values(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     media_size,
 	     error ) != 1 )
@@ -1098,7 +1172,7 @@ int libewf_single_files_parse_rec_category(
 	/* The category should be followed by an empty line
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1138,7 +1212,7 @@ int libewf_single_files_parse_rec_category(
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_record_values(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      size64_t *media_size,
      libcerror_error_t **error )
@@ -1183,7 +1257,7 @@ int libewf_single_files_parse_record_values(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1232,7 +1306,7 @@ int libewf_single_files_parse_record_values(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1465,7 +1539,7 @@ on_error:
  */
 int libewf_single_files_parse_perm_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libcerror_error_t **error )
 {
@@ -1506,7 +1580,7 @@ int libewf_single_files_parse_perm_category(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1540,7 +1614,7 @@ int libewf_single_files_parse_perm_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &number_of_permission_groups,
 	     error ) != 1 )
@@ -1556,7 +1630,7 @@ int libewf_single_files_parse_perm_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_types(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &types,
 	     error ) != 1 )
@@ -1572,7 +1646,7 @@ int libewf_single_files_parse_perm_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &copy_of_number_of_permission_groups,
 	     error ) != 1 )
@@ -1601,7 +1675,7 @@ int libewf_single_files_parse_perm_category(
 	/* Parse the category root entry
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1692,7 +1766,7 @@ int libewf_single_files_parse_perm_category(
 		if( libewf_single_files_parse_permission_group(
 		     single_files,
 		     types,
-		     lines,
+		     line_reader,
 		     &safe_line_index,
 		     permission_group,
 		     error ) != 1 )
@@ -1728,7 +1802,7 @@ int libewf_single_files_parse_perm_category(
 	/* The category should be followed by an empty line
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1804,7 +1878,7 @@ on_error:
 int libewf_single_files_parse_permission_group(
      libewf_single_files_t *single_files,
      libfvalue_split_utf8_string_t *types,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libewf_permission_group_t *permission_group,
      libcerror_error_t **error )
@@ -1843,7 +1917,7 @@ int libewf_single_files_parse_permission_group(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &number_of_permissions,
 	     error ) != 1 )
@@ -1861,7 +1935,7 @@ int libewf_single_files_parse_permission_group(
 	/* Parse the permission group entry
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -1937,7 +2011,7 @@ int libewf_single_files_parse_permission_group(
 	     permission_index++ )
 	{
 		if( libewf_single_files_parse_number_of_entries(
-		     lines,
+		     line_reader,
 		     &safe_line_index,
 		     &number_of_entries,
 		     error ) != 1 )
@@ -1966,7 +2040,7 @@ int libewf_single_files_parse_permission_group(
 		/* Parse the permission entry
 		 */
 		if( libewf_single_files_parse_line(
-		     lines,
+		     line_reader,
 		     safe_line_index,
 		     &line_string,
 		     &line_string_size,
@@ -2051,7 +2125,7 @@ on_error:
  */
 int libewf_single_files_parse_srce_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libcerror_error_t **error )
 {
@@ -2093,7 +2167,7 @@ int libewf_single_files_parse_srce_category(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -2127,7 +2201,7 @@ int libewf_single_files_parse_srce_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &number_of_sources,
 	     error ) != 1 )
@@ -2143,7 +2217,7 @@ int libewf_single_files_parse_srce_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_types(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &types,
 	     error ) != 1 )
@@ -2159,7 +2233,7 @@ int libewf_single_files_parse_srce_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &copy_of_number_of_sources,
 	     error ) != 1 )
@@ -2188,7 +2262,7 @@ int libewf_single_files_parse_srce_category(
 	/* Parse the category root entry
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -2259,7 +2333,7 @@ int libewf_single_files_parse_srce_category(
 	     source_index++ )
 	{
 		if( libewf_single_files_parse_number_of_entries(
-		     lines,
+		     line_reader,
 		     &safe_line_index,
 		     &number_of_entries,
 		     error ) != 1 )
@@ -2288,7 +2362,7 @@ int libewf_single_files_parse_srce_category(
 		/* Parse the source entry
 		 */
 		if( libewf_single_files_parse_line(
-		     lines,
+		     line_reader,
 		     safe_line_index,
 		     &line_string,
 		     &line_string_size,
@@ -2384,7 +2458,7 @@ int libewf_single_files_parse_srce_category(
 	/* The category should be followed by an empty line
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -2453,7 +2527,7 @@ on_error:
  */
 int libewf_single_files_parse_sub_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libcerror_error_t **error )
 {
@@ -2493,7 +2567,7 @@ int libewf_single_files_parse_sub_category(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -2526,7 +2600,7 @@ int libewf_single_files_parse_sub_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &number_of_subjects,
 	     error ) != 1 )
@@ -2542,7 +2616,7 @@ int libewf_single_files_parse_sub_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_types(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &types,
 	     error ) != 1 )
@@ -2558,7 +2632,7 @@ int libewf_single_files_parse_sub_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &copy_of_number_of_subjects,
 	     error ) != 1 )
@@ -2587,7 +2661,7 @@ int libewf_single_files_parse_sub_category(
 	/* Parse the category root entry
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -2654,7 +2728,7 @@ int libewf_single_files_parse_sub_category(
 	     subject_index++ )
 	{
 		if( libewf_single_files_parse_number_of_entries(
-		     lines,
+		     line_reader,
 		     &safe_line_index,
 		     &number_of_entries,
 		     error ) != 1 )
@@ -2683,7 +2757,7 @@ int libewf_single_files_parse_sub_category(
 		/* Parse the subject entry
 		 */
 		if( libewf_single_files_parse_line(
-		     lines,
+		     line_reader,
 		     safe_line_index,
 		     &line_string,
 		     &line_string_size,
@@ -2751,7 +2825,7 @@ int libewf_single_files_parse_sub_category(
 	/* The category should be followed by an empty line
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -2820,7 +2894,7 @@ on_error:
  */
 int libewf_single_files_parse_entry_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      uint8_t *format,
      libcerror_error_t **error )
@@ -2868,7 +2942,7 @@ int libewf_single_files_parse_entry_category(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -2903,7 +2977,7 @@ int libewf_single_files_parse_entry_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_number_of_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &number_of_sub_entries,
 	     error ) != 1 )
@@ -2919,7 +2993,7 @@ int libewf_single_files_parse_entry_category(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_category_types(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &types,
 	     error ) != 1 )
@@ -2964,8 +3038,9 @@ int libewf_single_files_parse_entry_category(
 	if( libewf_single_files_parse_file_entry(
 	     single_files->file_entry_tree_root_node,
 	     types,
-	     lines,
+	     line_reader,
 	     &safe_line_index,
+	     single_files->string_pool,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2980,7 +3055,7 @@ int libewf_single_files_parse_entry_category(
 	/* The category should be followed by an empty line
 	 */
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -3051,8 +3126,9 @@ on_error:
 int libewf_single_files_parse_file_entry(
      libcdata_tree_node_t *parent_file_entry_node,
      libfvalue_split_utf8_string_t *types,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
+     libewf_string_pool_t *string_pool,
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *file_entry_node   = NULL;
@@ -3091,7 +3167,7 @@ int libewf_single_files_parse_file_entry(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_file_entry_number_of_sub_entries(
-	     lines,
+	     line_reader,
 	     &safe_line_index,
 	     &number_of_sub_entries,
 	     error ) != 1 )
@@ -3106,7 +3182,7 @@ int libewf_single_files_parse_file_entry(
 		goto on_error;
 	}
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -3142,6 +3218,7 @@ int libewf_single_files_parse_file_entry(
 	     types,
 	     line_string,
 	     line_string_size,
+	     string_pool,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3169,8 +3246,8 @@ int libewf_single_files_parse_file_entry(
 	}
 	lef_file_entry = NULL;
 
-	if( libfvalue_split_utf8_string_get_number_of_segments(
-	     lines,
+	if( libewf_line_reader_get_number_of_lines(
+	     line_reader,
 	     &number_of_lines,
 	     error ) != 1 )
 	{
@@ -3216,8 +3293,9 @@ int libewf_single_files_parse_file_entry(
 		if( libewf_single_files_parse_file_entry(
 		     file_entry_node,
 		     types,
-		     lines,
+		     line_reader,
 		     &safe_line_index,
+		     string_pool,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -3247,6 +3325,22 @@ int libewf_single_files_parse_file_entry(
 		}
 		file_entry_node = NULL;
 	}
+	/* Index the sub file entries by name so that the lookup of a sub file entry
+	 * does not require to scan all the sub file entries of a large directory
+	 */
+	if( libewf_single_file_tree_create_index(
+	     parent_file_entry_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub file entries index.",
+		 function );
+
+		goto on_error;
+	}
 	*line_index = safe_line_index;
 
 	return( 1 );
@@ -3278,7 +3372,7 @@ on_error:
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_parse_file_entry_number_of_sub_entries(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      int *number_of_sub_entries,
      libcerror_error_t **error )
@@ -3318,7 +3412,7 @@ int libewf_single_files_parse_file_entry_number_of_sub_entries(
 	safe_line_index = *line_index;
 
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     safe_line_index,
 	     &line_string,
 	     &line_string_size,
@@ -3521,22 +3615,20 @@ on_error:
 	return( -1 );
 }
 
-/* Parses an UTF-8 encoded single files string
+/* Parses the lines of a single files string
  * Returns 1 if successful or -1 on error
  */
-int libewf_single_files_parse_utf8_string(
+int libewf_single_files_parse_lines(
      libewf_single_files_t *single_files,
-     const uint8_t *utf8_string,
-     size_t utf8_string_size,
+     libewf_line_reader_t *line_reader,
      size64_t *media_size,
      uint8_t *format,
      libcerror_error_t **error )
 {
-	libfvalue_split_utf8_string_t *lines = NULL;
-	uint8_t *line_string                 = NULL;
-	static char *function                = "libewf_single_files_parse_utf8_string";
-	size_t line_string_size              = 0;
-	int line_index                       = 0;
+	uint8_t *line_string    = NULL;
+	static char *function   = "libewf_single_files_parse_lines";
+	size_t line_string_size = 0;
+	int line_index          = 0;
 
 	if( single_files == NULL )
 	{
@@ -3549,24 +3641,8 @@ int libewf_single_files_parse_utf8_string(
 
 		return( -1 );
 	}
-	if( libfvalue_utf8_string_split(
-	     utf8_string,
-	     utf8_string_size,
-	     (uint8_t) '\n',
-	     &lines,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split string into lines.",
-		 function );
-
-		goto on_error;
-	}
 	if( libewf_single_files_parse_line(
-	     lines,
+	     line_reader,
 	     line_index,
 	     &line_string,
 	     &line_string_size,
@@ -3580,7 +3656,7 @@ int libewf_single_files_parse_utf8_string(
 		 function,
 		 line_index );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( ( line_string_size != 2 )
 	 || ( line_string[ 0 ] != (uint8_t) '5' ) )
@@ -3592,13 +3668,13 @@ int libewf_single_files_parse_utf8_string(
 		 "%s: unsupported number of categories string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	line_index += 1;
 
 	if( libewf_single_files_parse_rec_category(
 	     single_files,
-	     lines,
+	     line_reader,
 	     &line_index,
 	     media_size,
 	     error ) != 1 )
@@ -3610,11 +3686,11 @@ int libewf_single_files_parse_utf8_string(
 		 "%s: unable to parse rec category.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libewf_single_files_parse_perm_category(
 	     single_files,
-	     lines,
+	     line_reader,
 	     &line_index,
 	     error ) != 1 )
 	{
@@ -3625,11 +3701,11 @@ int libewf_single_files_parse_utf8_string(
 		 "%s: unable to parse perm category.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libewf_single_files_parse_srce_category(
 	     single_files,
-	     lines,
+	     line_reader,
 	     &line_index,
 	     error ) != 1 )
 	{
@@ -3640,11 +3716,11 @@ int libewf_single_files_parse_utf8_string(
 		 "%s: unable to parse srce category.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libewf_single_files_parse_sub_category(
 	     single_files,
-	     lines,
+	     line_reader,
 	     &line_index,
 	     error ) != 1 )
 	{
@@ -3655,11 +3731,11 @@ int libewf_single_files_parse_utf8_string(
 		 "%s: unable to parse sub category.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libewf_single_files_parse_entry_category(
 	     single_files,
-	     lines,
+	     line_reader,
 	     &line_index,
 	     format,
 	     error ) != 1 )
@@ -3671,17 +3747,77 @@ int libewf_single_files_parse_utf8_string(
 		 "%s: unable to parse entry category.",
 		 function );
 
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded single files string
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_parse_utf8_string(
+     libewf_single_files_t *single_files,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size64_t *media_size,
+     uint8_t *format,
+     libcerror_error_t **error )
+{
+	libewf_line_reader_t *line_reader = NULL;
+	static char *function             = "libewf_single_files_parse_utf8_string";
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_line_reader_initialize(
+	     &line_reader,
+	     utf8_string,
+	     utf8_string_size,
+	     LIBEWF_LINE_READER_ENCODING_UTF8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create line reader.",
+		 function );
+
 		goto on_error;
 	}
-	if( libfvalue_split_utf8_string_free(
-	     &lines,
+	if( libewf_single_files_parse_lines(
+	     single_files,
+	     line_reader,
+	     media_size,
+	     format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to parse lines.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_line_reader_free(
+	     &line_reader,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split lines.",
+		 "%s: unable to free line reader.",
 		 function );
 
 		goto on_error;
@@ -3689,16 +3825,18 @@ int libewf_single_files_parse_utf8_string(
 	return( 1 );
 
 on_error:
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( -1 );
 }
 
 /* Reads the single files
+ * The UTF-16 little-endian encoded data is parsed line by line, without
+ * converting it into an UTF-8 encoded string first
  * Returns 1 if successful or -1 on error
  */
 int libewf_single_files_read_data(
@@ -3709,9 +3847,8 @@ int libewf_single_files_read_data(
      uint8_t *format,
      libcerror_error_t **error )
 {
-	uint8_t *utf8_string    = NULL;
-	static char *function   = "libewf_single_files_read_data";
-	size_t utf8_string_size = 0;
+	libewf_line_reader_t *line_reader = NULL;
+	static char *function             = "libewf_single_files_read_data";
 
 	if( single_files == NULL )
 	{
@@ -3724,92 +3861,59 @@ int libewf_single_files_read_data(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libewf_line_reader_initialize(
+	     &line_reader,
 	     data,
 	     data_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     &utf8_string_size,
+	     LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
 	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine UTF-8 string size.",
-		 function );
-
-		goto on_error;
-	}
-	if( ( utf8_string_size == 0 )
-	 || ( utf8_string_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-8 string size value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-	utf8_string = (uint8_t *) memory_allocate(
-	                           sizeof( uint8_t ) * (size_t) utf8_string_size );
-
-	if( utf8_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create line reader.",
 		 function );
 
 		goto on_error;
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     utf8_string,
-	     utf8_string_size,
-	     data,
-	     data_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	if( libewf_single_files_parse_lines(
+	     single_files,
+	     line_reader,
+	     media_size,
+	     format,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
 		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set UTF-8 string.",
+		 "%s: unable to parse lines.",
 		 function );
 
 		goto on_error;
 	}
-	if( libewf_single_files_parse_utf8_string(
-	     single_files,
-	     utf8_string,
-	     utf8_string_size,
-	     media_size,
-	     format,
+	if( libewf_line_reader_free(
+	     &line_reader,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to parse UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free line reader.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 utf8_string );
-
 	return( 1 );
 
 on_error:
-	if( utf8_string != NULL )
+	if( line_reader != NULL )
 	{
-		memory_free(
-		 utf8_string );
+		libewf_line_reader_free(
+		 &line_reader,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -3933,3 +4037,240 @@ int libewf_single_files_get_source_by_index(
 	return( 1 );
 }
 
+/* Creates the file entry tree file nodes sorted by data offset
+ * Files of a logical evidence file are stored in media order, reading them in this order
+ * prevents random seeks and chunk cache thrashing compared to reading them in tree order
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_create_media_order_file_nodes(
+     libewf_single_files_t *single_files,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t **file_nodes = NULL;
+	static char *function             = "libewf_single_files_create_media_order_file_nodes";
+	int file_node_index               = 0;
+	int number_of_file_nodes          = 0;
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( single_files->media_order_file_nodes_created != 0 )
+	{
+		return( 1 );
+	}
+	if( single_files->file_entry_tree_root_node != NULL )
+	{
+		if( libewf_single_file_tree_get_number_of_file_nodes(
+		     single_files->file_entry_tree_root_node,
+		     &number_of_file_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of file nodes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_file_nodes > 0 )
+	{
+		if( (size_t) number_of_file_nodes > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcdata_tree_node_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of file nodes value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		file_nodes = (libcdata_tree_node_t **) memory_allocate(
+		                                        sizeof( libcdata_tree_node_t * ) * number_of_file_nodes );
+
+		if( file_nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file nodes.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_single_file_tree_get_file_nodes(
+		     single_files->file_entry_tree_root_node,
+		     file_nodes,
+		     number_of_file_nodes,
+		     &file_node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file nodes.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_node_index != number_of_file_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: mismatch in number of file nodes.",
+			 function );
+
+			goto on_error;
+		}
+		qsort(
+		 file_nodes,
+		 (size_t) number_of_file_nodes,
+		 sizeof( libcdata_tree_node_t * ),
+		 &libewf_single_file_tree_compare_file_nodes_by_data_offset );
+	}
+	single_files->media_order_file_nodes           = file_nodes;
+	single_files->number_of_media_order_file_nodes = number_of_file_nodes;
+	single_files->media_order_file_nodes_created   = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_nodes != NULL )
+	{
+		memory_free(
+		 file_nodes );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of file entry tree file nodes in media order
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_get_number_of_media_order_file_nodes(
+     libewf_single_files_t *single_files,
+     int *number_of_file_nodes,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_single_files_get_number_of_media_order_file_nodes";
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_files_create_media_order_file_nodes(
+	     single_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create media order file nodes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_file_nodes = single_files->number_of_media_order_file_nodes;
+
+	return( 1 );
+}
+
+/* Retrieves a specific file entry tree file node in media order
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_single_files_get_media_order_file_node_by_index(
+     libewf_single_files_t *single_files,
+     int file_node_index,
+     libcdata_tree_node_t **file_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_single_files_get_media_order_file_node_by_index";
+
+	if( single_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid single files.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_single_files_create_media_order_file_nodes(
+	     single_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create media order file nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_node_index < 0 )
+	 || ( file_node_index >= single_files->number_of_media_order_file_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_node = single_files->media_order_file_nodes[ file_node_index ];
+
+	return( 1 );
+}
+
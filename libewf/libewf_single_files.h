@@ -31,7 +31,9 @@
 #include "libewf_libcdata.h"
 #include "libewf_libcerror.h"
 #include "libewf_libfvalue.h"
+#include "libewf_line_reader.h"
 #include "libewf_permission_group.h"
+#include "libewf_string_pool.h"
 #include "libewf_types.h"
 
 #if defined( __cplusplus )
@@ -53,6 +55,22 @@ struct libewf_single_files
 	/* The file entry tree root node
 	 */
 	libcdata_tree_node_t *file_entry_tree_root_node;
+
+	/* The string pool, contains the file entry names
+	 */
+	libewf_string_pool_t *string_pool;
+
+	/* The file entry tree file nodes sorted by data offset, created on demand
+	 */
+	libcdata_tree_node_t **media_order_file_nodes;
+
+	/* The number of media order file nodes
+	 */
+	int number_of_media_order_file_nodes;
+
+	/* Value to indicate the media order file nodes were created
+	 */
+	uint8_t media_order_file_nodes_created;
 };
 
 int libewf_single_files_initialize(
@@ -69,26 +87,26 @@ int libewf_single_files_clone(
      libcerror_error_t **error );
 
 int libewf_single_files_parse_line(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int line_index,
      uint8_t **line_string,
      size_t *line_string_size,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_category_number_of_entries(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      int *number_of_entries,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_category_types(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libfvalue_split_utf8_string_t **types,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_number_of_entries(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      int *number_of_entries,
      libcerror_error_t **error );
@@ -100,46 +118,46 @@ int libewf_single_files_parse_format(
 
 int libewf_single_files_parse_rec_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      size64_t *media_size,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_record_values(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      size64_t *media_size,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_perm_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_permission_group(
      libewf_single_files_t *single_files,
      libfvalue_split_utf8_string_t *types,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libewf_permission_group_t *permission_group,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_srce_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_sub_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_entry_category(
      libewf_single_files_t *single_files,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      uint8_t *format,
      libcerror_error_t **error );
@@ -147,16 +165,24 @@ int libewf_single_files_parse_entry_category(
 int libewf_single_files_parse_file_entry(
      libcdata_tree_node_t *parent_file_entry_node,
      libfvalue_split_utf8_string_t *types,
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
+     libewf_string_pool_t *string_pool,
      libcerror_error_t **error );
 
 int libewf_single_files_parse_file_entry_number_of_sub_entries(
-     libfvalue_split_utf8_string_t *lines,
+     libewf_line_reader_t *line_reader,
      int *line_index,
      int *number_of_sub_entries,
      libcerror_error_t **error );
 
+int libewf_single_files_parse_lines(
+     libewf_single_files_t *single_files,
+     libewf_line_reader_t *line_reader,
+     size64_t *media_size,
+     uint8_t *format,
+     libcerror_error_t **error );
+
 int libewf_single_files_parse_utf8_string(
      libewf_single_files_t *single_files,
      const uint8_t *utf8_string,
@@ -190,6 +216,21 @@ int libewf_single_files_get_source_by_index(
      libewf_lef_source_t **lef_source,
      libcerror_error_t **error );
 
+int libewf_single_files_create_media_order_file_nodes(
+     libewf_single_files_t *single_files,
+     libcerror_error_t **error );
+
+int libewf_single_files_get_number_of_media_order_file_nodes(
+     libewf_single_files_t *single_files,
+     int *number_of_file_nodes,
+     libcerror_error_t **error );
+
+int libewf_single_files_get_media_order_file_node_by_index(
+     libewf_single_files_t *single_files,
+     int file_node_index,
+     libcdata_tree_node_t **file_node,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
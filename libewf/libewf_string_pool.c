@@ -0,0 +1,423 @@
+/*
+ * String pool functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_string_pool.h"
+
+/* The initial allocated number of blocks
+ */
+#define LIBEWF_STRING_POOL_INITIAL_NUMBER_OF_BLOCKS	16
+
+/* Creates a string pool
+ * Make sure the value string_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_string_pool_initialize(
+     libewf_string_pool_t **string_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_string_pool_initialize";
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_pool = memory_allocate_structure(
+	                libewf_string_pool_t );
+
+	if( *string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_pool,
+	     0,
+	     sizeof( libewf_string_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *string_pool != NULL )
+	{
+		memory_free(
+		 *string_pool );
+
+		*string_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string pool
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_string_pool_free(
+     libewf_string_pool_t **string_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_string_pool_free";
+	int block_index       = 0;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_pool != NULL )
+	{
+		if( ( *string_pool )->blocks != NULL )
+		{
+			for( block_index = 0;
+			     block_index < ( *string_pool )->number_of_blocks;
+			     block_index++ )
+			{
+				memory_free(
+				 ( *string_pool )->blocks[ block_index ] );
+			}
+			memory_free(
+			 ( *string_pool )->blocks );
+		}
+		memory_free(
+		 *string_pool );
+
+		*string_pool = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a block to the string pool
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_string_pool_append_block(
+     libewf_string_pool_t *string_pool,
+     size_t block_size,
+     uint8_t **block,
+     libcerror_error_t **error )
+{
+	void *reallocation             = NULL;
+	uint8_t *safe_block            = NULL;
+	static char *function          = "libewf_string_pool_append_block";
+	int allocated_number_of_blocks = 0;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_pool->number_of_blocks >= string_pool->allocated_number_of_blocks )
+	{
+		if( string_pool->allocated_number_of_blocks == 0 )
+		{
+			allocated_number_of_blocks = LIBEWF_STRING_POOL_INITIAL_NUMBER_OF_BLOCKS;
+		}
+		else
+		{
+			if( string_pool->allocated_number_of_blocks > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of blocks value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			allocated_number_of_blocks = string_pool->allocated_number_of_blocks * 2;
+		}
+		if( ( sizeof( uint8_t * ) * allocated_number_of_blocks ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid blocks size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                string_pool->blocks,
+		                sizeof( uint8_t * ) * allocated_number_of_blocks );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize blocks.",
+			 function );
+
+			return( -1 );
+		}
+		string_pool->blocks                     = (uint8_t **) reallocation;
+		string_pool->allocated_number_of_blocks = allocated_number_of_blocks;
+	}
+	safe_block = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * block_size );
+
+	if( safe_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block.",
+		 function );
+
+		return( -1 );
+	}
+	string_pool->blocks[ string_pool->number_of_blocks ] = safe_block;
+
+	string_pool->number_of_blocks += 1;
+
+	*block = safe_block;
+
+	return( 1 );
+}
+
+/* Appends a string to the string pool
+ * The string is stored with an end of string character, a trailing end of string character in the data is ignored
+ * The string remains valid until the string pool is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_string_pool_append_string(
+     libewf_string_pool_t *string_pool,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *block        = NULL;
+	uint8_t *safe_string  = NULL;
+	static char *function = "libewf_string_pool_append_string";
+	size_t safe_size      = 0;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size >= 1 )
+	 && ( data[ data_size - 1 ] == 0 ) )
+	{
+		data_size -= 1;
+	}
+	safe_size = data_size + 1;
+
+	if( safe_size > ( LIBEWF_STRING_POOL_BLOCK_SIZE / 4 ) )
+	{
+		/* Large strings are stored in a block of their own
+		 * so that the remainder of the current block is not wasted
+		 */
+		if( libewf_string_pool_append_block(
+		     string_pool,
+		     safe_size,
+		     &safe_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( ( string_pool->current_block == NULL )
+		 || ( safe_size > ( string_pool->block_data_size - string_pool->block_data_offset ) ) )
+		{
+			if( libewf_string_pool_append_block(
+			     string_pool,
+			     LIBEWF_STRING_POOL_BLOCK_SIZE,
+			     &block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append block.",
+				 function );
+
+				return( -1 );
+			}
+			string_pool->current_block     = block;
+			string_pool->block_data_offset = 0;
+			string_pool->block_data_size   = LIBEWF_STRING_POOL_BLOCK_SIZE;
+		}
+		safe_string = &( string_pool->current_block[ string_pool->block_data_offset ] );
+
+		string_pool->block_data_offset += safe_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     safe_string,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_string[ data_size ] = 0;
+
+	*string      = safe_string;
+	*string_size = safe_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,95 @@
+/*
+ * String pool functions
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_STRING_POOL_H )
+#define _LIBEWF_STRING_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a string pool block
+ * strings larger than a quarter of the block size are stored in a block of their own
+ */
+#define LIBEWF_STRING_POOL_BLOCK_SIZE	65536
+
+typedef struct libewf_string_pool libewf_string_pool_t;
+
+struct libewf_string_pool
+{
+	/* The blocks
+	 */
+	uint8_t **blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The allocated number of blocks
+	 */
+	int allocated_number_of_blocks;
+
+	/* The current block, in which strings are appended
+	 */
+	uint8_t *current_block;
+
+	/* The data offset in the current block
+	 */
+	size_t block_data_offset;
+
+	/* The data size of the current block
+	 */
+	size_t block_data_size;
+};
+
+int libewf_string_pool_initialize(
+     libewf_string_pool_t **string_pool,
+     libcerror_error_t **error );
+
+int libewf_string_pool_free(
+     libewf_string_pool_t **string_pool,
+     libcerror_error_t **error );
+
+int libewf_string_pool_append_block(
+     libewf_string_pool_t *string_pool,
+     size_t block_size,
+     uint8_t **block,
+     libcerror_error_t **error );
+
+int libewf_string_pool_append_string(
+     libewf_string_pool_t *string_pool,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_STRING_POOL_H ) */
+
@@ -31,6 +31,7 @@
 
 #include "pyewf.h"
 #include "pyewf_compression_methods.h"
+#include "pyewf_data_chunks.h"
 #include "pyewf_error.h"
 #include "pyewf_file_entries.h"
 #include "pyewf_file_entry.h"
@@ -1012,6 +1013,23 @@ PyMODINIT_FUNC initpyewf(
 	 "compression_methods",
 	 (PyObject *) &pyewf_compression_methods_type_object );
 
+	/* Setup the data chunks type object
+	 */
+	pyewf_data_chunks_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyewf_data_chunks_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyewf_data_chunks_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "data_chunks",
+	 (PyObject *) &pyewf_data_chunks_type_object );
+
 	/* Setup the file entries type object
 	 */
 	pyewf_file_entries_type_object.tp_new = PyType_GenericNew;
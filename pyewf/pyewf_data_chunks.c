@@ -0,0 +1,532 @@
+/*
+ * Python object definition of the iterator object of media data chunks
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyewf_data_chunks.h"
+#include "pyewf_error.h"
+#include "pyewf_handle.h"
+#include "pyewf_integer.h"
+#include "pyewf_libcerror.h"
+#include "pyewf_libewf.h"
+#include "pyewf_python.h"
+
+PyTypeObject pyewf_data_chunks_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyewf.data_chunks",
+	/* tp_basicsize */
+	sizeof( pyewf_data_chunks_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyewf_data_chunks_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyewf iterator object of media data chunks",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyewf_data_chunks_iter,
+	/* tp_iternext */
+	(iternextfunc) pyewf_data_chunks_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyewf_data_chunks_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new data chunks iterator object
+ * The iterator starts at the offset and continues at chunk boundaries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyewf_data_chunks_new(
+           pyewf_handle_t *handle_object,
+           off64_t offset )
+{
+	libcerror_error_t *error             = NULL;
+	pyewf_data_chunks_t *iterator_object = NULL;
+	static char *function                = "pyewf_data_chunks_new";
+	size64_t media_size                  = 0;
+	size32_t chunk_size                  = 0;
+	int result                           = 0;
+
+	if( handle_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle object.",
+		 function );
+
+		return( NULL );
+	}
+	if( offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libewf_handle_get_chunk_size(
+	          handle_object->handle,
+	          &chunk_size,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libewf_handle_get_media_size(
+		          handle_object->handle,
+		          &media_size,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve chunk and media size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( ( chunk_size == 0 )
+	 || ( (size_t) chunk_size > (size_t) PY_SSIZE_T_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the data chunks values are initialized
+	 */
+	iterator_object = PyObject_New(
+	                   struct pyewf_data_chunks,
+	                   &pyewf_data_chunks_type_object );
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create iterator object.",
+		 function );
+
+		goto on_error;
+	}
+	iterator_object->handle_object  = handle_object;
+	iterator_object->buffer_object  = NULL;
+	iterator_object->current_offset = offset;
+	iterator_object->media_size     = media_size;
+	iterator_object->chunk_size     = chunk_size;
+
+	Py_IncRef(
+	 (PyObject *) iterator_object->handle_object );
+
+	iterator_object->buffer_object = PyByteArray_FromStringAndSize(
+	                                  NULL,
+	                                  (Py_ssize_t) chunk_size );
+
+	if( iterator_object->buffer_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create buffer object.",
+		 function );
+
+		goto on_error;
+	}
+	return( (PyObject *) iterator_object );
+
+on_error:
+	if( iterator_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) iterator_object );
+	}
+	return( NULL );
+}
+
+/* Intializes a data chunks iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyewf_data_chunks_init(
+     pyewf_data_chunks_t *iterator_object )
+{
+	static char *function = "pyewf_data_chunks_init";
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the data chunks values are initialized
+	 */
+	iterator_object->handle_object  = NULL;
+	iterator_object->buffer_object  = NULL;
+	iterator_object->current_offset = 0;
+	iterator_object->media_size     = 0;
+	iterator_object->chunk_size     = 0;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of data chunks not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a data chunks iterator object
+ */
+void pyewf_data_chunks_free(
+      pyewf_data_chunks_t *iterator_object )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyewf_data_chunks_free";
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           iterator_object );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( iterator_object->buffer_object != NULL )
+	{
+		Py_DecRef(
+		 iterator_object->buffer_object );
+	}
+	if( iterator_object->handle_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) iterator_object->handle_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) iterator_object );
+}
+
+/* The data chunks iter() function
+ */
+PyObject *pyewf_data_chunks_iter(
+           pyewf_data_chunks_t *iterator_object )
+{
+	static char *function = "pyewf_data_chunks_iter";
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) iterator_object );
+
+	return( (PyObject *) iterator_object );
+}
+
+/* The data chunks iternext() function
+ * Returns a tuple of the offset and a memoryview of the chunk data
+ * The memoryview refers to a buffer that is reused by the next iteration
+ */
+PyObject *pyewf_data_chunks_iternext(
+           pyewf_data_chunks_t *iterator_object )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *integer_object = NULL;
+	PyObject *memory_object  = NULL;
+	PyObject *slice_object   = NULL;
+	PyObject *tuple_object   = NULL;
+	static char *function    = "pyewf_data_chunks_iternext";
+	char *buffer             = NULL;
+	size64_t remaining_size  = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( NULL );
+	}
+	if( iterator_object->handle_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - missing handle object.",
+		 function );
+
+		return( NULL );
+	}
+	if( iterator_object->buffer_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - missing buffer object.",
+		 function );
+
+		return( NULL );
+	}
+	if( iterator_object->current_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - invalid current offset.",
+		 function );
+
+		return( NULL );
+	}
+	if( (size64_t) iterator_object->current_offset >= iterator_object->media_size )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	/* Read up to the next chunk boundary
+	 */
+	read_size = (size_t) iterator_object->chunk_size
+	          - (size_t) ( iterator_object->current_offset % iterator_object->chunk_size );
+
+	remaining_size = iterator_object->media_size - (size64_t) iterator_object->current_offset;
+
+	if( (size64_t) read_size > remaining_size )
+	{
+		read_size = (size_t) remaining_size;
+	}
+	buffer = PyByteArray_AsString(
+	          iterator_object->buffer_object );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libewf_handle_read_buffer_at_offset(
+	              iterator_object->handle_object->handle,
+	              (uint8_t *) buffer,
+	              read_size,
+	              iterator_object->current_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count <= -1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( read_count == 0 )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	integer_object = pyewf_integer_signed_new_from_64bit(
+	                  (int64_t) iterator_object->current_offset );
+
+	if( integer_object == NULL )
+	{
+		goto on_error;
+	}
+	memory_object = PyMemoryView_FromObject(
+	                 iterator_object->buffer_object );
+
+	if( memory_object == NULL )
+	{
+		goto on_error;
+	}
+	if( (size_t) read_count < (size_t) iterator_object->chunk_size )
+	{
+		slice_object = PySequence_GetSlice(
+		                memory_object,
+		                0,
+		                (Py_ssize_t) read_count );
+
+		if( slice_object == NULL )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 memory_object );
+
+		memory_object = slice_object;
+		slice_object  = NULL;
+	}
+	tuple_object = PyTuple_New(
+	                2 );
+
+	if( tuple_object == NULL )
+	{
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals the references
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 integer_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 memory_object );
+
+	iterator_object->current_offset += (off64_t) read_count;
+
+	return( tuple_object );
+
+on_error:
+	if( memory_object != NULL )
+	{
+		Py_DecRef(
+		 memory_object );
+	}
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	return( NULL );
+}
+
@@ -0,0 +1,89 @@
+/*
+ * Python object definition of the iterator object of media data chunks
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYEWF_DATA_CHUNKS_H )
+#define _PYEWF_DATA_CHUNKS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyewf_handle.h"
+#include "pyewf_libewf.h"
+#include "pyewf_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyewf_data_chunks pyewf_data_chunks_t;
+
+struct pyewf_data_chunks
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The pyewf handle object
+	 */
+	pyewf_handle_t *handle_object;
+
+	/* The buffer object
+	 * The buffer is reused for every chunk
+	 */
+	PyObject *buffer_object;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The chunk size
+	 */
+	size32_t chunk_size;
+};
+
+extern PyTypeObject pyewf_data_chunks_type_object;
+
+PyObject *pyewf_data_chunks_new(
+           pyewf_handle_t *handle_object,
+           off64_t offset );
+
+int pyewf_data_chunks_init(
+     pyewf_data_chunks_t *iterator_object );
+
+void pyewf_data_chunks_free(
+      pyewf_data_chunks_t *iterator_object );
+
+PyObject *pyewf_data_chunks_iter(
+           pyewf_data_chunks_t *iterator_object );
+
+PyObject *pyewf_data_chunks_iternext(
+           pyewf_data_chunks_t *iterator_object );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYEWF_DATA_CHUNKS_H ) */
+
@@ -54,6 +54,20 @@ PyMethodDef pyewf_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of file entry data at a specific offset." },
 
+	{ "read_buffer_into",
+	  (PyCFunction) pyewf_file_entry_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_into(buffer) -> Integer\n"
+	  "\n"
+	  "Reads file entry data into a writable buffer, such as a bytearray or memoryview." },
+
+	{ "read_buffer_at_offset_into",
+	  (PyCFunction) pyewf_file_entry_read_buffer_at_offset_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_into(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads file entry data at a specific offset into a writable buffer, such as a bytearray or memoryview." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyewf_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -77,6 +91,13 @@ PyMethodDef pyewf_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of file entry data." },
 
+	{ "readinto",
+	  (PyCFunction) pyewf_file_entry_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads file entry data into a writable buffer, such as a bytearray or memoryview." },
+
 	{ "seek",
 	  (PyCFunction) pyewf_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -780,6 +801,175 @@ PyObject *pyewf_file_entry_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads file entry data into a buffer
+ * The buffer can be any writable object that supports the buffer protocol,
+ * such as a bytearray or memoryview, the data is read without intermediate copies
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyewf_file_entry_read_buffer_into(
+           pyewf_file_entry_t *pyewf_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyewf_file_entry_read_buffer_into";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyewf_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf file_entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyewf_file_entry->file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf file_entry - missing libewf file_entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libewf_file_entry_read_buffer(
+	              pyewf_file_entry->file_entry,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyewf_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
+/* Reads file entry data at a specific offset into a buffer
+ * The buffer can be any writable object that supports the buffer protocol,
+ * such as a bytearray or memoryview, the data is read without intermediate copies
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyewf_file_entry_read_buffer_at_offset_into(
+           pyewf_file_entry_t *pyewf_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyewf_file_entry_read_buffer_at_offset_into";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	off64_t read_offset         = 0;
+	ssize_t read_count          = 0;
+
+	if( pyewf_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf file_entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyewf_file_entry->file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf file_entry - missing libewf file_entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*L",
+	     keyword_list,
+	     &buffer,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read offset value less than zero.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libewf_file_entry_read_buffer_at_offset(
+	              pyewf_file_entry->file_entry,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              (off64_t) read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyewf_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
 /* Seeks a certain offset in the file entry data
  * Returns a Python object holding the offset if successful or NULL on error
  */
@@ -73,6 +73,16 @@ PyObject *pyewf_file_entry_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyewf_file_entry_read_buffer_into(
+           pyewf_file_entry_t *pyewf_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyewf_file_entry_read_buffer_at_offset_into(
+           pyewf_file_entry_t *pyewf_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyewf_file_entry_seek_offset(
            pyewf_file_entry_t *pyewf_file_entry,
            PyObject *arguments,
@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #endif
 
+#include "pyewf_data_chunks.h"
 #include "pyewf_error.h"
 #include "pyewf_file_entry.h"
 #include "pyewf_file_objects_io_pool.h"
@@ -86,6 +87,13 @@ PyMethodDef pyewf_handle_object_methods[] = {
 	  "\n"
 	  "Closes a handle." },
 
+	{ "clone",
+	  (PyCFunction) pyewf_handle_clone,
+	  METH_NOARGS,
+	  "clone() -> Object\n"
+	  "\n"
+	  "Clones a handle. The clone shares the metadata of the handle but has its own file IO pool and chunk cache. Use a clone per thread to read concurrently." },
+
 	{ "read_buffer",
 	  (PyCFunction) pyewf_handle_read_buffer,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -98,7 +106,37 @@ PyMethodDef pyewf_handle_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "read_buffer_at_offset(size, offset) -> String\n"
 	  "\n"
-	  "Reads a buffer of media data at a specific offset." },
+	  "Reads a buffer of media data at a specific offset. The seek and read are done as a single operation so it is safe to call from multiple threads." },
+
+	{ "read_buffer_into",
+	  (PyCFunction) pyewf_handle_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_into(buffer) -> Integer\n"
+	  "\n"
+	  "Reads media data into a writable buffer, such as a bytearray or memoryview." },
+
+	{ "read_buffer_at_offset_into",
+	  (PyCFunction) pyewf_handle_read_buffer_at_offset_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_into(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads media data at a specific offset into a writable buffer, such as a bytearray or memoryview." },
+
+	{ "read_buffers_at_offsets",
+	  (PyCFunction) pyewf_handle_read_buffers_at_offsets,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffers_at_offsets(ranges) -> List\n"
+	  "\n"
+	  "Reads multiple buffers of media data, where ranges is a list of (offset, size) tuples.\n"
+	  "The list contains None for a range that could not be read." },
+
+	{ "iter_chunks",
+	  (PyCFunction) pyewf_handle_iter_chunks,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_chunks(offset) -> Object\n"
+	  "\n"
+	  "Retrieves an iterator of (offset, memoryview) tuples over the media data in chunks.\n"
+	  "The memoryview refers to a buffer that is reused by the next iteration." },
 
 	{ "write_buffer",
 	  (PyCFunction) pyewf_handle_write_buffer,
@@ -137,6 +175,13 @@ PyMethodDef pyewf_handle_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of media data." },
 
+	{ "readinto",
+	  (PyCFunction) pyewf_handle_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads media data into a writable buffer, such as a bytearray or memoryview." },
+
 	{ "write",
 	  (PyCFunction) pyewf_handle_write_buffer,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -1261,6 +1306,95 @@ PyObject *pyewf_handle_close(
 	return( Py_None );
 }
 
+/* Clones the handle
+ * The clone shares the metadata of the handle but has its own file IO pool
+ * and chunk cache, so the handle and its clones can be read concurrently
+ * from different threads without contending for the same lock
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyewf_handle_clone(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments PYEWF_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error           = NULL;
+	libewf_handle_t *handle            = NULL;
+	pyewf_handle_t *pyewf_handle_clone = NULL;
+	static char *function              = "pyewf_handle_clone";
+	int result                         = 0;
+
+	PYEWF_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyewf_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	/* The file objects cannot be shared safely between threads
+	 * since they are accessed using separate seek and read calls
+	 */
+	if( pyewf_handle->file_io_pool != NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to clone handle opened with file objects.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libewf_handle_clone(
+	          &handle,
+	          pyewf_handle->handle,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to clone handle.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	pyewf_handle_clone = PyObject_New(
+	                      struct pyewf_handle,
+	                      &pyewf_handle_type_object );
+
+	if( pyewf_handle_clone == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	pyewf_handle_clone->handle       = handle;
+	pyewf_handle_clone->file_io_pool = NULL;
+
+	return( (PyObject *) pyewf_handle_clone );
+
+on_error:
+	if( handle != NULL )
+	{
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( NULL );
+}
+
 /* Reads a buffer of media data
  * Returns a Python object holding the data if successful or NULL on error
  */
@@ -1503,6 +1637,520 @@ PyObject *pyewf_handle_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads media data into a buffer
+ * The buffer can be any writable object that supports the buffer protocol,
+ * such as a bytearray or memoryview, the data is read without intermediate copies
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyewf_handle_read_buffer_into(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyewf_handle_read_buffer_into";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyewf_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libewf_handle_read_buffer(
+	              pyewf_handle->handle,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyewf_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
+/* Reads media data at a specific offset into a buffer
+ * The buffer can be any writable object that supports the buffer protocol,
+ * such as a bytearray or memoryview, the data is read without intermediate copies
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyewf_handle_read_buffer_at_offset_into(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyewf_handle_read_buffer_at_offset_into";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	off64_t read_offset         = 0;
+	ssize_t read_count          = 0;
+
+	if( pyewf_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*L",
+	     keyword_list,
+	     &buffer,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read offset value less than zero.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libewf_handle_read_buffer_at_offset(
+	              pyewf_handle->handle,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              (off64_t) read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyewf_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
+/* Reads multiple buffers of media data at specific offsets
+ * The ranges are read in a single call without holding the GIL
+ * The list contains None for a range that could not be read
+ * Returns a Python object holding a list of the data if successful or NULL on error
+ */
+PyObject *pyewf_handle_read_buffers_at_offsets(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *list_object       = NULL;
+	PyObject *range_object      = NULL;
+	PyObject *ranges_object     = NULL;
+	PyObject *sequence_object   = NULL;
+	PyObject *string_object     = NULL;
+	static char *function       = "pyewf_handle_read_buffers_at_offsets";
+	static char *keyword_list[] = { "ranges", NULL };
+	void **buffers              = NULL;
+	off64_t *range_offsets      = NULL;
+	size_t *range_sizes         = NULL;
+	ssize_t *read_counts        = NULL;
+	Py_ssize_t number_of_ranges = 0;
+	Py_ssize_t range_index      = 0;
+	off64_t read_offset         = 0;
+	int read_size               = 0;
+	int result                  = 0;
+
+	if( pyewf_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &ranges_object ) == 0 )
+	{
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   ranges_object,
+	                   "invalid ranges - expected a sequence of (offset, size) tuples" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_ranges = PySequence_Fast_GET_SIZE(
+	                    sequence_object );
+
+	list_object = PyList_New(
+	               number_of_ranges );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	if( number_of_ranges == 0 )
+	{
+		Py_DecRef(
+		 sequence_object );
+
+		return( list_object );
+	}
+	if( number_of_ranges > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	buffers = (void **) PyMem_Malloc(
+	                     sizeof( void * ) * number_of_ranges );
+
+	range_offsets = (off64_t *) PyMem_Malloc(
+	                             sizeof( off64_t ) * number_of_ranges );
+
+	range_sizes = (size_t *) PyMem_Malloc(
+	                          sizeof( size_t ) * number_of_ranges );
+
+	read_counts = (ssize_t *) PyMem_Malloc(
+	                           sizeof( ssize_t ) * number_of_ranges );
+
+	if( ( buffers == NULL )
+	 || ( range_offsets == NULL )
+	 || ( range_sizes == NULL )
+	 || ( read_counts == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* Parse all the ranges and allocate the buffers before releasing the GIL
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		range_object = PySequence_Fast_GET_ITEM(
+		                sequence_object,
+		                range_index );
+
+		if( PyTuple_Check(
+		     range_object ) == 0 )
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: invalid range: %zd - expected an (offset, size) tuple.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( PyArg_ParseTuple(
+		     range_object,
+		     "Li",
+		     &read_offset,
+		     &read_size ) == 0 )
+		{
+			goto on_error;
+		}
+		if( read_offset < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid range: %zd offset value less than zero.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( read_size < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid range: %zd size value less than zero.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+#if PY_MAJOR_VERSION >= 3
+		string_object = PyBytes_FromStringAndSize(
+		                 NULL,
+		                 read_size );
+#else
+		string_object = PyString_FromStringAndSize(
+		                 NULL,
+		                 read_size );
+#endif
+		if( string_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SET_ITEM steals the reference
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 range_index,
+		 string_object );
+
+#if PY_MAJOR_VERSION >= 3
+		buffers[ range_index ] = PyBytes_AsString(
+		                          string_object );
+#else
+		buffers[ range_index ] = PyString_AsString(
+		                          string_object );
+#endif
+		range_offsets[ range_index ] = read_offset;
+		range_sizes[ range_index ]   = (size_t) read_size;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libewf_handle_read_ranges(
+	          pyewf_handle->handle,
+	          range_offsets,
+	          range_sizes,
+	          buffers,
+	          read_counts,
+	          (int) number_of_ranges,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyewf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data of ranges.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Need to resize the strings here in case a range was not fully read
+	 * and replace the strings of the ranges that could not be read by None.
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( read_counts[ range_index ] <= -1 )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			/* PyList_SetItem releases the reference to the string object
+			 */
+			if( PyList_SetItem(
+			     list_object,
+			     range_index,
+			     Py_None ) != 0 )
+			{
+				goto on_error;
+			}
+			continue;
+		}
+		string_object = PyList_GET_ITEM(
+		                 list_object,
+		                 range_index );
+
+#if PY_MAJOR_VERSION >= 3
+		if( read_counts[ range_index ] == PyBytes_GET_SIZE(
+		                                   string_object ) )
+#else
+		if( read_counts[ range_index ] == PyString_GET_SIZE(
+		                                   string_object ) )
+#endif
+		{
+			continue;
+		}
+#if PY_MAJOR_VERSION >= 3
+		result = _PyBytes_Resize(
+		          &string_object,
+		          (Py_ssize_t) read_counts[ range_index ] );
+#else
+		result = _PyString_Resize(
+		          &string_object,
+		          (Py_ssize_t) read_counts[ range_index ] );
+#endif
+		/* The resize can replace the string object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 range_index,
+		 string_object );
+
+		if( result != 0 )
+		{
+			goto on_error;
+		}
+	}
+	PyMem_Free(
+	 read_counts );
+
+	PyMem_Free(
+	 range_sizes );
+
+	PyMem_Free(
+	 range_offsets );
+
+	PyMem_Free(
+	 buffers );
+
+	Py_DecRef(
+	 sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( read_counts != NULL )
+	{
+		PyMem_Free(
+		 read_counts );
+	}
+	if( range_sizes != NULL )
+	{
+		PyMem_Free(
+		 range_sizes );
+	}
+	if( range_offsets != NULL )
+	{
+		PyMem_Free(
+		 range_offsets );
+	}
+	if( buffers != NULL )
+	{
+		PyMem_Free(
+		 buffers );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
+
+/* Retrieves an iterator over the media data in chunks
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyewf_handle_iter_chunks(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *iterator_object   = NULL;
+	static char *function       = "pyewf_handle_iter_chunks";
+	static char *keyword_list[] = { "offset", NULL };
+	off64_t offset              = 0;
+
+	if( pyewf_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pyewf handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|L",
+	     keyword_list,
+	     &offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	iterator_object = pyewf_data_chunks_new(
+	                   pyewf_handle,
+	                   offset );
+
+	return( iterator_object );
+}
+
 /* Writes a buffer of media data
  * Returns a Python object holding the data if successful or NULL on error
  */
@@ -79,6 +79,10 @@ PyObject *pyewf_handle_close(
            pyewf_handle_t *pyewf_handle,
            PyObject *arguments );
 
+PyObject *pyewf_handle_clone(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments );
+
 PyObject *pyewf_handle_read_buffer(
            pyewf_handle_t *pyewf_handle,
            PyObject *arguments,
@@ -89,6 +93,26 @@ PyObject *pyewf_handle_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyewf_handle_read_buffer_into(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyewf_handle_read_buffer_at_offset_into(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyewf_handle_read_buffers_at_offsets(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyewf_handle_iter_chunks(
+           pyewf_handle_t *pyewf_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyewf_handle_write_buffer(
            pyewf_handle_t *pyewf_handle,
            PyObject *arguments,
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -29,13 +31,22 @@
 
 #include "ewf_test_libcdata.h"
 #include "ewf_test_libcerror.h"
+#include "ewf_test_libcfile.h"
 #include "ewf_test_libewf.h"
 #include "ewf_test_macros.h"
 #include "ewf_test_memory.h"
 #include "ewf_test_unused.h"
 
+#include "../libewf/libewf_chunk_data.h"
 #include "../libewf/libewf_chunk_table.h"
+#include "../libewf/libewf_definitions.h"
+#include "../libewf/libewf_handle.h"
 #include "../libewf/libewf_io_handle.h"
+#include "../libewf/libewf_io_queue.h"
+
+#define EWF_TEST_CHUNK_TABLE_CHUNK_SIZE			32768
+#define EWF_TEST_CHUNK_TABLE_NUMBER_OF_CHUNKS		64
+#define EWF_TEST_CHUNK_TABLE_MAXIMUM_SEGMENT_SIZE	( 256 * 1024 )
 
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
@@ -1736,60 +1747,1104 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+/* Tests the libewf_chunk_table_read_chunks_data_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_table_read_chunks_data_by_offset(
+     void )
+{
+	libewf_chunk_data_t *chunks_data[ 2 ];
 
-/* The main program
+	libcerror_error_t *error          = NULL;
+	libewf_chunk_table_t *chunk_table = NULL;
+	libewf_io_handle_t *io_handle     = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_chunk_table_initialize(
+	          &chunk_table,
+	          io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_table",
+	 chunk_table );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_table_read_chunks_data_by_offset(
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          chunks_data,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_table_read_chunks_data_by_offset(
+	          chunk_table,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          chunks_data,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_table_free(
+	          &chunk_table,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_table",
+	 chunk_table );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_table != NULL )
+	{
+		libewf_chunk_table_free(
+		 &chunk_table,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libewf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Writes a multi-segment EWF image with test data
+ * Returns 1 if successful or -1 on error
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
-#endif
+int ewf_test_chunk_table_write_image(
+     const char *filename,
+     const uint8_t *media_data,
+     size64_t media_size,
+     libcerror_error_t **error )
 {
-	EWF_TEST_UNREFERENCED_PARAMETER( argc )
-	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+	libewf_handle_t *handle = NULL;
+	static char *function   = "ewf_test_chunk_table_write_image";
+	size_t write_size       = 0;
+	ssize_t write_count     = 0;
+	off64_t media_offset    = 0;
+
+	if( libewf_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_open(
+	     handle,
+	     (char * const *) &filename,
+	     1,
+	     LIBEWF_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_media_size(
+	     handle,
+	     media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_maximum_segment_size(
+	     handle,
+	     EWF_TEST_CHUNK_TABLE_MAXIMUM_SEGMENT_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum segment size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_compression_values(
+	     handle,
+	     LIBEWF_COMPRESSION_FAST,
+	     LIBEWF_COMPRESS_FLAG_USE_EMPTY_BLOCK_COMPRESSION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compression values.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size64_t) media_offset < media_size )
+	{
+		write_size = EWF_TEST_CHUNK_TABLE_CHUNK_SIZE;
 
-#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+		if( (size64_t) ( media_offset + write_size ) > media_size )
+		{
+			write_size = (size_t) ( media_size - media_offset );
+		}
+		write_count = libewf_handle_write_buffer(
+		               handle,
+		               &( media_data[ media_offset ] ),
+		               write_size,
+		               error );
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_initialize",
-	 ewf_test_chunk_table_initialize );
+		if( write_count != (ssize_t) write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data at offset: %" PRIi64 ".",
+			 function,
+			 media_offset );
+
+			goto on_error;
+		}
+		media_offset += (off64_t) write_size;
+	}
+	if( libewf_handle_close(
+	     handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_free",
-	 ewf_test_chunk_table_free );
+on_error:
+	if( handle != NULL )
+	{
+		libewf_handle_close(
+		 handle,
+		 NULL );
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_clone",
-	 ewf_test_chunk_table_clone );
+/* Removes the segment files of an EWF image
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_chunk_table_remove_image(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	char **filenames        = NULL;
+	static char *function   = "ewf_test_chunk_table_remove_image";
+	int filename_index      = 0;
+	int number_of_filenames = 0;
+	int result              = 1;
+
+	if( libewf_glob(
+	     filename,
+	     narrow_string_length(
+	      filename ),
+	     LIBEWF_FORMAT_ENCASE6,
+	     &filenames,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to glob filenames.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( libcfile_file_remove(
+		     filenames[ filename_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove file: %s.",
+			 function,
+			 filenames[ filename_index ] );
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_get_number_of_checksum_errors",
-	 ewf_test_chunk_table_get_number_of_checksum_errors );
+			result = -1;
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_get_checksum_error",
-	 ewf_test_chunk_table_get_checksum_error );
+			break;
+		}
+	}
+	if( libewf_glob_free(
+	     filenames,
+	     number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free globbed filenames.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_append_checksum_error",
-	 ewf_test_chunk_table_append_checksum_error );
+/* Tests the libewf_chunk_table_read_chunks_data_by_offset function with chunk data
+ * of a multi-segment EWF image
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_table_read_chunks_data_by_offset_from_image(
+     void )
+{
+	libewf_chunk_data_t *chunks_data[ LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS ];
+	libewf_io_queue_t *io_queues[ 3 ];
+
+	libcerror_error_t *error                  = NULL;
+	libewf_handle_t *handle                   = NULL;
+	libewf_internal_handle_t *internal_handle = NULL;
+	char **filenames                          = NULL;
+	uint8_t *buffer                           = NULL;
+	uint8_t *media_data                       = NULL;
+	const char *filename                      = "ewf_test_chunk_table_image";
+	size64_t media_size                       = 0;
+	ssize_t read_count                        = 0;
+	off64_t media_offset                      = 0;
+	uint32_t random_value                     = 0x5a17c3e1UL;
+	int batch_index                           = 0;
+	int chunk_index                           = 0;
+	int expected_number_of_chunks             = 0;
+	int image_written                         = 0;
+	int io_queue_index                        = 0;
+	int number_of_chunks                      = 0;
+	int number_of_filenames                   = 0;
+	int result                                = 0;
+
+	for( io_queue_index = 0;
+	     io_queue_index < 3;
+	     io_queue_index++ )
+	{
+		io_queues[ io_queue_index ] = NULL;
+	}
+	for( batch_index = 0;
+	     batch_index < LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS;
+	     batch_index++ )
+	{
+		chunks_data[ batch_index ] = NULL;
+	}
+	/* Initialize test
+	 * The media data consists of a mix of empty, pattern filled and random
+	 * chunks so that the chunks are stored both compressed and uncompressed
+	 */
+	media_size = (size64_t) EWF_TEST_CHUNK_TABLE_NUMBER_OF_CHUNKS * EWF_TEST_CHUNK_TABLE_CHUNK_SIZE;
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_get_segment_file_chunk_group_by_offset",
-	 ewf_test_chunk_table_get_segment_file_chunk_group_by_offset );
+	media_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * (size_t) media_size );
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_chunk_exists_for_offset",
-	 ewf_test_chunk_table_chunk_exists_for_offset );
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "media_data",
+	 media_data );
 
-	EWF_TEST_RUN(
-	 "libewf_chunk_table_get_chunk_data_by_offset",
-	 ewf_test_chunk_table_get_chunk_data_by_offset );
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * (size_t) media_size );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	for( media_offset = 0;
+	     (size64_t) media_offset < media_size;
+	     media_offset++ )
+	{
+		chunk_index = (int) ( media_offset / EWF_TEST_CHUNK_TABLE_CHUNK_SIZE );
+
+		if( ( chunk_index % 4 ) == 1 )
+		{
+			media_data[ media_offset ] = 0;
+		}
+		else if( ( chunk_index % 4 ) == 3 )
+		{
+			media_data[ media_offset ] = (uint8_t) ( 'A' + ( chunk_index % 26 ) );
+		}
+		else
+		{
+			random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+			media_data[ media_offset ] = (uint8_t) ( random_value >> 16 );
+		}
+	}
+	result = ewf_test_chunk_table_write_image(
+	          filename,
+	          media_data,
+	          media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	image_written = 1;
+
+	result = libewf_glob(
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          LIBEWF_FORMAT_ENCASE6,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Make sure the batches cross segment file boundaries
+	 */
+	EWF_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_filenames",
+	 number_of_filenames,
+	 2 );
+
+	result = libewf_handle_initialize(
+	          &handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_open(
+	          handle,
+	          filenames,
+	          number_of_filenames,
+	          LIBEWF_OPEN_READ,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_handle->media_values->chunk_size",
+	 internal_handle->media_values->chunk_size,
+	 (uint32_t) EWF_TEST_CHUNK_TABLE_CHUNK_SIZE );
+
+	result = libewf_io_queue_initialize(
+	          &( io_queues[ 1 ] ),
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_io_queue_initialize(
+	          &( io_queues[ 2 ] ),
+	          LIBEWF_MAXIMUM_NUMBER_OF_CONCURRENT_READS,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Read batches starting at every chunk, without an IO queue and with
+	 * an IO queue that reads sequentially or concurrently
+	 */
+	for( io_queue_index = 0;
+	     io_queue_index < 3;
+	     io_queue_index++ )
+	{
+		for( chunk_index = 0;
+		     chunk_index < EWF_TEST_CHUNK_TABLE_NUMBER_OF_CHUNKS;
+		     chunk_index++ )
+		{
+			expected_number_of_chunks = EWF_TEST_CHUNK_TABLE_NUMBER_OF_CHUNKS - chunk_index;
+
+			if( expected_number_of_chunks > LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS )
+			{
+				expected_number_of_chunks = LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS;
+			}
+			number_of_chunks = libewf_chunk_table_read_chunks_data_by_offset(
+			                    internal_handle->chunk_table,
+			                    (uint64_t) chunk_index,
+			                    internal_handle->io_handle,
+			                    internal_handle->file_io_pool,
+			                    internal_handle->media_values,
+			                    internal_handle->segment_table,
+			                    internal_handle->chunk_groups_cache,
+			                    io_queues[ io_queue_index ],
+			                    (off64_t) chunk_index * EWF_TEST_CHUNK_TABLE_CHUNK_SIZE,
+			                    chunks_data,
+			                    LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS,
+			                    &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "number_of_chunks",
+			 number_of_chunks,
+			 expected_number_of_chunks );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( batch_index = 0;
+			     batch_index < number_of_chunks;
+			     batch_index++ )
+			{
+				EWF_TEST_ASSERT_IS_NOT_NULL(
+				 "chunks_data[ batch_index ]",
+				 chunks_data[ batch_index ] );
+
+				EWF_TEST_ASSERT_EQUAL_SIZE(
+				 "chunks_data[ batch_index ]->data_size",
+				 chunks_data[ batch_index ]->data_size,
+				 (size_t) EWF_TEST_CHUNK_TABLE_CHUNK_SIZE );
+
+				media_offset = (off64_t) ( chunk_index + batch_index ) * EWF_TEST_CHUNK_TABLE_CHUNK_SIZE;
+
+				result = memory_compare(
+				          chunks_data[ batch_index ]->data,
+				          &( media_data[ media_offset ] ),
+				          EWF_TEST_CHUNK_TABLE_CHUNK_SIZE );
+
+				EWF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+
+				result = libewf_chunk_data_free(
+				          &( chunks_data[ batch_index ] ),
+				          &error );
+
+				EWF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				EWF_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+	}
+	/* Test reading all the media data through the handle, which reads batches
+	 * and stores the batched chunks in the chunks cache
+	 */
+	read_count = libewf_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              (size_t) media_size,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) media_size );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          media_data,
+	          (size_t) media_size );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read part of the last chunks again, which are retrieved from the chunks cache
+	 */
+	media_offset = ( (off64_t) ( EWF_TEST_CHUNK_TABLE_NUMBER_OF_CHUNKS - 2 ) * EWF_TEST_CHUNK_TABLE_CHUNK_SIZE ) + 100;
+
+	read_count = libewf_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              EWF_TEST_CHUNK_TABLE_CHUNK_SIZE,
+	              media_offset,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) EWF_TEST_CHUNK_TABLE_CHUNK_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( media_data[ media_offset ] ),
+	          EWF_TEST_CHUNK_TABLE_CHUNK_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	for( io_queue_index = 1;
+	     io_queue_index < 3;
+	     io_queue_index++ )
+	{
+		result = libewf_io_queue_free(
+		          &( io_queues[ io_queue_index ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libewf_handle_close(
+	          handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_free(
+	          &handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_glob_free(
+	          filenames,
+	          number_of_filenames,
+	          &error );
+
+	filenames = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_chunk_table_remove_image(
+	          filename,
+	          &error );
+
+	image_written = 0;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	memory_free(
+	 media_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( batch_index = 0;
+	     batch_index < LIBEWF_MAXIMUM_NUMBER_OF_BATCHED_CHUNKS;
+	     batch_index++ )
+	{
+		if( chunks_data[ batch_index ] != NULL )
+		{
+			libewf_chunk_data_free(
+			 &( chunks_data[ batch_index ] ),
+			 NULL );
+		}
+	}
+	for( io_queue_index = 1;
+	     io_queue_index < 3;
+	     io_queue_index++ )
+	{
+		if( io_queues[ io_queue_index ] != NULL )
+		{
+			libewf_io_queue_free(
+			 &( io_queues[ io_queue_index ] ),
+			 NULL );
+		}
+	}
+	if( handle != NULL )
+	{
+		libewf_handle_close(
+		 handle,
+		 NULL );
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( filenames != NULL )
+	{
+		libewf_glob_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+	}
+	if( image_written != 0 )
+	{
+		ewf_test_chunk_table_remove_image(
+		 filename,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( media_data != NULL )
+	{
+		memory_free(
+		 media_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_table_get_chunk_fill_pattern_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_table_get_chunk_fill_pattern_by_offset(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libewf_chunk_table_t *chunk_table = NULL;
+	libewf_io_handle_t *io_handle     = NULL;
+	uint64_t fill_pattern             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_chunk_table_initialize(
+	          &chunk_table,
+	          io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_table",
+	 chunk_table );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+/* TODO implement */
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_table_get_chunk_fill_pattern_by_offset(
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &fill_pattern,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_table_get_chunk_fill_pattern_by_offset(
+	          chunk_table,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &fill_pattern,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_table_free(
+	          &chunk_table,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_table",
+	 chunk_table );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_table != NULL )
+	{
+		libewf_chunk_table_free(
+		 &chunk_table,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libewf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_initialize",
+	 ewf_test_chunk_table_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_free",
+	 ewf_test_chunk_table_free );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_clone",
+	 ewf_test_chunk_table_clone );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_get_number_of_checksum_errors",
+	 ewf_test_chunk_table_get_number_of_checksum_errors );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_get_checksum_error",
+	 ewf_test_chunk_table_get_checksum_error );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_append_checksum_error",
+	 ewf_test_chunk_table_append_checksum_error );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_get_segment_file_chunk_group_by_offset",
+	 ewf_test_chunk_table_get_segment_file_chunk_group_by_offset );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_chunk_exists_for_offset",
+	 ewf_test_chunk_table_chunk_exists_for_offset );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_get_chunk_data_by_offset",
+	 ewf_test_chunk_table_get_chunk_data_by_offset );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_read_chunks_data_by_offset",
+	 ewf_test_chunk_table_read_chunks_data_by_offset );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_read_chunks_data_by_offset_from_image",
+	 ewf_test_chunk_table_read_chunks_data_by_offset_from_image );
+
+	EWF_TEST_RUN(
+	 "libewf_chunk_table_get_chunk_fill_pattern_by_offset",
+	 ewf_test_chunk_table_get_chunk_fill_pattern_by_offset );
 
 	/* TODO: add tests for libewf_chunk_table_set_chunk_data_by_offset */
 
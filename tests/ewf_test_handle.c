@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -2402,6 +2403,679 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_handle_read_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_read_ranges(
+     libewf_handle_t *handle )
+{
+	uint8_t range_buffer1[ EWF_TEST_HANDLE_READ_BUFFER_SIZE ];
+	uint8_t range_buffer2[ EWF_TEST_HANDLE_READ_BUFFER_SIZE ];
+	uint8_t reference_buffer[ EWF_TEST_HANDLE_READ_BUFFER_SIZE ];
+
+	void *buffers[ 2 ]            = { NULL, NULL };
+	libcerror_error_t *error      = NULL;
+	size64_t media_size           = 0;
+	size_t range_sizes[ 2 ]       = { 0, 0 };
+	ssize_t read_count            = 0;
+	ssize_t read_counts[ 2 ]      = { 0, 0 };
+	off64_t offset                = 0;
+	off64_t range_offsets[ 2 ]    = { 0, 0 };
+	int result                    = 0;
+
+	/* Determine size
+	 */
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libewf_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	range_sizes[ 0 ] = EWF_TEST_HANDLE_READ_BUFFER_SIZE;
+	range_sizes[ 1 ] = EWF_TEST_HANDLE_READ_BUFFER_SIZE;
+
+	if( media_size < EWF_TEST_HANDLE_READ_BUFFER_SIZE )
+	{
+		range_sizes[ 0 ] = (size_t) media_size;
+		range_sizes[ 1 ] = (size_t) media_size;
+	}
+	if( media_size > 8 )
+	{
+		/* The first range is beyond the second to test that the ranges are read out of order
+		 */
+		range_offsets[ 0 ] = (off64_t) media_size - 8;
+		range_sizes[ 0 ]   = 8;
+	}
+	buffers[ 0 ] = range_buffer1;
+	buffers[ 1 ] = range_buffer2;
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          range_offsets,
+	          range_sizes,
+	          buffers,
+	          read_counts,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 0 ]",
+	 read_counts[ 0 ],
+	 (ssize_t) range_sizes[ 0 ] );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 1 ]",
+	 read_counts[ 1 ],
+	 (ssize_t) range_sizes[ 1 ] );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Check if the current offset was not changed
+	 */
+	result = libewf_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Check if the data of the ranges matches a regular read
+	 */
+	read_count = libewf_handle_read_buffer_at_offset(
+	              handle,
+	              reference_buffer,
+	              range_sizes[ 0 ],
+	              range_offsets[ 0 ],
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) range_sizes[ 0 ] );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          range_buffer1,
+	          reference_buffer,
+	          range_sizes[ 0 ] );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libewf_handle_read_buffer_at_offset(
+	              handle,
+	              reference_buffer,
+	              range_sizes[ 1 ],
+	              range_offsets[ 1 ],
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) range_sizes[ 1 ] );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          range_buffer2,
+	          reference_buffer,
+	          range_sizes[ 1 ] );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test overlapping ranges, the data of the first range is contained
+	 * in the second range
+	 */
+	range_offsets[ 0 ] = (off64_t) ( range_sizes[ 1 ] / 3 );
+	range_sizes[ 0 ]   = range_sizes[ 1 ] - ( range_sizes[ 1 ] / 3 );
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          range_offsets,
+	          range_sizes,
+	          buffers,
+	          read_counts,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 0 ]",
+	 read_counts[ 0 ],
+	 (ssize_t) range_sizes[ 0 ] );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 1 ]",
+	 read_counts[ 1 ],
+	 (ssize_t) range_sizes[ 1 ] );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          range_buffer1,
+	          &( range_buffer2[ range_offsets[ 0 ] ] ),
+	          range_sizes[ 0 ] );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test reading a range with an invalid offset
+	 */
+	range_offsets[ 1 ] = -1;
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          range_offsets,
+	          range_sizes,
+	          buffers,
+	          read_counts,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 0 ]",
+	 read_counts[ 0 ],
+	 (ssize_t) range_sizes[ 0 ] );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 1 ]",
+	 read_counts[ 1 ],
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	range_offsets[ 1 ] = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_handle_read_ranges(
+	          NULL,
+	          range_offsets,
+	          range_sizes,
+	          buffers,
+	          read_counts,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          NULL,
+	          range_sizes,
+	          buffers,
+	          read_counts,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          range_offsets,
+	          NULL,
+	          buffers,
+	          read_counts,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          range_offsets,
+	          range_sizes,
+	          NULL,
+	          read_counts,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          range_offsets,
+	          range_sizes,
+	          buffers,
+	          NULL,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_read_ranges(
+	          handle,
+	          range_offsets,
+	          range_sizes,
+	          buffers,
+	          read_counts,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_chunk_fill_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_chunk_fill_pattern(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t media_size      = 0;
+	uint64_t fill_pattern    = 0;
+	int result               = 0;
+
+	/* Determine size
+	 */
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( media_size > 0 )
+	{
+		result = libewf_handle_get_chunk_fill_pattern(
+		          handle,
+		          0,
+		          &fill_pattern,
+		          &error );
+
+		EWF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libewf_handle_get_chunk_fill_pattern(
+	          NULL,
+	          0,
+	          &fill_pattern,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_chunk_fill_pattern(
+	          handle,
+	          (uint64_t) -1,
+	          &fill_pattern,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( media_size > 0 )
+	{
+		result = libewf_handle_get_chunk_fill_pattern(
+		          handle,
+		          0,
+		          NULL,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_handle_get_next_data_region function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_get_next_data_region(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t media_size      = 0;
+	size64_t region_size     = 0;
+	off64_t region_offset    = 0;
+	int result               = 0;
+
+	/* Determine size
+	 */
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_get_next_data_region(
+	          handle,
+	          0,
+	          &region_offset,
+	          &region_size,
+	          &error );
+
+	EWF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		EWF_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "region_size",
+		 (int64_t) region_size,
+		 (int64_t) 0 );
+
+		EWF_TEST_ASSERT_LESS_THAN_UINT64(
+		 "region_offset + region_size",
+		 (uint64_t) ( region_offset + region_size ),
+		 (uint64_t) ( media_size + 1 ) );
+	}
+	/* Test retrieving a data region beyond the media size
+	 */
+	result = libewf_handle_get_next_data_region(
+	          handle,
+	          (off64_t) media_size,
+	          &region_offset,
+	          &region_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_get_next_data_region(
+	          NULL,
+	          0,
+	          &region_offset,
+	          &region_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_next_data_region(
+	          handle,
+	          -1,
+	          &region_offset,
+	          &region_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_next_data_region(
+	          handle,
+	          0,
+	          NULL,
+	          &region_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_get_next_data_region(
+	          handle,
+	          0,
+	          &region_offset,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_handle_get_data_chunk function
  * Returns 1 if successful or 0 if not
  */
@@ -2812,6 +3486,231 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_handle_set_maximum_number_of_concurrent_reads function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_set_maximum_number_of_concurrent_reads(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error   = NULL;
+	uint8_t *concurrent_buffer = NULL;
+	uint8_t *sequential_buffer = NULL;
+	size64_t media_size        = 0;
+	size32_t chunk_size        = 0;
+	size_t read_size           = 0;
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_chunk_size(
+	          handle,
+	          &chunk_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read multiple chunks so that the read is batched
+	 */
+	read_size = 4 * (size_t) chunk_size;
+
+	if( media_size < (size64_t) read_size )
+	{
+		read_size = (size_t) media_size;
+	}
+	sequential_buffer = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * 4 * chunk_size );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "sequential_buffer",
+	 sequential_buffer );
+
+	concurrent_buffer = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * 4 * chunk_size );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "concurrent_buffer",
+	 concurrent_buffer );
+
+	read_count = libewf_handle_read_buffer_at_offset(
+	              handle,
+	              sequential_buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_set_maximum_number_of_concurrent_reads(
+	          handle,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libewf_handle_read_buffer_at_offset(
+	              handle,
+	              concurrent_buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          concurrent_buffer,
+	          sequential_buffer,
+	          read_size );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libewf_handle_set_maximum_number_of_concurrent_reads(
+	          handle,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_set_maximum_number_of_concurrent_reads(
+	          NULL,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_set_maximum_number_of_concurrent_reads(
+	          handle,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_set_maximum_number_of_concurrent_reads(
+	          handle,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 concurrent_buffer );
+
+	concurrent_buffer = NULL;
+
+	memory_free(
+	 sequential_buffer );
+
+	sequential_buffer = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( concurrent_buffer != NULL )
+	{
+		memory_free(
+		 concurrent_buffer );
+	}
+	if( sequential_buffer != NULL )
+	{
+		memory_free(
+		 sequential_buffer );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_handle_get_segment_filename_size function
  * Returns 1 if successful or 0 if not
  */
@@ -4903,6 +5802,21 @@ int main(
 		 ewf_test_handle_read_buffer_at_offset,
 		 handle );
 
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_read_ranges",
+		 ewf_test_handle_read_ranges,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_chunk_fill_pattern",
+		 ewf_test_handle_get_chunk_fill_pattern,
+		 handle );
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_get_next_data_region",
+		 ewf_test_handle_get_next_data_region,
+		 handle );
+
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
 		/* TODO: add tests for libewf_internal_handle_write_buffer_to_file_io_pool */
@@ -4960,6 +5874,11 @@ int main(
 
 		/* TODO: add tests for libewf_handle_set_maximum_number_of_open_handles */
 
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_set_maximum_number_of_concurrent_reads",
+		 ewf_test_handle_set_maximum_number_of_concurrent_reads,
+		 handle );
+
 		/* TODO: add tests for libewf_handle_segment_files_corrupted */
 
 		/* TODO: add tests for libewf_handle_segment_files_encrypted */
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -35,6 +36,7 @@
 #include "ewf_test_unused.h"
 
 #include "../libewf/libewf_lef_file_entry.h"
+#include "../libewf/libewf_string_pool.h"
 
 uint8_t ewf_test_lef_file_entry_types_data1[ 107 ] = {
 	0x6d, 0x69, 0x64, 0x09, 0x6c, 0x73, 0x09, 0x62, 0x65, 0x09, 0x69, 0x64, 0x09, 0x63, 0x72, 0x09,
@@ -648,6 +650,7 @@ int ewf_test_lef_file_entry_clone(
 	          types,
 	          ewf_test_lef_file_entry_values_data1,
 	          4810,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1329,6 +1332,547 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_lef_file_entry_read_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_lef_file_entry_read_string(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	libewf_string_pool_t *string_pool       = NULL;
+	uint8_t *string_data1                   = (uint8_t *) "sample.png";
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_lef_file_entry_initialize(
+	          &lef_file_entry,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "lef_file_entry",
+	 lef_file_entry );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_lef_file_entry_read_string(
+	          lef_file_entry,
+	          &( lef_file_entry->name ),
+	          LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL,
+	          string_data1,
+	          11,
+	          string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "lef_file_entry->name.data_size",
+	 lef_file_entry->name.data_size,
+	 (size_t) 11 );
+
+	EWF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "lef_file_entry->value_flags",
+	 (int) ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL ),
+	 0 );
+
+	result = libewf_lef_file_entry_read_string(
+	          lef_file_entry,
+	          &( lef_file_entry->short_name ),
+	          LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_SHORT_NAME_IN_STRING_POOL,
+	          string_data1,
+	          10,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "lef_file_entry->value_flags",
+	 (int) ( lef_file_entry->value_flags & LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_SHORT_NAME_IN_STRING_POOL ),
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_lef_file_entry_read_string(
+	          NULL,
+	          &( lef_file_entry->name ),
+	          LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL,
+	          string_data1,
+	          11,
+	          string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_lef_file_entry_read_string(
+	          lef_file_entry,
+	          NULL,
+	          LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL,
+	          string_data1,
+	          11,
+	          string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with name value already set
+	 */
+	result = libewf_lef_file_entry_read_string(
+	          lef_file_entry,
+	          &( lef_file_entry->name ),
+	          LIBEWF_LEF_FILE_ENTRY_VALUE_FLAG_NAME_IN_STRING_POOL,
+	          string_data1,
+	          11,
+	          string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_lef_file_entry_free(
+	          &lef_file_entry,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "lef_file_entry",
+	 lef_file_entry );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lef_file_entry != NULL )
+	{
+		libewf_lef_file_entry_free(
+		 &lef_file_entry,
+		 NULL );
+	}
+	if( string_pool != NULL )
+	{
+		libewf_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_lef_file_entry_read_hexadecimal_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_lef_file_entry_read_hexadecimal_data(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	uint8_t expected_value_data[ 16 ] = {
+		0xdc, 0x18, 0x5c, 0x68, 0x11, 0x4d, 0x4e, 0xae, 0xb3, 0xa7, 0x8e, 0xc3, 0x36, 0x3c, 0x64, 0xb6 };
+
+	libcerror_error_t *error          = NULL;
+	uint8_t *hexadecimal_data1        = (uint8_t *) "DC185C68114D4EAEB3A78EC3363C64B6";
+	uint8_t *hexadecimal_data2        = (uint8_t *) "00000000000000000000000000000000";
+	uint8_t *hexadecimal_data3        = (uint8_t *) "DC185C68114D4EAE";
+	uint8_t *hexadecimal_error_data1  = (uint8_t *) "XC185C68114D4EAEB3A78EC3363C64B6";
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_data1,
+	          33,
+	          value_data,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          expected_value_data,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_data2,
+	          33,
+	          value_data,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_data1,
+	          0,
+	          value_data,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_data3,
+	          17,
+	          value_data,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          NULL,
+	          33,
+	          value_data,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          value_data,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_data1,
+	          33,
+	          NULL,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_data1,
+	          33,
+	          value_data,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_lef_file_entry_read_hexadecimal_data(
+	          hexadecimal_error_data1,
+	          33,
+	          value_data,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_lef_file_entry_get_hexadecimal_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_lef_file_entry_get_hexadecimal_string(
+     void )
+{
+	uint8_t string[ 33 ];
+
+	uint8_t value_data[ 16 ] = {
+		0xdc, 0x18, 0x5c, 0x68, 0x11, 0x4d, 0x4e, 0xae, 0xb3, 0xa7, 0x8e, 0xc3, 0x36, 0x3c, 0x64, 0xb6 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_lef_file_entry_get_hexadecimal_string(
+	          value_data,
+	          16,
+	          string,
+	          33,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "dc185c68114d4eaeb3a78ec3363c64b6",
+	          33 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_lef_file_entry_get_hexadecimal_string(
+	          NULL,
+	          16,
+	          string,
+	          33,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_lef_file_entry_get_hexadecimal_string(
+	          value_data,
+	          16,
+	          NULL,
+	          33,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_lef_file_entry_get_hexadecimal_string(
+	          value_data,
+	          16,
+	          string,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_lef_file_entry_read_short_name function
  * Returns 1 if successful or 0 if not
  */
@@ -1367,6 +1911,7 @@ int ewf_test_lef_file_entry_read_short_name(
 	          lef_file_entry,
 	          short_name_data1,
 	          16,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1384,6 +1929,7 @@ int ewf_test_lef_file_entry_read_short_name(
 	          NULL,
 	          short_name_data1,
 	          16,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1402,6 +1948,7 @@ int ewf_test_lef_file_entry_read_short_name(
 	          lef_file_entry,
 	          NULL,
 	          16,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1420,6 +1967,7 @@ int ewf_test_lef_file_entry_read_short_name(
 	          lef_file_entry,
 	          short_name_data1,
 	          (size_t) SSIZE_MAX + 1,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1440,6 +1988,7 @@ int ewf_test_lef_file_entry_read_short_name(
 	          lef_file_entry,
 	          short_name_error_data1,
 	          18,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1460,6 +2009,7 @@ int ewf_test_lef_file_entry_read_short_name(
 	          lef_file_entry,
 	          short_name_error_data2,
 	          16,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1567,6 +2117,7 @@ int ewf_test_lef_file_entry_read_data(
 	          types,
 	          ewf_test_lef_file_entry_values_data1,
 	          4810,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1585,6 +2136,7 @@ int ewf_test_lef_file_entry_read_data(
 	          types,
 	          ewf_test_lef_file_entry_values_data1,
 	          4810,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1604,6 +2156,7 @@ int ewf_test_lef_file_entry_read_data(
 	          NULL,
 	          ewf_test_lef_file_entry_values_data1,
 	          4810,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1623,6 +2176,7 @@ int ewf_test_lef_file_entry_read_data(
 	          types,
 	          NULL,
 	          4810,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1642,6 +2196,7 @@ int ewf_test_lef_file_entry_read_data(
 	          types,
 	          ewf_test_lef_file_entry_values_data1,
 	          (size_t) SSIZE_MAX + 1,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1661,6 +2216,7 @@ int ewf_test_lef_file_entry_read_data(
 	          types,
 	          ewf_test_lef_file_entry_values_data1,
 	          0,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1682,6 +2238,7 @@ int ewf_test_lef_file_entry_read_data(
 	          types,
 	          ewf_test_lef_file_entry_values_data1,
 	          166,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -4614,6 +5171,18 @@ int main(
 	 "libewf_lef_file_entry_read_extended_attributes",
 	 ewf_test_lef_file_entry_read_extended_attributes );
 
+	EWF_TEST_RUN(
+	 "libewf_lef_file_entry_read_hexadecimal_data",
+	 ewf_test_lef_file_entry_read_hexadecimal_data );
+
+	EWF_TEST_RUN(
+	 "libewf_lef_file_entry_read_string",
+	 ewf_test_lef_file_entry_read_string );
+
+	EWF_TEST_RUN(
+	 "libewf_lef_file_entry_get_hexadecimal_string",
+	 ewf_test_lef_file_entry_get_hexadecimal_string );
+
 	EWF_TEST_RUN(
 	 "libewf_lef_file_entry_read_short_name",
 	 ewf_test_lef_file_entry_read_short_name );
@@ -4668,6 +5237,7 @@ int main(
 	          types,
 	          ewf_test_lef_file_entry_values_data1,
 	          4810,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -0,0 +1,1142 @@
+/*
+ * Library line_reader type test program
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_line_reader.h"
+
+/* UTF-16 little-endian encoded lines data with a byte order mark,
+ * a carriage return and a trailing end-of-string character
+ */
+uint8_t ewf_test_line_reader_utf16_data1[ 26 ] = {
+	0xff, 0xfe, 0x35, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x72, 0x00, 0x65, 0x00, 0x63, 0x00, 0x0a, 0x00,
+	0x0a, 0x00, 0xe9, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x78, 0x00 };
+
+/* UTF-8 encoded lines data
+ */
+uint8_t ewf_test_line_reader_utf8_data1[ 10 ] = {
+	'5', '\n', 'r', 'e', 'c', '\n', '\n', 0xc3, 0xa9, '\n' };
+
+/* UTF-16 little-endian encoded lines data with carriage returns, a surrogate pair
+ * and without a trailing new line
+ */
+uint8_t ewf_test_line_reader_utf16_data2[ 16 ] = {
+	0x61, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x3d, 0xd8, 0x00, 0xde, 0x0d, 0x00, 0x0a, 0x00, 0x62, 0x00 };
+
+/* UTF-16 little-endian encoded lines data without carriage returns
+ */
+uint8_t ewf_test_line_reader_utf16_data3[ 8 ] = {
+	0x61, 0x00, 0x0a, 0x00, 0xe9, 0x00, 0x0a, 0x00 };
+
+/* UTF-16 little-endian encoded lines data that ends with a truncated surrogate pair
+ */
+uint8_t ewf_test_line_reader_utf16_data4[ 6 ] = {
+	0x61, 0x00, 0x0a, 0x00, 0x3d, 0xd8 };
+
+/* UTF-8 encoded lines data with a carriage return and without a trailing new line
+ */
+uint8_t ewf_test_line_reader_utf8_data2[ 4 ] = {
+	'a', '\r', '\n', 'b' };
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Tests the libewf_line_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_line_reader_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libewf_line_reader_t *line_reader = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          ewf_test_line_reader_utf16_data1,
+	          26,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "line_reader",
+	 line_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_line_reader_free(
+	          &line_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "line_reader",
+	 line_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_line_reader_initialize(
+	          NULL,
+	          ewf_test_line_reader_utf16_data1,
+	          26,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	line_reader = (libewf_line_reader_t *) 0x12345678UL;
+
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          ewf_test_line_reader_utf16_data1,
+	          26,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	line_reader = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          NULL,
+	          26,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          ewf_test_line_reader_utf16_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          ewf_test_line_reader_utf16_data1,
+	          25,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          ewf_test_line_reader_utf16_data1,
+	          26,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_line_reader_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_line_reader_initialize(
+		          &line_reader,
+		          ewf_test_line_reader_utf16_data1,
+		          26,
+		          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( line_reader != NULL )
+			{
+				libewf_line_reader_free(
+				 &line_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "line_reader",
+			 line_reader );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_line_reader_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_line_reader_initialize(
+		          &line_reader,
+		          ewf_test_line_reader_utf16_data1,
+		          26,
+		          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( line_reader != NULL )
+			{
+				libewf_line_reader_free(
+				 &line_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "line_reader",
+			 line_reader );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( line_reader != NULL )
+	{
+		libewf_line_reader_free(
+		 &line_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_line_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_line_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_line_reader_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_line_reader_get_number_of_lines function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_line_reader_get_number_of_lines(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libewf_line_reader_t *line_reader = NULL;
+	int number_of_lines               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          ewf_test_line_reader_utf16_data1,
+	          26,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_line_reader_get_number_of_lines(
+	          line_reader,
+	          &number_of_lines,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_lines",
+	 number_of_lines,
+	 5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_line_reader_get_number_of_lines(
+	          NULL,
+	          &number_of_lines,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_line_reader_get_number_of_lines(
+	          line_reader,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_line_reader_free(
+	          &line_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( line_reader != NULL )
+	{
+		libewf_line_reader_free(
+		 &line_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_line_reader_read_next_line function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_line_reader_read_next_line(
+     void )
+{
+	uint8_t expected_line_string1[ 5 ] = { 0xf0, 0x9f, 0x98, 0x80, 0 };
+	uint8_t expected_line_string2[ 3 ] = { 0xc3, 0xa9, 0 };
+
+	libcerror_error_t *error           = NULL;
+	libewf_line_reader_t *line_reader  = NULL;
+	const uint8_t *expected_lines[ 3 ];
+	uint8_t *data                      = NULL;
+	size_t data_size                   = 0;
+	size_t expected_line_sizes[ 3 ];
+	int encoding                       = 0;
+	int line_index                     = 0;
+	int number_of_lines                = 0;
+	int result                         = 0;
+	int test_index                     = 0;
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 3;
+	     test_index++ )
+	{
+		if( test_index == 0 )
+		{
+			/* UTF-16 with carriage returns and without a trailing new line
+			 */
+			data                     = ewf_test_line_reader_utf16_data2;
+			data_size                = 16;
+			encoding                 = LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN;
+			number_of_lines          = 3;
+			expected_lines[ 0 ]      = (uint8_t *) "a";
+			expected_line_sizes[ 0 ] = 2;
+			expected_lines[ 1 ]      = expected_line_string1;
+			expected_line_sizes[ 1 ] = 5;
+			expected_lines[ 2 ]      = (uint8_t *) "b";
+			expected_line_sizes[ 2 ] = 2;
+		}
+		else if( test_index == 1 )
+		{
+			/* UTF-16 without carriage returns and with a trailing new line
+			 */
+			data                     = ewf_test_line_reader_utf16_data3;
+			data_size                = 8;
+			encoding                 = LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN;
+			number_of_lines          = 3;
+			expected_lines[ 0 ]      = (uint8_t *) "a";
+			expected_line_sizes[ 0 ] = 2;
+			expected_lines[ 1 ]      = expected_line_string2;
+			expected_line_sizes[ 1 ] = 3;
+			expected_lines[ 2 ]      = (uint8_t *) "";
+			expected_line_sizes[ 2 ] = 1;
+		}
+		else
+		{
+			/* UTF-8 with a carriage return and without a trailing new line
+			 */
+			data                     = ewf_test_line_reader_utf8_data2;
+			data_size                = 4;
+			encoding                 = LIBEWF_LINE_READER_ENCODING_UTF8;
+			number_of_lines          = 2;
+			expected_lines[ 0 ]      = (uint8_t *) "a";
+			expected_line_sizes[ 0 ] = 2;
+			expected_lines[ 1 ]      = (uint8_t *) "b";
+			expected_line_sizes[ 1 ] = 2;
+		}
+		result = libewf_line_reader_initialize(
+		          &line_reader,
+		          data,
+		          data_size,
+		          encoding,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "line_reader",
+		 line_reader );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "line_reader->number_of_lines",
+		 line_reader->number_of_lines,
+		 number_of_lines );
+
+		for( line_index = 0;
+		     line_index < number_of_lines;
+		     line_index++ )
+		{
+			result = libewf_line_reader_read_next_line(
+			          line_reader,
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "line_reader->line_index",
+			 line_reader->line_index,
+			 line_index );
+
+			EWF_TEST_ASSERT_EQUAL_SIZE(
+			 "line_reader->line_string_size",
+			 line_reader->line_string_size,
+			 expected_line_sizes[ line_index ] );
+
+			result = memory_compare(
+			          line_reader->line_string,
+			          expected_lines[ line_index ],
+			          expected_line_sizes[ line_index ] );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		/* Test reading beyond the last line
+		 */
+		result = libewf_line_reader_read_next_line(
+		          line_reader,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libewf_line_reader_free(
+		          &line_reader,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "line_reader",
+		 line_reader );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libewf_line_reader_read_next_line(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading a line that ends with a truncated surrogate pair
+	 */
+	result = libewf_line_reader_initialize(
+	          &line_reader,
+	          ewf_test_line_reader_utf16_data4,
+	          6,
+	          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "line_reader",
+	 line_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_line_reader_read_next_line(
+	          line_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_line_reader_read_next_line(
+	          line_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A failed read restarts reading at the first line
+	 */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "line_reader->line_index",
+	 line_reader->line_index,
+	 -1 );
+
+	result = libewf_line_reader_read_next_line(
+	          line_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "line_reader->line_string_size",
+	 line_reader->line_string_size,
+	 (size_t) 2 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "line_reader->line_string[ 0 ]",
+	 (int) line_reader->line_string[ 0 ],
+	 (int) 'a' );
+
+	result = libewf_line_reader_free(
+	          &line_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "line_reader",
+	 line_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( line_reader != NULL )
+	{
+		libewf_line_reader_free(
+		 &line_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_line_reader_get_line_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_line_reader_get_line_by_index(
+     void )
+{
+	uint8_t expected_line_string[ 3 ] = { 0xc3, 0xa9, 0 };
+
+	libcerror_error_t *error          = NULL;
+	libewf_line_reader_t *line_reader = NULL;
+	uint8_t *line_string              = NULL;
+	size_t line_string_size           = 0;
+	int encoding_index                = 0;
+	int result                        = 0;
+
+	for( encoding_index = 0;
+	     encoding_index < 2;
+	     encoding_index++ )
+	{
+		/* Initialize test
+		 */
+		if( encoding_index == 0 )
+		{
+			result = libewf_line_reader_initialize(
+			          &line_reader,
+			          ewf_test_line_reader_utf16_data1,
+			          26,
+			          LIBEWF_LINE_READER_ENCODING_UTF16_LITTLE_ENDIAN,
+			          &error );
+		}
+		else
+		{
+			result = libewf_line_reader_initialize(
+			          &line_reader,
+			          ewf_test_line_reader_utf8_data1,
+			          10,
+			          LIBEWF_LINE_READER_ENCODING_UTF8,
+			          &error );
+		}
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          0,
+		          &line_string,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "line_string_size",
+		 line_string_size,
+		 (size_t) 2 );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "line_string[ 0 ]",
+		 (int) line_string[ 0 ],
+		 (int) '5' );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          3,
+		          &line_string,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "line_string_size",
+		 line_string_size,
+		 (size_t) 3 );
+
+		result = memory_compare(
+		          line_string,
+		          expected_line_string,
+		          3 );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test retrieving a preceding line
+		 */
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          2,
+		          &line_string,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "line_string_size",
+		 line_string_size,
+		 (size_t) 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          4,
+		          &line_string,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "line_string_size",
+		 line_string_size,
+		 (size_t) 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libewf_line_reader_get_line_by_index(
+		          NULL,
+		          0,
+		          &line_string,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          -1,
+		          &line_string,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          5,
+		          &line_string,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          0,
+		          NULL,
+		          &line_string_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libewf_line_reader_get_line_by_index(
+		          line_reader,
+		          0,
+		          &line_string,
+		          NULL,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Clean up
+		 */
+		result = libewf_line_reader_free(
+		          &line_reader,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( line_reader != NULL )
+	{
+		libewf_line_reader_free(
+		 &line_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_line_reader_initialize",
+	 ewf_test_line_reader_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_line_reader_free",
+	 ewf_test_line_reader_free );
+
+	EWF_TEST_RUN(
+	 "libewf_line_reader_get_number_of_lines",
+	 ewf_test_line_reader_get_number_of_lines );
+
+	EWF_TEST_RUN(
+	 "libewf_line_reader_read_next_line",
+	 ewf_test_line_reader_read_next_line );
+
+	EWF_TEST_RUN(
+	 "libewf_line_reader_get_line_by_index",
+	 ewf_test_line_reader_get_line_by_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -832,6 +833,465 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_single_file_tree_get_utf8_path_size and libewf_single_file_tree_get_utf8_path functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_file_tree_get_utf8_path(
+     void )
+{
+	uint8_t expected_utf8_path[ 6 ]             = { '\\', 'T', 'e', 's', 't', 0 };
+	uint8_t utf8_name[ 5 ]                      = { 'T', 'e', 's', 't', 0 };
+	uint8_t utf8_path[ 16 ];
+
+	libcdata_tree_node_t *root_node             = NULL;
+	libcdata_tree_node_t *sub_node              = NULL;
+	libcerror_error_t *error                    = NULL;
+	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
+	libewf_single_files_t *single_files         = NULL;
+	size64_t media_size                         = 0;
+	size_t utf8_path_size                       = 0;
+	uint8_t format                              = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_single_files_initialize(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_files_read_data(
+	          single_files,
+	          ewf_test_single_files_data1,
+	          5700,
+	          &media_size,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_files_get_file_entry_tree_root_node(
+	          single_files,
+	          &root_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "root_node",
+	 root_node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+	          root_node,
+	          utf8_name,
+	          4,
+	          &sub_node,
+	          &sub_lef_file_entry,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_node",
+	 sub_node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_single_file_tree_get_utf8_path_size(
+	          root_node,
+	          &utf8_path_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 2 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_file_tree_get_utf8_path(
+	          root_node,
+	          utf8_path,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_path,
+	          expected_utf8_path,
+	          1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_path[ 1 ]",
+	 utf8_path[ 1 ],
+	 0 );
+
+	result = libewf_single_file_tree_get_utf8_path_size(
+	          sub_node,
+	          &utf8_path_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_path_size",
+	 utf8_path_size,
+	 (size_t) 6 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_file_tree_get_utf8_path(
+	          sub_node,
+	          utf8_path,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_path,
+	          expected_utf8_path,
+	          6 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_single_file_tree_get_utf8_path_size(
+	          NULL,
+	          &utf8_path_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_file_tree_get_utf8_path_size(
+	          sub_node,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_file_tree_get_utf8_path(
+	          sub_node,
+	          NULL,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_file_tree_get_utf8_path(
+	          sub_node,
+	          utf8_path,
+	          5,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_single_files_free(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( single_files != NULL )
+	{
+		libewf_single_files_free(
+		 &single_files,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_single_file_tree_get_number_of_file_nodes function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_file_tree_get_number_of_file_nodes(
+     void )
+{
+	libcdata_tree_node_t *root_node     = NULL;
+	libcerror_error_t *error            = NULL;
+	libewf_single_files_t *single_files = NULL;
+	size64_t media_size                 = 0;
+	uint8_t format                      = 0;
+	int number_of_file_nodes            = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_single_files_initialize(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_files_read_data(
+	          single_files,
+	          ewf_test_single_files_data1,
+	          5700,
+	          &media_size,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_files_get_file_entry_tree_root_node(
+	          single_files,
+	          &root_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "root_node",
+	 root_node );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_single_file_tree_get_number_of_file_nodes(
+	          root_node,
+	          &number_of_file_nodes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_nodes",
+	 number_of_file_nodes,
+	 5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_single_file_tree_get_number_of_file_nodes(
+	          NULL,
+	          &number_of_file_nodes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_file_tree_get_number_of_file_nodes(
+	          root_node,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_single_files_free(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( single_files != NULL )
+	{
+		libewf_single_files_free(
+		 &single_files,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 /* The main program
@@ -859,6 +1319,14 @@ int main(
 	 "libewf_single_file_tree_get_sub_node_by_utf16_name",
 	 ewf_test_single_file_tree_get_sub_node_by_utf16_name );
 
+	EWF_TEST_RUN(
+	 "libewf_single_file_tree_get_utf8_path",
+	 ewf_test_single_file_tree_get_utf8_path );
+
+	EWF_TEST_RUN(
+	 "libewf_single_file_tree_get_number_of_file_nodes",
+	 ewf_test_single_file_tree_get_number_of_file_nodes );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
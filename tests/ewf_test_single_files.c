@@ -35,6 +35,8 @@
 #include "ewf_test_memory.h"
 #include "ewf_test_unused.h"
 
+#include "../libewf/libewf_lef_file_entry.h"
+#include "../libewf/libewf_line_reader.h"
 #include "../libewf/libewf_single_files.h"
 
 /* UTF-16 little-endian encoded single files data
@@ -1111,18 +1113,18 @@ int ewf_test_single_files_parse_line(
      void )
 {
 	libcerror_error_t *error             = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	uint8_t *line_string                 = NULL;
 	size_t line_string_size              = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1131,8 +1133,8 @@ int ewf_test_single_files_parse_line(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1141,7 +1143,7 @@ int ewf_test_single_files_parse_line(
 	/* Test regular cases
 	 */
 	result = libewf_single_files_parse_line(
-	          lines,
+	          line_reader,
 	          1,
 	          &line_string,
 	          &line_string_size,
@@ -1178,7 +1180,7 @@ int ewf_test_single_files_parse_line(
 	 &error );
 
 	result = libewf_single_files_parse_line(
-	          lines,
+	          line_reader,
 	          -1,
 	          &line_string,
 	          &line_string_size,
@@ -1197,7 +1199,7 @@ int ewf_test_single_files_parse_line(
 	 &error );
 
 	result = libewf_single_files_parse_line(
-	          lines,
+	          line_reader,
 	          1,
 	          NULL,
 	          &line_string_size,
@@ -1216,7 +1218,7 @@ int ewf_test_single_files_parse_line(
 	 &error );
 
 	result = libewf_single_files_parse_line(
-	          lines,
+	          line_reader,
 	          1,
 	          &line_string,
 	          NULL,
@@ -1236,8 +1238,8 @@ int ewf_test_single_files_parse_line(
 
 	/* Clean up
 	 */
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1246,8 +1248,8 @@ int ewf_test_single_files_parse_line(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -1257,10 +1259,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( 0 );
@@ -1273,18 +1275,18 @@ int ewf_test_single_files_parse_category_number_of_entries(
      void )
 {
 	libcerror_error_t *error             = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	int line_index                       = 0;
 	int number_of_entries                = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1293,8 +1295,8 @@ int ewf_test_single_files_parse_category_number_of_entries(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1305,7 +1307,7 @@ int ewf_test_single_files_parse_category_number_of_entries(
 	line_index = 6;
 
 	result = libewf_single_files_parse_category_number_of_entries(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &number_of_entries,
 	          &error );
@@ -1342,7 +1344,7 @@ int ewf_test_single_files_parse_category_number_of_entries(
 	 &error );
 
 	result = libewf_single_files_parse_category_number_of_entries(
-	          lines,
+	          line_reader,
 	          NULL,
 	          &number_of_entries,
 	          &error );
@@ -1360,7 +1362,7 @@ int ewf_test_single_files_parse_category_number_of_entries(
 	 &error );
 
 	result = libewf_single_files_parse_category_number_of_entries(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          NULL,
 	          &error );
@@ -1379,8 +1381,8 @@ int ewf_test_single_files_parse_category_number_of_entries(
 
 	/* Clean up
 	 */
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1389,8 +1391,8 @@ int ewf_test_single_files_parse_category_number_of_entries(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -1400,10 +1402,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( 0 );
@@ -1416,18 +1418,18 @@ int ewf_test_single_files_parse_category_types(
      void )
 {
 	libcerror_error_t *error             = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	libfvalue_split_utf8_string_t *types = NULL;
 	int line_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1436,8 +1438,8 @@ int ewf_test_single_files_parse_category_types(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1448,7 +1450,7 @@ int ewf_test_single_files_parse_category_types(
 	line_index = 7;
 
 	result = libewf_single_files_parse_category_types(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &types,
 	          &error );
@@ -1500,7 +1502,7 @@ int ewf_test_single_files_parse_category_types(
 	 &error );
 
 	result = libewf_single_files_parse_category_types(
-	          lines,
+	          line_reader,
 	          NULL,
 	          &types,
 	          &error );
@@ -1518,7 +1520,7 @@ int ewf_test_single_files_parse_category_types(
 	 &error );
 
 	result = libewf_single_files_parse_category_types(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          NULL,
 	          &error );
@@ -1537,8 +1539,8 @@ int ewf_test_single_files_parse_category_types(
 
 	/* Clean up
 	 */
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1547,8 +1549,8 @@ int ewf_test_single_files_parse_category_types(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -1564,10 +1566,10 @@ on_error:
 		 &types,
 		 NULL );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( 0 );
@@ -1580,18 +1582,18 @@ int ewf_test_single_files_parse_number_of_entries(
      void )
 {
 	libcerror_error_t *error             = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	int line_index                       = 0;
 	int number_of_entries                = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1600,8 +1602,8 @@ int ewf_test_single_files_parse_number_of_entries(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1612,7 +1614,7 @@ int ewf_test_single_files_parse_number_of_entries(
 	line_index = 8;
 
 	result = libewf_single_files_parse_number_of_entries(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &number_of_entries,
 	          &error );
@@ -1649,7 +1651,7 @@ int ewf_test_single_files_parse_number_of_entries(
 	 &error );
 
 	result = libewf_single_files_parse_number_of_entries(
-	          lines,
+	          line_reader,
 	          NULL,
 	          &number_of_entries,
 	          &error );
@@ -1667,7 +1669,7 @@ int ewf_test_single_files_parse_number_of_entries(
 	 &error );
 
 	result = libewf_single_files_parse_number_of_entries(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          NULL,
 	          &error );
@@ -1686,8 +1688,8 @@ int ewf_test_single_files_parse_number_of_entries(
 
 	/* Clean up
 	 */
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1696,8 +1698,8 @@ int ewf_test_single_files_parse_number_of_entries(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -1707,10 +1709,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( 0 );
@@ -1723,7 +1725,7 @@ int ewf_test_single_files_parse_format(
      void )
 {
 	libcerror_error_t *error             = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	libfvalue_split_utf8_string_t *types = NULL;
 	uint8_t format                       = 0;
 	int line_index                       = 0;
@@ -1731,11 +1733,11 @@ int ewf_test_single_files_parse_format(
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1744,8 +1746,8 @@ int ewf_test_single_files_parse_format(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1754,7 +1756,7 @@ int ewf_test_single_files_parse_format(
 	line_index = 7;
 
 	result = libewf_single_files_parse_category_types(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &types,
 	          &error );
@@ -1835,8 +1837,8 @@ int ewf_test_single_files_parse_format(
 	 "types",
 	 types );
 
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1845,8 +1847,8 @@ int ewf_test_single_files_parse_format(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -1862,10 +1864,10 @@ on_error:
 		 &types,
 		 NULL );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( 0 );
@@ -1879,18 +1881,18 @@ int ewf_test_single_files_parse_rec_category(
 {
 	libcerror_error_t *error             = NULL;
 	libewf_single_files_t *single_files  = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	size64_t media_size                  = 0;
 	int line_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1899,8 +1901,8 @@ int ewf_test_single_files_parse_rec_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1929,7 +1931,7 @@ int ewf_test_single_files_parse_rec_category(
 
 	result = libewf_single_files_parse_rec_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &media_size,
 	          &error );
@@ -1949,7 +1951,7 @@ int ewf_test_single_files_parse_rec_category(
 
 	result = libewf_single_files_parse_rec_category(
 	          NULL,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &media_size,
 	          &error );
@@ -1987,7 +1989,7 @@ int ewf_test_single_files_parse_rec_category(
 
 	result = libewf_single_files_parse_rec_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          NULL,
 	          &media_size,
 	          &error );
@@ -2006,7 +2008,7 @@ int ewf_test_single_files_parse_rec_category(
 
 	result = libewf_single_files_parse_rec_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          NULL,
 	          &error );
@@ -2029,7 +2031,7 @@ int ewf_test_single_files_parse_rec_category(
 
 	result = libewf_single_files_parse_rec_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &media_size,
 	          &error );
@@ -2065,8 +2067,8 @@ int ewf_test_single_files_parse_rec_category(
 	 "error",
 	 error );
 
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2075,8 +2077,8 @@ int ewf_test_single_files_parse_rec_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -2086,10 +2088,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	if( single_files != NULL )
@@ -2108,18 +2110,18 @@ int ewf_test_single_files_parse_record_values(
      void )
 {
 	libcerror_error_t *error             = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	size64_t media_size                  = 0;
 	int line_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2128,8 +2130,8 @@ int ewf_test_single_files_parse_record_values(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2140,7 +2142,7 @@ int ewf_test_single_files_parse_record_values(
 	line_index = 2;
 
 	result = libewf_single_files_parse_record_values(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &media_size,
 	          &error );
@@ -2177,7 +2179,7 @@ int ewf_test_single_files_parse_record_values(
 	 &error );
 
 	result = libewf_single_files_parse_record_values(
-	          lines,
+	          line_reader,
 	          NULL,
 	          &media_size,
 	          &error );
@@ -2195,7 +2197,7 @@ int ewf_test_single_files_parse_record_values(
 	 &error );
 
 	result = libewf_single_files_parse_record_values(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          NULL,
 	          &error );
@@ -2214,8 +2216,8 @@ int ewf_test_single_files_parse_record_values(
 
 	/* Clean up
 	 */
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2224,8 +2226,8 @@ int ewf_test_single_files_parse_record_values(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -2235,10 +2237,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( 0 );
@@ -2252,17 +2254,17 @@ int ewf_test_single_files_parse_perm_category(
 {
 	libcerror_error_t *error             = NULL;
 	libewf_single_files_t *single_files  = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	int line_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2271,8 +2273,8 @@ int ewf_test_single_files_parse_perm_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2301,7 +2303,7 @@ int ewf_test_single_files_parse_perm_category(
 
 	result = libewf_single_files_parse_perm_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &error );
 
@@ -2320,7 +2322,7 @@ int ewf_test_single_files_parse_perm_category(
 
 	result = libewf_single_files_parse_perm_category(
 	          NULL,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &error );
 
@@ -2356,7 +2358,7 @@ int ewf_test_single_files_parse_perm_category(
 
 	result = libewf_single_files_parse_perm_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          NULL,
 	          &error );
 
@@ -2391,8 +2393,8 @@ int ewf_test_single_files_parse_perm_category(
 	 "error",
 	 error );
 
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2401,8 +2403,8 @@ int ewf_test_single_files_parse_perm_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -2412,10 +2414,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	if( single_files != NULL )
@@ -2436,18 +2438,18 @@ int ewf_test_single_files_parse_permission_group(
 	libcerror_error_t *error                    = NULL;
 	libewf_permission_group_t *permission_group = NULL;
 	libewf_single_files_t *single_files         = NULL;
-	libfvalue_split_utf8_string_t *lines        = NULL;
+	libewf_line_reader_t *line_reader           = NULL;
 	libfvalue_split_utf8_string_t *types        = NULL;
 	int line_index                              = 0;
 	int result                                  = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2456,8 +2458,8 @@ int ewf_test_single_files_parse_permission_group(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2490,7 +2492,7 @@ int ewf_test_single_files_parse_permission_group(
 
 	result = libewf_single_files_parse_permission_group(
 	          single_files,
-	          lines,
+	          line_reader,
 	          types,
 	          &line_index,
 	          permission_group,
@@ -2510,7 +2512,7 @@ int ewf_test_single_files_parse_permission_group(
 
 	result = libewf_single_files_parse_permission_group(
 	          NULL,
-	          lines,
+	          line_reader,
 	          types,
 	          NULL,
 	          permission_group,
@@ -2547,8 +2549,8 @@ int ewf_test_single_files_parse_permission_group(
 	 "error",
 	 error );
 
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2557,8 +2559,8 @@ int ewf_test_single_files_parse_permission_group(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -2568,10 +2570,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	if( single_files != NULL )
@@ -2591,17 +2593,17 @@ int ewf_test_single_files_parse_srce_category(
 {
 	libcerror_error_t *error             = NULL;
 	libewf_single_files_t *single_files  = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	int line_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2610,8 +2612,8 @@ int ewf_test_single_files_parse_srce_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2640,7 +2642,7 @@ int ewf_test_single_files_parse_srce_category(
 
 	result = libewf_single_files_parse_srce_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &error );
 
@@ -2659,7 +2661,7 @@ int ewf_test_single_files_parse_srce_category(
 
 	result = libewf_single_files_parse_srce_category(
 	          NULL,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &error );
 
@@ -2695,7 +2697,7 @@ int ewf_test_single_files_parse_srce_category(
 
 	result = libewf_single_files_parse_srce_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          NULL,
 	          &error );
 
@@ -2730,8 +2732,8 @@ int ewf_test_single_files_parse_srce_category(
 	 "error",
 	 error );
 
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2740,8 +2742,8 @@ int ewf_test_single_files_parse_srce_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -2751,10 +2753,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	if( single_files != NULL )
@@ -2774,17 +2776,17 @@ int ewf_test_single_files_parse_sub_category(
 {
 	libcerror_error_t *error             = NULL;
 	libewf_single_files_t *single_files  = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	int line_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2793,8 +2795,8 @@ int ewf_test_single_files_parse_sub_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2823,7 +2825,7 @@ int ewf_test_single_files_parse_sub_category(
 
 	result = libewf_single_files_parse_sub_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &error );
 
@@ -2842,7 +2844,7 @@ int ewf_test_single_files_parse_sub_category(
 
 	result = libewf_single_files_parse_sub_category(
 	          NULL,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &error );
 
@@ -2878,7 +2880,7 @@ int ewf_test_single_files_parse_sub_category(
 
 	result = libewf_single_files_parse_sub_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          NULL,
 	          &error );
 
@@ -2913,8 +2915,8 @@ int ewf_test_single_files_parse_sub_category(
 	 "error",
 	 error );
 
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2923,8 +2925,8 @@ int ewf_test_single_files_parse_sub_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -2934,10 +2936,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	if( single_files != NULL )
@@ -2957,18 +2959,18 @@ int ewf_test_single_files_parse_entry_category(
 {
 	libcerror_error_t *error             = NULL;
 	libewf_single_files_t *single_files  = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	uint8_t format                       = 0;
 	int line_index                       = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2977,8 +2979,8 @@ int ewf_test_single_files_parse_entry_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3007,7 +3009,7 @@ int ewf_test_single_files_parse_entry_category(
 
 	result = libewf_single_files_parse_entry_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &format,
 	          &error );
@@ -3027,7 +3029,7 @@ int ewf_test_single_files_parse_entry_category(
 
 	result = libewf_single_files_parse_entry_category(
 	          NULL,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &format,
 	          &error );
@@ -3065,7 +3067,7 @@ int ewf_test_single_files_parse_entry_category(
 
 	result = libewf_single_files_parse_entry_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          NULL,
 	          &format,
 	          &error );
@@ -3084,7 +3086,7 @@ int ewf_test_single_files_parse_entry_category(
 
 	result = libewf_single_files_parse_entry_category(
 	          single_files,
-	          lines,
+	          line_reader,
 	          &line_index,
 	          NULL,
 	          &error );
@@ -3120,8 +3122,8 @@ int ewf_test_single_files_parse_entry_category(
 	 "error",
 	 error );
 
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -3130,8 +3132,8 @@ int ewf_test_single_files_parse_entry_category(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -3141,10 +3143,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	if( single_files != NULL )
@@ -3163,18 +3165,18 @@ int ewf_test_single_files_parse_file_entry_number_of_sub_entries(
      void )
 {
 	libcerror_error_t *error             = NULL;
-	libfvalue_split_utf8_string_t *lines = NULL;
+	libewf_line_reader_t *line_reader    = NULL;
 	int line_index                       = 0;
 	int number_of_sub_entries            = 0;
 	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libfvalue_utf8_string_split(
+	result = libewf_line_reader_initialize(
+	          &line_reader,
 	          ewf_test_single_files_data2,
 	          2851,
-	          (uint8_t) '\n',
-	          &lines,
+	          LIBEWF_LINE_READER_ENCODING_UTF8,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -3183,8 +3185,8 @@ int ewf_test_single_files_parse_file_entry_number_of_sub_entries(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3195,7 +3197,7 @@ int ewf_test_single_files_parse_file_entry_number_of_sub_entries(
 	line_index = 36;
 
 	result = libewf_single_files_parse_file_entry_number_of_sub_entries(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          &number_of_sub_entries,
 	          &error );
@@ -3232,7 +3234,7 @@ int ewf_test_single_files_parse_file_entry_number_of_sub_entries(
 	 &error );
 
 	result = libewf_single_files_parse_file_entry_number_of_sub_entries(
-	          lines,
+	          line_reader,
 	          NULL,
 	          &number_of_sub_entries,
 	          &error );
@@ -3250,7 +3252,7 @@ int ewf_test_single_files_parse_file_entry_number_of_sub_entries(
 	 &error );
 
 	result = libewf_single_files_parse_file_entry_number_of_sub_entries(
-	          lines,
+	          line_reader,
 	          &line_index,
 	          NULL,
 	          &error );
@@ -3269,8 +3271,8 @@ int ewf_test_single_files_parse_file_entry_number_of_sub_entries(
 
 	/* Clean up
 	 */
-	result = libfvalue_split_utf8_string_free(
-	          &lines,
+	result = libewf_line_reader_free(
+	          &line_reader,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -3279,8 +3281,8 @@ int ewf_test_single_files_parse_file_entry_number_of_sub_entries(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NULL(
-	 "lines",
-	 lines );
+	 "line_reader",
+	 line_reader );
 
 	return( 1 );
 
@@ -3290,10 +3292,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( lines != NULL )
+	if( line_reader != NULL )
 	{
-		libfvalue_split_utf8_string_free(
-		 &lines,
+		libewf_line_reader_free(
+		 &line_reader,
 		 NULL );
 	}
 	return( 0 );
@@ -3856,6 +3858,381 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_single_files_get_number_of_media_order_file_nodes function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_get_number_of_media_order_file_nodes(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libewf_single_files_t *single_files = NULL;
+	size64_t media_size                 = 0;
+	uint8_t format                      = 0;
+	int number_of_file_nodes            = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_single_files_initialize(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_files_read_data(
+	          single_files,
+	          ewf_test_single_files_data1,
+	          5700,
+	          &media_size,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_single_files_get_number_of_media_order_file_nodes(
+	          single_files,
+	          &number_of_file_nodes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_nodes",
+	 number_of_file_nodes,
+	 5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_single_files_get_number_of_media_order_file_nodes(
+	          NULL,
+	          &number_of_file_nodes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_files_get_number_of_media_order_file_nodes(
+	          single_files,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_single_files_free(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( single_files != NULL )
+	{
+		libewf_single_files_free(
+		 &single_files,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_single_files_get_media_order_file_node_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_single_files_get_media_order_file_node_by_index(
+     void )
+{
+	int64_t expected_data_offsets[ 5 ]      = { 0x00000001, 0x00000015, 0x00001015, 0x00021015, 0x00021016 };
+
+	libcdata_tree_node_t *file_node         = NULL;
+	libcerror_error_t *error                = NULL;
+	libewf_lef_file_entry_t *lef_file_entry = NULL;
+	libewf_single_files_t *single_files     = NULL;
+	size64_t media_size                     = 0;
+	uint8_t format                          = 0;
+	int file_node_index                     = 0;
+	int number_of_file_nodes                = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_single_files_initialize(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_files_read_data(
+	          single_files,
+	          ewf_test_single_files_data1,
+	          5700,
+	          &media_size,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_single_files_get_number_of_media_order_file_nodes(
+	          single_files,
+	          &number_of_file_nodes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_nodes",
+	 number_of_file_nodes,
+	 5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( file_node_index = 0;
+	     file_node_index < number_of_file_nodes;
+	     file_node_index++ )
+	{
+		file_node = NULL;
+
+		result = libewf_single_files_get_media_order_file_node_by_index(
+		          single_files,
+		          file_node_index,
+		          &file_node,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "file_node",
+		 file_node );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_tree_node_get_value(
+		          file_node,
+		          (intptr_t **) &lef_file_entry,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "lef_file_entry",
+		 lef_file_entry );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_INT64(
+		 "lef_file_entry->data_offset",
+		 (int64_t) lef_file_entry->data_offset,
+		 expected_data_offsets[ file_node_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libewf_single_files_get_media_order_file_node_by_index(
+	          NULL,
+	          0,
+	          &file_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_files_get_media_order_file_node_by_index(
+	          single_files,
+	          -1,
+	          &file_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_files_get_media_order_file_node_by_index(
+	          single_files,
+	          number_of_file_nodes,
+	          &file_node,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_single_files_get_media_order_file_node_by_index(
+	          single_files,
+	          0,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_single_files_free(
+	          &single_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "single_files",
+	 single_files );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( single_files != NULL )
+	{
+		libewf_single_files_free(
+		 &single_files,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 /* The main program
@@ -3955,6 +4332,14 @@ int main(
 
 	/* TODO: add tests for libewf_single_files_get_source_by_index */
 
+	EWF_TEST_RUN(
+	 "libewf_single_files_get_number_of_media_order_file_nodes",
+	 ewf_test_single_files_get_number_of_media_order_file_nodes );
+
+	EWF_TEST_RUN(
+	 "libewf_single_files_get_media_order_file_node_by_index",
+	 ewf_test_single_files_get_media_order_file_node_by_index );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,977 @@
+/*
+ * Library string_pool type test program
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_string_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Tests the libewf_string_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_string_pool_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libewf_string_pool_t *string_pool = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_string_pool_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_pool = (libewf_string_pool_t *) 0x12345678UL;
+
+	result = libewf_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	string_pool = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_string_pool_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_string_pool_initialize(
+		          &string_pool,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( string_pool != NULL )
+			{
+				libewf_string_pool_free(
+				 &string_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "string_pool",
+			 string_pool );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_string_pool_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_string_pool_initialize(
+		          &string_pool,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( string_pool != NULL )
+			{
+				libewf_string_pool_free(
+				 &string_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "string_pool",
+			 string_pool );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libewf_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_string_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_string_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_string_pool_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_string_pool_append_block function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_string_pool_append_block(
+     void )
+{
+	uint8_t *blocks[ 40 ];
+
+	libcerror_error_t *error          = NULL;
+	libewf_string_pool_t *string_pool = NULL;
+	uint8_t *block                    = NULL;
+	uint8_t *string                   = NULL;
+	uint8_t *string_data1             = (uint8_t *) "sample.png";
+	size_t block_data_offset          = 0;
+	size_t string_size                = 0;
+	int block_index                   = 0;
+	int result                        = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_blocks              = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libewf_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          string_data1,
+	          11,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	block_data_offset = string_pool->block_data_offset;
+
+	/* Test regular cases
+	 */
+	for( block_index = 0;
+	     block_index < 40;
+	     block_index++ )
+	{
+		block = NULL;
+
+		result = libewf_string_pool_append_block(
+		          string_pool,
+		          (size_t) ( block_index + 1 ),
+		          &block,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "block",
+		 block );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		memory_set(
+		 block,
+		 block_index,
+		 (size_t) ( block_index + 1 ) );
+
+		blocks[ block_index ] = block;
+	}
+	/* The blocks array was grown more than once
+	 */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "string_pool->number_of_blocks",
+	 string_pool->number_of_blocks,
+	 41 );
+
+	EWF_TEST_ASSERT_GREATER_THAN_INT(
+	 "string_pool->allocated_number_of_blocks",
+	 string_pool->allocated_number_of_blocks,
+	 40 );
+
+	/* Test that blocks and strings remain at the same location after growth
+	 */
+	for( block_index = 0;
+	     block_index < 40;
+	     block_index++ )
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "blocks[ block_index ][ block_index ]",
+		 (int) blocks[ block_index ][ block_index ],
+		 block_index );
+
+		result = ( string_pool->blocks[ block_index + 1 ] == blocks[ block_index ] );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = ( string_pool->blocks[ 0 ] == string );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          string,
+	          string_data1,
+	          11 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that appending a block does not change the current block
+	 */
+	result = ( string_pool->current_block == string );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_pool->block_data_offset",
+	 string_pool->block_data_offset,
+	 block_data_offset );
+
+	/* Test error cases
+	 */
+	result = libewf_string_pool_append_block(
+	          NULL,
+	          16,
+	          &block,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_string_pool_append_block(
+	          string_pool,
+	          0,
+	          &block,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_string_pool_append_block(
+	          string_pool,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &block,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_string_pool_append_block(
+	          string_pool,
+	          16,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "string_pool->number_of_blocks",
+	 string_pool->number_of_blocks,
+	 41 );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test libewf_string_pool_append_block with malloc failing
+	 */
+	number_of_blocks = string_pool->number_of_blocks;
+
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = libewf_string_pool_append_block(
+	          string_pool,
+	          16,
+	          &block,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "string_pool->number_of_blocks",
+		 string_pool->number_of_blocks,
+		 number_of_blocks );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libewf_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libewf_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_string_pool_append_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_string_pool_append_string(
+     void )
+{
+	uint8_t large_data[ LIBEWF_STRING_POOL_BLOCK_SIZE ];
+
+	libcerror_error_t *error          = NULL;
+	libewf_string_pool_t *string_pool = NULL;
+	uint8_t *string                   = NULL;
+	uint8_t *string_data1             = (uint8_t *) "sample.png";
+	uint8_t *string1                  = NULL;
+	size_t string_size                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          string_data1,
+	          11,
+	          &string1,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "string1",
+	 string1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 11 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string1,
+	          string_data1,
+	          11 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a string without end of string character
+	 */
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          string_data1,
+	          10,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 11 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "string[ 10 ]",
+	 (int) string[ 10 ],
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "string_pool->number_of_blocks",
+	 string_pool->number_of_blocks,
+	 1 );
+
+	/* Test an empty string
+	 */
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          (uint8_t *) "",
+	          0,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "string[ 0 ]",
+	 (int) string[ 0 ],
+	 0 );
+
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          (uint8_t *) "",
+	          1,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "string[ 0 ]",
+	 (int) string[ 0 ],
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_pool->block_data_offset",
+	 string_pool->block_data_offset,
+	 (size_t) 24 );
+
+	/* Test a large string that is stored in a block of its own
+	 */
+	memory_set(
+	 large_data,
+	 (int) 'A',
+	 LIBEWF_STRING_POOL_BLOCK_SIZE );
+
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          large_data,
+	          LIBEWF_STRING_POOL_BLOCK_SIZE,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) LIBEWF_STRING_POOL_BLOCK_SIZE + 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "string_pool->number_of_blocks",
+	 string_pool->number_of_blocks,
+	 2 );
+
+	/* Test that previously appended strings remain valid
+	 */
+	result = memory_compare(
+	          string1,
+	          string_data1,
+	          11 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_string_pool_append_string(
+	          NULL,
+	          string_data1,
+	          11,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          NULL,
+	          11,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          string_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          string_data1,
+	          11,
+	          NULL,
+	          &string_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_string_pool_append_string(
+	          string_pool,
+	          string_data1,
+	          11,
+	          &string,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libewf_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_string_pool_initialize",
+	 ewf_test_string_pool_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_string_pool_free",
+	 ewf_test_string_pool_free );
+
+	EWF_TEST_RUN(
+	 "libewf_string_pool_append_block",
+	 ewf_test_string_pool_append_block );
+
+	EWF_TEST_RUN(
+	 "libewf_string_pool_append_string",
+	 ewf_test_string_pool_append_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,809 @@
+/*
+ * Tools chunk_hash_map functions test program
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <system_string.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/chunk_hash_map.h"
+#include "../ewftools/ewftools_libhmac.h"
+
+#define EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE	64
+#define EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE		160
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define ewf_test_tools_chunk_hash_map_remove_file( filename ) \
+	_wremove( filename )
+#else
+#define ewf_test_tools_chunk_hash_map_remove_file( filename ) \
+	remove( filename )
+#endif
+
+/* Fills the test data with a byte pattern that differs per region
+ */
+void ewf_test_tools_chunk_hash_map_set_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) & 0xff );
+	}
+}
+
+/* Tests the chunk_hash_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_chunk_hash_map_initialize(
+     void )
+{
+	chunk_hash_map_t *chunk_hash_map = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = chunk_hash_map_initialize(
+	          &chunk_hash_map,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_hash_map",
+	 chunk_hash_map );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = chunk_hash_map_free(
+	          &chunk_hash_map,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_hash_map",
+	 chunk_hash_map );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = chunk_hash_map_initialize(
+	          NULL,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_hash_map = (chunk_hash_map_t *) 0x12345678UL;
+
+	result = chunk_hash_map_initialize(
+	          &chunk_hash_map,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE,
+	          &error );
+
+	chunk_hash_map = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_initialize(
+	          &chunk_hash_map,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_hash_map != NULL )
+	{
+		chunk_hash_map_free(
+		 &chunk_hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the chunk_hash_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_chunk_hash_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = chunk_hash_map_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the chunk_hash_map_update and chunk_hash_map_finalize functions
+ * The data is updated in parts that cross the region boundaries
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_chunk_hash_map_update(
+     void )
+{
+	uint8_t data[ EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE ];
+	uint8_t digest_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	chunk_hash_map_t *chunk_hash_map = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t region_data_size          = 0;
+	size_t update_size               = 0;
+	uint64_t region_index            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	ewf_test_tools_chunk_hash_map_set_data(
+	 data,
+	 EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE );
+
+	result = chunk_hash_map_initialize(
+	          &chunk_hash_map,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_hash_map",
+	 chunk_hash_map );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	while( data_offset < EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE )
+	{
+		update_size = 50;
+
+		if( update_size > ( EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE - data_offset ) )
+		{
+			update_size = EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE - data_offset;
+		}
+		result = chunk_hash_map_update(
+		          chunk_hash_map,
+		          &( data[ data_offset ] ),
+		          update_size,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset += update_size;
+	}
+	/* The last region is only partially filled before finalize
+	 */
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_hash_map->number_of_regions",
+	 chunk_hash_map->number_of_regions,
+	 (uint64_t) 2 );
+
+	result = chunk_hash_map_finalize(
+	          chunk_hash_map,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_hash_map->number_of_regions",
+	 chunk_hash_map->number_of_regions,
+	 (uint64_t) 3 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_hash_map->media_size",
+	 (uint64_t) chunk_hash_map->media_size,
+	 (uint64_t) EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE );
+
+	/* Every region digest hash should match the digest hash of the region data
+	 */
+	for( region_index = 0;
+	     region_index < 3;
+	     region_index++ )
+	{
+		data_offset      = (size_t) region_index * EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE;
+		region_data_size = EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE;
+
+		if( region_data_size > ( EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE - data_offset ) )
+		{
+			region_data_size = EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE - data_offset;
+		}
+		result = libhmac_md5_calculate(
+		          &( data[ data_offset ] ),
+		          region_data_size,
+		          digest_hash,
+		          LIBHMAC_MD5_HASH_SIZE,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = chunk_hash_map_compare_digest_hash(
+		          chunk_hash_map,
+		          region_index,
+		          digest_hash,
+		          LIBHMAC_MD5_HASH_SIZE,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The digest hash of a different region should not match
+	 */
+	result = chunk_hash_map_compare_digest_hash(
+	          chunk_hash_map,
+	          0,
+	          digest_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = chunk_hash_map_update(
+	          NULL,
+	          data,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_update(
+	          chunk_hash_map,
+	          NULL,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_update(
+	          chunk_hash_map,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_finalize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_compare_digest_hash(
+	          chunk_hash_map,
+	          3,
+	          digest_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = chunk_hash_map_free(
+	          &chunk_hash_map,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_hash_map",
+	 chunk_hash_map );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_hash_map != NULL )
+	{
+		chunk_hash_map_free(
+		 &chunk_hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the chunk_hash_map_write_file and chunk_hash_map_read_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_chunk_hash_map_write_read_file(
+     void )
+{
+	uint8_t data[ EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE ];
+
+	chunk_hash_map_t *chunk_hash_map      = NULL;
+	chunk_hash_map_t *read_chunk_hash_map = NULL;
+	libcerror_error_t *error              = NULL;
+	system_character_t *filename          = _SYSTEM_STRING( "ewf_test_tools_chunk_hash_map.ewfhmap" );
+	int file_written                      = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	ewf_test_tools_chunk_hash_map_set_data(
+	 data,
+	 EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE );
+
+	result = chunk_hash_map_initialize(
+	          &chunk_hash_map,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_REGION_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = chunk_hash_map_update(
+	          chunk_hash_map,
+	          data,
+	          EWF_TEST_TOOLS_CHUNK_HASH_MAP_DATA_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = chunk_hash_map_finalize(
+	          chunk_hash_map,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = chunk_hash_map_write_file(
+	          chunk_hash_map,
+	          filename,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_written = 1;
+
+	result = chunk_hash_map_read_file(
+	          &read_chunk_hash_map,
+	          filename,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_chunk_hash_map",
+	 read_chunk_hash_map );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "read_chunk_hash_map->region_size",
+	 (uint64_t) read_chunk_hash_map->region_size,
+	 (uint64_t) chunk_hash_map->region_size );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "read_chunk_hash_map->media_size",
+	 (uint64_t) read_chunk_hash_map->media_size,
+	 (uint64_t) chunk_hash_map->media_size );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "read_chunk_hash_map->number_of_regions",
+	 read_chunk_hash_map->number_of_regions,
+	 chunk_hash_map->number_of_regions );
+
+	result = memory_compare(
+	          read_chunk_hash_map->digest_hashes,
+	          chunk_hash_map->digest_hashes,
+	          (size_t) chunk_hash_map->number_of_regions * LIBHMAC_MD5_HASH_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = chunk_hash_map_free(
+	          &read_chunk_hash_map,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = chunk_hash_map_write_file(
+	          NULL,
+	          filename,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_write_file(
+	          chunk_hash_map,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_read_file(
+	          NULL,
+	          filename,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = chunk_hash_map_read_file(
+	          &read_chunk_hash_map,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	ewf_test_tools_chunk_hash_map_remove_file(
+	 filename );
+
+	file_written = 0;
+
+	result = chunk_hash_map_free(
+	          &chunk_hash_map,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_written != 0 )
+	{
+		ewf_test_tools_chunk_hash_map_remove_file(
+		 filename );
+	}
+	if( read_chunk_hash_map != NULL )
+	{
+		chunk_hash_map_free(
+		 &read_chunk_hash_map,
+		 NULL );
+	}
+	if( chunk_hash_map != NULL )
+	{
+		chunk_hash_map_free(
+		 &chunk_hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EWF_TEST_RUN(
+	 "chunk_hash_map_initialize",
+	 ewf_test_tools_chunk_hash_map_initialize );
+
+	EWF_TEST_RUN(
+	 "chunk_hash_map_free",
+	 ewf_test_tools_chunk_hash_map_free );
+
+	EWF_TEST_RUN(
+	 "chunk_hash_map_update",
+	 ewf_test_tools_chunk_hash_map_update );
+
+	EWF_TEST_RUN(
+	 "chunk_hash_map_write_file",
+	 ewf_test_tools_chunk_hash_map_write_read_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,897 @@
+/*
+ * Tools digest_hash_threads functions test program
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <system_string.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/digest_hash_threads.h"
+#include "../ewftools/ewftools_libhmac.h"
+
+#define EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE	8192
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the digest_hash_threads_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_hash_threads_initialize(
+     void )
+{
+	digest_hash_threads_t *digest_hash_threads = NULL;
+	libcerror_error_t *error                   = NULL;
+	int result                                 = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_hash_threads_initialize(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_hash_threads",
+	 digest_hash_threads );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_threads_free(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "digest_hash_threads",
+	 digest_hash_threads );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_hash_threads_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	digest_hash_threads = (digest_hash_threads_t *) 0x12345678UL;
+
+	result = digest_hash_threads_initialize(
+	          &digest_hash_threads,
+	          &error );
+
+	digest_hash_threads = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_hash_threads != NULL )
+	{
+		digest_hash_threads_free(
+		 &digest_hash_threads,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_hash_threads_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_hash_threads_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_hash_threads_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_hash_threads_append_digest function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_hash_threads_append_digest(
+     void )
+{
+	digest_hash_threads_t *digest_hash_threads = NULL;
+	libcerror_error_t *error                   = NULL;
+	libhmac_md5_context_t *md5_context         = NULL;
+	int digest_index                           = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libhmac_md5_initialize(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_threads_initialize(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( digest_index = 0;
+	     digest_index < DIGEST_HASH_THREADS_MAXIMUM_NUMBER_OF_DIGESTS;
+	     digest_index++ )
+	{
+		result = digest_hash_threads_append_digest(
+		          digest_hash_threads,
+		          (intptr_t *) md5_context,
+		          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = digest_hash_threads_append_digest(
+	          digest_hash_threads,
+	          (intptr_t *) md5_context,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_threads_append_digest(
+	          NULL,
+	          (intptr_t *) md5_context,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_hash_threads_free(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_hash_threads_initialize(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_threads_append_digest(
+	          digest_hash_threads,
+	          NULL,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_threads_append_digest(
+	          digest_hash_threads,
+	          (intptr_t *) md5_context,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_hash_threads_free(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_free(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_hash_threads != NULL )
+	{
+		digest_hash_threads_free(
+		 &digest_hash_threads,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_hash_threads_update function
+ * The digest hashes calculated concurrently should match the sequentially calculated ones
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_hash_threads_update(
+     void )
+{
+	uint8_t data[ EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE ];
+	uint8_t expected_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t expected_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t expected_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	size_t update_sizes[ 4 ]                   = { 1, 4096, 511, 3584 };
+
+	digest_hash_threads_t *digest_hash_threads = NULL;
+	libcerror_error_t *error                   = NULL;
+	libhmac_md5_context_t *md5_context         = NULL;
+	libhmac_sha1_context_t *sha1_context       = NULL;
+	libhmac_sha256_context_t *sha256_context   = NULL;
+	size_t data_offset                         = 0;
+	int update_index                           = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) & 0xff );
+	}
+	result = libhmac_md5_calculate(
+	          data,
+	          EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE,
+	          expected_md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_calculate(
+	          data,
+	          EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE,
+	          expected_sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_calculate(
+	          data,
+	          EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE,
+	          expected_sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_initialize(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_initialize(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha256_initialize(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_threads_initialize(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_hash_threads_update(
+	          digest_hash_threads,
+	          data,
+	          EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = digest_hash_threads_append_digest(
+	          digest_hash_threads,
+	          (intptr_t *) md5_context,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_threads_append_digest(
+	          digest_hash_threads,
+	          (intptr_t *) sha1_context,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha1_update,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_threads_append_digest(
+	          digest_hash_threads,
+	          (intptr_t *) sha256_context,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha256_update,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 0;
+
+	for( update_index = 0;
+	     update_index < 4;
+	     update_index++ )
+	{
+		result = digest_hash_threads_update(
+		          digest_hash_threads,
+		          &( data[ data_offset ] ),
+		          update_sizes[ update_index ],
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset += update_sizes[ update_index ];
+	}
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE );
+
+	/* Test error cases
+	 */
+	result = digest_hash_threads_update(
+	          NULL,
+	          data,
+	          EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_threads_update(
+	          digest_hash_threads,
+	          NULL,
+	          EWF_TEST_TOOLS_DIGEST_HASH_THREADS_DATA_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_threads_update(
+	          digest_hash_threads,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The digest hash threads are freed before the digest hashes are finalized
+	 */
+	result = digest_hash_threads_free(
+	          &digest_hash_threads,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_finalize(
+	          md5_context,
+	          md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          md5_hash,
+	          expected_md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha1_finalize(
+	          sha1_context,
+	          sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          sha1_hash,
+	          expected_sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha256_finalize(
+	          sha256_context,
+	          sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          sha256_hash,
+	          expected_sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libhmac_sha256_free(
+	          &sha256_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_free(
+	          &sha1_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_md5_free(
+	          &md5_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_hash_threads != NULL )
+	{
+		digest_hash_threads_free(
+		 &digest_hash_threads,
+		 NULL );
+	}
+	if( sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	EWF_TEST_RUN(
+	 "digest_hash_threads_initialize",
+	 ewf_test_tools_digest_hash_threads_initialize );
+
+	EWF_TEST_RUN(
+	 "digest_hash_threads_free",
+	 ewf_test_tools_digest_hash_threads_free );
+
+	EWF_TEST_RUN(
+	 "digest_hash_threads_append_digest",
+	 ewf_test_tools_digest_hash_threads_append_digest );
+
+	EWF_TEST_RUN(
+	 "digest_hash_threads_update",
+	 ewf_test_tools_digest_hash_threads_update );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -0,0 +1,774 @@
+/*
+ * Tools mount_nbd functions test program
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <system_string.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_SOCKET_H )
+#include <sys/socket.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/mount_nbd.h"
+
+#if defined( HAVE_MOUNT_NBD )
+
+/* Writes data to a socket
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_mount_nbd_write_data(
+     int socket_descriptor,
+     const uint8_t *data,
+     size_t data_size )
+{
+	size_t data_offset  = 0;
+	ssize_t write_count = 0;
+
+	while( data_offset < data_size )
+	{
+		write_count = write(
+		               socket_descriptor,
+		               &( data[ data_offset ] ),
+		               data_size - data_offset );
+
+		if( write_count <= 0 )
+		{
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( 1 );
+}
+
+/* Reads data from a socket
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_mount_nbd_read_data(
+     int socket_descriptor,
+     uint8_t *data,
+     size_t data_size )
+{
+	size_t data_offset = 0;
+	ssize_t read_count = 0;
+
+	while( data_offset < data_size )
+	{
+		read_count = read(
+		              socket_descriptor,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset );
+
+		if( read_count <= 0 )
+		{
+			return( -1 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	return( 1 );
+}
+
+/* Writes an option with option data of zero bytes to a socket as a client
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_mount_nbd_write_option(
+     int socket_descriptor,
+     uint32_t option,
+     uint32_t option_data_size )
+{
+	uint8_t option_data[ 1024 ];
+	uint8_t option_header[ 16 ];
+
+	size_t write_size = 0;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( option_header[ 0 ] ),
+	 MOUNT_NBD_MAGIC_OPTION );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( option_header[ 8 ] ),
+	 option );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( option_header[ 12 ] ),
+	 option_data_size );
+
+	if( ewf_test_tools_mount_nbd_write_data(
+	     socket_descriptor,
+	     option_header,
+	     16 ) != 1 )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     option_data,
+	     0,
+	     1024 ) == NULL )
+	{
+		return( -1 );
+	}
+	while( option_data_size > 0 )
+	{
+		write_size = 1024;
+
+		if( write_size > (size_t) option_data_size )
+		{
+			write_size = (size_t) option_data_size;
+		}
+		if( ewf_test_tools_mount_nbd_write_data(
+		     socket_descriptor,
+		     option_data,
+		     write_size ) != 1 )
+		{
+			return( -1 );
+		}
+		option_data_size -= (uint32_t) write_size;
+	}
+	return( 1 );
+}
+
+/* Reads an option reply from a socket as a client
+ * The reply data is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_mount_nbd_read_option_reply(
+     int socket_descriptor,
+     uint32_t *option,
+     uint32_t *reply_type )
+{
+	uint8_t reply_data[ 64 ];
+	uint8_t reply_header[ 20 ];
+
+	uint64_t magic           = 0;
+	uint32_t reply_data_size = 0;
+
+	if( ewf_test_tools_mount_nbd_read_data(
+	     socket_descriptor,
+	     reply_header,
+	     20 ) != 1 )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 &( reply_header[ 0 ] ),
+	 magic );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( reply_header[ 8 ] ),
+	 *option );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( reply_header[ 12 ] ),
+	 *reply_type );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( reply_header[ 16 ] ),
+	 reply_data_size );
+
+	if( ( magic != MOUNT_NBD_MAGIC_OPTION_REPLY )
+	 || ( reply_data_size > 64 ) )
+	{
+		return( -1 );
+	}
+	if( reply_data_size > 0 )
+	{
+		if( ewf_test_tools_mount_nbd_read_data(
+		     socket_descriptor,
+		     reply_data,
+		     (size_t) reply_data_size ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the mount_nbd_connection_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_mount_nbd_connection_initialize(
+     void )
+{
+	mount_nbd_server_t server;
+	int socket_descriptors[ 2 ] = { -1, -1 };
+
+	libcerror_error_t *error           = NULL;
+	mount_nbd_connection_t *connection = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &server,
+	          0,
+	          sizeof( mount_nbd_server_t ) ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	server.socket_descriptor = -1;
+
+	result = socketpair(
+	          AF_UNIX,
+	          SOCK_STREAM,
+	          0,
+	          socket_descriptors );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = mount_nbd_connection_initialize(
+	          &connection,
+	          &server,
+	          socket_descriptors[ 0 ],
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "connection",
+	 connection );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The connection takes over the socket descriptor
+	 */
+	socket_descriptors[ 0 ] = -1;
+
+	result = mount_nbd_connection_free(
+	          &connection,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "connection",
+	 connection );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_nbd_connection_initialize(
+	          NULL,
+	          &server,
+	          socket_descriptors[ 1 ],
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_nbd_connection_initialize(
+	          &connection,
+	          NULL,
+	          socket_descriptors[ 1 ],
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_nbd_connection_initialize(
+	          &connection,
+	          &server,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	close(
+	 socket_descriptors[ 1 ] );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( connection != NULL )
+	{
+		mount_nbd_connection_free(
+		 &connection,
+		 NULL );
+	}
+	if( socket_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 0 ] );
+	}
+	if( socket_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 1 ] );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_nbd_connection_negotiate function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_mount_nbd_connection_negotiate(
+     void )
+{
+	uint8_t data[ 18 ];
+
+	mount_nbd_server_t server;
+	int socket_descriptors[ 2 ] = { -1, -1 };
+
+	libcerror_error_t *error           = NULL;
+	mount_nbd_connection_t *connection = NULL;
+	uint64_t value_64bit               = 0;
+	uint32_t option                    = 0;
+	uint32_t reply_type                = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &server,
+	          0,
+	          sizeof( mount_nbd_server_t ) ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	server.media_size        = 1048576;
+	server.socket_descriptor = -1;
+
+	result = socketpair(
+	          AF_UNIX,
+	          SOCK_STREAM,
+	          0,
+	          socket_descriptors );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mount_nbd_connection_initialize(
+	          &connection,
+	          &server,
+	          socket_descriptors[ 0 ],
+	          &error );
+
+	socket_descriptors[ 0 ] = -1;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that option data that exceeds the option data buffer is rejected
+	 * and the negotiation continues
+	 */
+	byte_stream_copy_from_uint32_big_endian(
+	 data,
+	 MOUNT_NBD_HANDSHAKE_FLAG_FIXED_NEWSTYLE | MOUNT_NBD_HANDSHAKE_FLAG_NO_ZEROES );
+
+	result = ewf_test_tools_mount_nbd_write_data(
+	          socket_descriptors[ 1 ],
+	          data,
+	          4 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = ewf_test_tools_mount_nbd_write_option(
+	          socket_descriptors[ 1 ],
+	          MOUNT_NBD_OPTION_LIST,
+	          8192 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = ewf_test_tools_mount_nbd_write_option(
+	          socket_descriptors[ 1 ],
+	          MOUNT_NBD_OPTION_ABORT,
+	          0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = mount_nbd_connection_negotiate(
+	          connection,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_tools_mount_nbd_read_data(
+	          socket_descriptors[ 1 ],
+	          data,
+	          18 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 data,
+	 value_64bit );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) MOUNT_NBD_MAGIC_INIT_PASSWORD );
+
+	result = ewf_test_tools_mount_nbd_read_option_reply(
+	          socket_descriptors[ 1 ],
+	          &option,
+	          &reply_type );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "option",
+	 option,
+	 (uint32_t) MOUNT_NBD_OPTION_LIST );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "reply_type",
+	 reply_type,
+	 (uint32_t) MOUNT_NBD_OPTION_REPLY_ERROR_TOO_BIG );
+
+	result = ewf_test_tools_mount_nbd_read_option_reply(
+	          socket_descriptors[ 1 ],
+	          &option,
+	          &reply_type );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "option",
+	 option,
+	 (uint32_t) MOUNT_NBD_OPTION_ABORT );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "reply_type",
+	 reply_type,
+	 (uint32_t) MOUNT_NBD_OPTION_REPLY_ACK );
+
+	result = mount_nbd_connection_free(
+	          &connection,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	close(
+	 socket_descriptors[ 1 ] );
+
+	socket_descriptors[ 1 ] = -1;
+
+	/* Test that the export name option data that exceeds the option data buffer
+	 * is ignored and the export data is returned
+	 */
+	result = socketpair(
+	          AF_UNIX,
+	          SOCK_STREAM,
+	          0,
+	          socket_descriptors );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mount_nbd_connection_initialize(
+	          &connection,
+	          &server,
+	          socket_descriptors[ 0 ],
+	          &error );
+
+	socket_descriptors[ 0 ] = -1;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 data,
+	 MOUNT_NBD_HANDSHAKE_FLAG_FIXED_NEWSTYLE | MOUNT_NBD_HANDSHAKE_FLAG_NO_ZEROES );
+
+	result = ewf_test_tools_mount_nbd_write_data(
+	          socket_descriptors[ 1 ],
+	          data,
+	          4 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = ewf_test_tools_mount_nbd_write_option(
+	          socket_descriptors[ 1 ],
+	          MOUNT_NBD_OPTION_EXPORT_NAME,
+	          5000 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = mount_nbd_connection_negotiate(
+	          connection,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_tools_mount_nbd_read_data(
+	          socket_descriptors[ 1 ],
+	          data,
+	          18 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = ewf_test_tools_mount_nbd_read_data(
+	          socket_descriptors[ 1 ],
+	          data,
+	          10 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 data,
+	 value_64bit );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 1048576 );
+
+	/* Test error cases
+	 */
+	result = mount_nbd_connection_negotiate(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mount_nbd_connection_free(
+	          &connection,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	close(
+	 socket_descriptors[ 1 ] );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( connection != NULL )
+	{
+		mount_nbd_connection_free(
+		 &connection,
+		 NULL );
+	}
+	if( socket_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 0 ] );
+	}
+	if( socket_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 1 ] );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MOUNT_NBD ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MOUNT_NBD )
+
+	EWF_TEST_RUN(
+	 "mount_nbd_connection_initialize",
+	 ewf_test_tools_mount_nbd_connection_initialize );
+
+	EWF_TEST_RUN(
+	 "mount_nbd_connection_negotiate",
+	 ewf_test_tools_mount_nbd_connection_negotiate );
+
+#endif /* defined( HAVE_MOUNT_NBD ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MOUNT_NBD )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MOUNT_NBD ) */
+}
+
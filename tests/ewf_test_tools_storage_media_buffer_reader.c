@@ -0,0 +1,1211 @@
+/*
+ * Tools storage_media_buffer_reader functions test program
+ *
+ * Copyright (C) 2006-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <system_string.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/ewftools_libcthreads.h"
+#include "../ewftools/storage_media_buffer.h"
+#include "../ewftools/storage_media_buffer_queue.h"
+#include "../ewftools/storage_media_buffer_reader.h"
+
+#define EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE	4096
+#define EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE	10000
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct ewf_test_tools_input ewf_test_tools_input_t;
+
+/* The input the test read function reads from
+ */
+struct ewf_test_tools_input
+{
+	/* The data
+	 */
+	uint8_t data[ EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE ];
+
+	/* The offset from which reading fails, where -1 represents never
+	 */
+	off64_t error_offset;
+};
+
+/* Reads data from the test input into a storage media buffer
+ * Returns the number of bytes read, 0 at the end of the input or -1 on error
+ */
+ssize_t ewf_test_tools_input_read(
+         ewf_test_tools_input_t *input,
+         storage_media_buffer_t *storage_media_buffer,
+         off64_t storage_media_offset,
+         size_t read_size,
+         libcerror_error_t **error )
+{
+	static char *function = "ewf_test_tools_input_read";
+
+	if( ( input == NULL )
+	 || ( storage_media_buffer == NULL )
+	 || ( read_size > storage_media_buffer->raw_buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid argument.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input->error_offset >= 0 )
+	 && ( storage_media_offset >= input->error_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read at offset: %" PRIi64 ".",
+		 function,
+		 storage_media_offset );
+
+		return( -1 );
+	}
+	if( storage_media_offset >= (off64_t) EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE )
+	{
+		return( 0 );
+	}
+	if( read_size > (size_t) ( EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE - storage_media_offset ) )
+	{
+		read_size = (size_t) ( EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE - storage_media_offset );
+	}
+	if( memory_copy(
+	     storage_media_buffer->raw_buffer,
+	     &( input->data[ storage_media_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	storage_media_buffer->storage_media_offset = storage_media_offset;
+	storage_media_buffer->raw_buffer_data_size = read_size;
+
+	return( (ssize_t) read_size );
+}
+
+/* Initializes the test input
+ */
+void ewf_test_tools_input_set_data(
+      ewf_test_tools_input_t *input )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE;
+	     data_offset++ )
+	{
+		input->data[ data_offset ] = (uint8_t) ( ( data_offset * 3 ) & 0xff );
+	}
+	input->error_offset = -1;
+}
+
+/* Grabs the storage media buffers from the reader until the end of the input
+ * The data of every storage media buffer is compared with the test input and the
+ * storage media buffers are released onto the storage media buffer queue
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_storage_media_buffer_reader_grab_all(
+     storage_media_buffer_reader_t *reader,
+     libcthreads_queue_t *storage_media_buffer_queue,
+     ewf_test_tools_input_t *input,
+     off64_t *storage_media_offset,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "ewf_test_tools_storage_media_buffer_reader_grab_all";
+	int result                                   = 0;
+
+	do
+	{
+		result = storage_media_buffer_reader_grab_buffer(
+		          reader,
+		          &storage_media_buffer,
+		          error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		if( ( storage_media_buffer->storage_media_offset != *storage_media_offset )
+		 || ( memory_compare(
+		       storage_media_buffer->raw_buffer,
+		       &( input->data[ *storage_media_offset ] ),
+		       storage_media_buffer->raw_buffer_data_size ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unexpected storage media buffer data.",
+			 function );
+
+			result = -1;
+		}
+		*storage_media_offset += storage_media_buffer->raw_buffer_data_size;
+
+		if( storage_media_buffer_queue_release_buffer(
+		     storage_media_buffer_queue,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+		storage_media_buffer = NULL;
+	}
+	while( result == 1 );
+
+	return( result );
+}
+
+/* Tests the storage_media_buffer_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_reader_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libcthreads_queue_t *storage_media_buffer_queue = NULL;
+	storage_media_buffer_reader_t *reader           = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = storage_media_buffer_queue_initialize(
+	          &storage_media_buffer_queue,
+	          NULL,
+	          4,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = storage_media_buffer_reader_initialize(
+	          &reader,
+	          storage_media_buffer_queue,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "reader",
+	 reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_reader_free(
+	          &reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "reader",
+	 reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_reader_initialize(
+	          NULL,
+	          storage_media_buffer_queue,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	reader = (storage_media_buffer_reader_t *) 0x12345678UL;
+
+	result = storage_media_buffer_reader_initialize(
+	          &reader,
+	          storage_media_buffer_queue,
+	          4,
+	          &error );
+
+	reader = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_initialize(
+	          &reader,
+	          NULL,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_initialize(
+	          &reader,
+	          storage_media_buffer_queue,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_queue_free(
+	          &storage_media_buffer_queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reader != NULL )
+	{
+		storage_media_buffer_reader_free(
+		 &reader,
+		 NULL );
+	}
+	if( storage_media_buffer_queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &storage_media_buffer_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_reader_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_reader_grab_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_reader_grab_buffer(
+     void )
+{
+	ewf_test_tools_input_t input;
+
+	libcerror_error_t *error                        = NULL;
+	libcthreads_queue_t *storage_media_buffer_queue = NULL;
+	storage_media_buffer_t *storage_media_buffer    = NULL;
+	storage_media_buffer_reader_t *reader           = NULL;
+	off64_t storage_media_offset                    = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	ewf_test_tools_input_set_data(
+	 &input );
+
+	result = storage_media_buffer_queue_initialize(
+	          &storage_media_buffer_queue,
+	          NULL,
+	          2,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_reader_initialize(
+	          &reader,
+	          storage_media_buffer_queue,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_reader_grab_buffer(
+	          reader,
+	          &storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading until the end of the input
+	 */
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          0,
+	          EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	storage_media_offset = 0;
+
+	result = ewf_test_tools_storage_media_buffer_reader_grab_all(
+	          reader,
+	          storage_media_buffer_queue,
+	          &input,
+	          &storage_media_offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "storage_media_offset",
+	 (int64_t) storage_media_offset,
+	 (int64_t) EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The end of input remains signalled after it was reached
+	 */
+	result = storage_media_buffer_reader_grab_buffer(
+	          reader,
+	          &storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_reader_stop(
+	          reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading a size that ends before the end of the input
+	 */
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          1000,
+	          5000,
+	          EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	storage_media_offset = 1000;
+
+	result = ewf_test_tools_storage_media_buffer_reader_grab_all(
+	          reader,
+	          storage_media_buffer_queue,
+	          &input,
+	          &storage_media_offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "storage_media_offset",
+	 (int64_t) storage_media_offset,
+	 (int64_t) 6000 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_reader_stop(
+	          reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that exceeds the end of the input
+	 */
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          2 * EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE,
+	          EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	storage_media_offset = 0;
+
+	result = ewf_test_tools_storage_media_buffer_reader_grab_all(
+	          reader,
+	          storage_media_buffer_queue,
+	          &input,
+	          &storage_media_offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "storage_media_offset",
+	 (int64_t) storage_media_offset,
+	 (int64_t) EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_DATA_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_reader_stop(
+	          reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a read error is handed over at the end of the input
+	 */
+	input.error_offset = EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE;
+
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          0,
+	          EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	storage_media_offset = 0;
+
+	result = ewf_test_tools_storage_media_buffer_reader_grab_all(
+	          reader,
+	          storage_media_buffer_queue,
+	          &input,
+	          &storage_media_offset,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "storage_media_offset",
+	 (int64_t) storage_media_offset,
+	 (int64_t) EWF_TEST_TOOLS_STORAGE_MEDIA_BUFFER_READER_BUFFER_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_stop(
+	          reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	input.error_offset = -1;
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_reader_grab_buffer(
+	          NULL,
+	          &storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_reader_free(
+	          &reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_free(
+	          &storage_media_buffer_queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reader != NULL )
+	{
+		storage_media_buffer_reader_free(
+		 &reader,
+		 NULL );
+	}
+	if( storage_media_buffer_queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &storage_media_buffer_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the storage_media_buffer_reader_start and storage_media_buffer_reader_stop functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_storage_media_buffer_reader_start(
+     void )
+{
+	ewf_test_tools_input_t input;
+
+	libcerror_error_t *error                        = NULL;
+	libcthreads_queue_t *storage_media_buffer_queue = NULL;
+	storage_media_buffer_t *storage_media_buffer    = NULL;
+	storage_media_buffer_reader_t *reader           = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	ewf_test_tools_input_set_data(
+	 &input );
+
+	result = storage_media_buffer_queue_initialize(
+	          &storage_media_buffer_queue,
+	          NULL,
+	          2,
+	          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_reader_initialize(
+	          &reader,
+	          storage_media_buffer_queue,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping a reader that was not started
+	 */
+	result = storage_media_buffer_reader_stop(
+	          reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping a reader before the end of the input was reached
+	 */
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_reader_grab_buffer(
+	          reader,
+	          &storage_media_buffer,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "storage_media_buffer",
+	 storage_media_buffer );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_release_buffer(
+	          storage_media_buffer_queue,
+	          storage_media_buffer,
+	          &error );
+
+	storage_media_buffer = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_grab_buffer(
+	          reader,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = storage_media_buffer_reader_stop(
+	          reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "reader->read_thread",
+	 reader->read_thread );
+
+	/* Test error cases
+	 */
+	result = storage_media_buffer_reader_start(
+	          NULL,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          NULL,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          -1,
+	          0,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = storage_media_buffer_reader_stop(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test freeing a reader that is still running
+	 */
+	result = storage_media_buffer_reader_start(
+	          reader,
+	          (intptr_t *) &input,
+	          (ssize_t (*)(intptr_t *, storage_media_buffer_t *, off64_t, size_t, libcerror_error_t **)) &ewf_test_tools_input_read,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = storage_media_buffer_reader_free(
+	          &reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = storage_media_buffer_queue_free(
+	          &storage_media_buffer_queue,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reader != NULL )
+	{
+		storage_media_buffer_reader_free(
+		 &reader,
+		 NULL );
+	}
+	if( storage_media_buffer_queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &storage_media_buffer_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_reader_initialize",
+	 ewf_test_tools_storage_media_buffer_reader_initialize );
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_reader_free",
+	 ewf_test_tools_storage_media_buffer_reader_free );
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_reader_start",
+	 ewf_test_tools_storage_media_buffer_reader_start );
+
+	EWF_TEST_RUN(
+	 "storage_media_buffer_reader_grab_buffer",
+	 ewf_test_tools_storage_media_buffer_reader_grab_buffer );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -23,6 +23,7 @@ import argparse
 import os
 import random
 import sys
+import threading
 import unittest
 
 import pyewf
@@ -128,6 +129,72 @@ class HandleTypeTests(unittest.TestCase):
         del file_object
         ewf_handle.close()
 
+  def test_clone(self):
+    """Tests the clone function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    filenames = pyewf.glob(unittest.source)
+
+    ewf_handle = pyewf.handle()
+
+    ewf_handle.open(filenames)
+
+    media_size = ewf_handle.get_media_size()
+
+    clone_handles = [ewf_handle.clone() for _ in range(4)]
+
+    for clone_handle in clone_handles:
+      self.assertIsNotNone(clone_handle)
+      self.assertEqual(clone_handle.get_media_size(), media_size)
+
+    # Test concurrent reads using a clone per thread.
+    expected_data = ewf_handle.read_buffer_at_offset(4096, 0)
+    read_data = [None] * len(clone_handles)
+
+    def ReadData(index):
+      read_data[index] = clone_handles[index].read_buffer_at_offset(4096, 0)
+
+    threads = [
+        threading.Thread(target=ReadData, args=(index,))
+        for index in range(len(clone_handles))]
+
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+
+    for data in read_data:
+      self.assertEqual(data, expected_data)
+
+    for clone_handle in clone_handles:
+      clone_handle.close()
+
+    ewf_handle.close()
+
+  def test_clone_file_object(self):
+    """Tests the clone function on a file-like object."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    filenames = pyewf.glob(unittest.source)
+    file_objects = [open(filename, "rb") for filename in filenames]
+
+    ewf_handle = pyewf.handle()
+
+    ewf_handle.open_file_objects(file_objects)
+
+    with self.assertRaises(IOError):
+      ewf_handle.clone()
+
+    ewf_handle.close()
+
+    for file_object in file_objects:
+      file_object.close()
+
   def test_read_buffer(self):
     """Tests the read_buffer function."""
     if not unittest.source:
@@ -300,6 +367,186 @@ class HandleTypeTests(unittest.TestCase):
     with self.assertRaises(IOError):
       ewf_handle.read_buffer_at_offset(4096, 0)
 
+  def test_read_buffer_into(self):
+    """Tests the read_buffer_into function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    filenames = pyewf.glob(unittest.source)
+
+    ewf_handle = pyewf.handle()
+
+    ewf_handle.open(filenames)
+
+    media_size = ewf_handle.get_media_size()
+
+    expected_data = ewf_handle.read_buffer_at_offset(4096, 0)
+
+    ewf_handle.seek_offset(0, os.SEEK_SET)
+
+    # Test normal read.
+    data = bytearray(4096)
+
+    read_count = ewf_handle.read_buffer_into(data)
+
+    self.assertEqual(read_count, min(media_size, 4096))
+    self.assertEqual(data[:read_count], expected_data)
+
+    # Test read into a memoryview.
+    ewf_handle.seek_offset(0, os.SEEK_SET)
+
+    data = bytearray(8192)
+
+    read_count = ewf_handle.readinto(memoryview(data)[4096:])
+
+    self.assertEqual(read_count, min(media_size, 4096))
+    self.assertEqual(data[4096:4096 + read_count], expected_data)
+
+    with self.assertRaises(TypeError):
+      ewf_handle.read_buffer_into(b"immutable")
+
+    ewf_handle.close()
+
+    # Test the read without open.
+    with self.assertRaises(IOError):
+      ewf_handle.read_buffer_into(bytearray(4096))
+
+  def test_read_buffer_at_offset_into(self):
+    """Tests the read_buffer_at_offset_into function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    filenames = pyewf.glob(unittest.source)
+
+    ewf_handle = pyewf.handle()
+
+    ewf_handle.open(filenames)
+
+    media_size = ewf_handle.get_media_size()
+
+    # Test normal read.
+    data = bytearray(4096)
+
+    read_count = ewf_handle.read_buffer_at_offset_into(data, 0)
+
+    self.assertEqual(read_count, min(media_size, 4096))
+    self.assertEqual(
+        data[:read_count], ewf_handle.read_buffer_at_offset(4096, 0))
+
+    if media_size > 8:
+      # Read buffer on media_size boundary.
+      read_count = ewf_handle.read_buffer_at_offset_into(
+          data, media_size - 8)
+
+      self.assertEqual(read_count, 8)
+
+      # Read buffer beyond media_size boundary.
+      read_count = ewf_handle.read_buffer_at_offset_into(
+          data, media_size + 8)
+
+      self.assertEqual(read_count, 0)
+
+    with self.assertRaises(ValueError):
+      ewf_handle.read_buffer_at_offset_into(data, -1)
+
+    ewf_handle.close()
+
+    # Test the read without open.
+    with self.assertRaises(IOError):
+      ewf_handle.read_buffer_at_offset_into(data, 0)
+
+  def test_read_buffers_at_offsets(self):
+    """Tests the read_buffers_at_offsets function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    filenames = pyewf.glob(unittest.source)
+
+    ewf_handle = pyewf.handle()
+
+    ewf_handle.open(filenames)
+
+    media_size = ewf_handle.get_media_size()
+
+    # Test normal read, with ranges that are not sorted and that overlap.
+    ranges = [(4096, 512), (0, 4096), (0, 0), (16, 32)]
+    if media_size > 8:
+      ranges.append((media_size - 8, 16))
+      ranges.append((media_size + 8, 16))
+
+    data_list = ewf_handle.read_buffers_at_offsets(ranges)
+
+    self.assertEqual(len(data_list), len(ranges))
+
+    # A range that cannot be read is returned as None instead of failing
+    # the other ranges.
+    for (offset, size), data in zip(ranges, data_list):
+      try:
+        expected_data = ewf_handle.read_buffer_at_offset(size, offset)
+      except IOError:
+        expected_data = None
+
+      self.assertEqual(data, expected_data)
+
+    self.assertEqual(ewf_handle.read_buffers_at_offsets([]), [])
+
+    with self.assertRaises(ValueError):
+      ewf_handle.read_buffers_at_offsets([(-1, 16)])
+
+    with self.assertRaises(ValueError):
+      ewf_handle.read_buffers_at_offsets([(0, -1)])
+
+    with self.assertRaises(TypeError):
+      ewf_handle.read_buffers_at_offsets([0])
+
+    ewf_handle.close()
+
+    # Test the read without open.
+    with self.assertRaises(IOError):
+      ewf_handle.read_buffers_at_offsets([(0, 16)])
+
+  def test_iter_chunks(self):
+    """Tests the iter_chunks function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    filenames = pyewf.glob(unittest.source)
+
+    ewf_handle = pyewf.handle()
+
+    ewf_handle.open(filenames)
+
+    chunk_size = ewf_handle.get_chunk_size()
+    media_size = ewf_handle.get_media_size()
+
+    expected_offset = 0
+    for offset, data in ewf_handle.iter_chunks():
+      self.assertEqual(offset, expected_offset)
+      self.assertLessEqual(len(data), chunk_size)
+      self.assertEqual(
+          data.tobytes(), ewf_handle.read_buffer_at_offset(len(data), offset))
+
+      expected_offset += len(data)
+
+    self.assertEqual(expected_offset, media_size)
+
+    if media_size > 8:
+      # Iterate starting at an offset that is not chunk aligned.
+      offsets = [offset for offset, _ in ewf_handle.iter_chunks(offset=8)]
+
+      self.assertEqual(offsets[0], 8)
+      if len(offsets) > 1:
+        self.assertEqual(offsets[1], chunk_size)
+
+    with self.assertRaises(ValueError):
+      ewf_handle.iter_chunks(offset=-1)
+
+    ewf_handle.close()
+
+    # Test the iterator without open.
+    with self.assertRaises(IOError):
+      ewf_handle.iter_chunks()
+
   def test_seek_offset(self):
     """Tests the seek_offset function."""
     if not unittest.source:
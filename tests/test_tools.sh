@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-TOOLS_TESTS="byte_size_string device_handle digest_hash guid info_handle output platform signal verification_handle";
+TOOLS_TESTS="byte_size_string chunk_hash_map device_handle digest_hash digest_hash_threads guid info_handle mount_nbd output platform signal storage_media_buffer_reader verification_handle";
 TOOLS_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 